@@ -46,6 +46,11 @@
 **   dbi_connectionCommit() Commit the current transaction.
 **   dbi_connectionCursor() Declare a cursor. Return the handle.
 **   dbi_connectionRollback() Rollback the transaction.
+**   dbi_stmtCacheGet() Take a prepared statement handle from the cache.
+**   dbi_stmtCachePut() Return a prepared statement handle to the cache.
+**   dbi_stmtCacheFree() Drop all cached and pooled statement handles.
+**   dbi_stmtPoolGet() Take a free statement handle from the pool.
+**   dbi_stmtPoolPut() Return a statement handle to the pool.
 ** 		
 **)E
 **
@@ -86,8 +91,24 @@
 **          Changed default ODBC driver name to use from
 **          "INGRES 3.0" to "INGRES". This means the default Ingres
 **          ODBC driver really will be used.
+**      16-Oct-2026 (agent)
+**          Added a per-connection LRU cache of prepared statement
+**          handles keyed by query text, so cursors re-executing a query
+**          already prepared on the connection skip SQLPrepare().
+**      16-Oct-2026 (agent)
+**          Added a small per-connection pool of free statement handles.
+**      16-Oct-2026 (agent)
+**          Pooled and cached statement handles have their query timeout
+**          cleared.
+**      17-Oct-2026 (agent)
+**          Added dbi_connectionValidate() for the connection pool.
+**      17-Oct-2026 (agent)
+**          Added dbi_free_env(). dbi_alloc_env() turns connection pooling
+**          off for environments of non-pooled connections.
 **/
 
+static void dbi_stmtReset( SQLHANDLE hstmt );
+
 /*{
 ** Name: dbi_alloc_env
 **
@@ -112,6 +133,10 @@
 ** History:
 **      05-June-2006 (loera01)
 **          Created.
+**      17-Oct-2026 (agent)
+**          Set connection pooling off for non-pooled connections, the
+**          setting is process wide and a pooled environment may have
+**          been allocated first.
 }*/
 
 RETCODE
@@ -125,19 +150,17 @@ dbi_alloc_env( IIDBI_ENV *penv, IIDBI_DBC *pdbc)
 
     for (;;)
     {
-        if (conn->pooled)
+        rc = SQLSetEnvAttr(SQL_NULL_HANDLE, SQL_ATTR_CONNECTION_POOLING,
+            (SQLPOINTER)(conn->pooled ? SQL_CP_ONE_PER_HENV : SQL_CP_OFF),
+            sizeof(SQLINTEGER));
+        if (rc != SQL_SUCCESS)
         {
-            rc = SQLSetEnvAttr(SQL_NULL_HANDLE, SQL_ATTR_CONNECTION_POOLING,
-                (SQLPOINTER)SQL_CP_ONE_PER_HENV,  sizeof(SQLINTEGER));
-            if (rc != SQL_SUCCESS)
-            {
-                return_code = IIDBI_ERROR( rc, NULL, NULL, NULL, &pdbc->hdr.err );
-                DBPRINTF(DBI_TRC_STAT)( "%p: %d = SQLSetEnvAttr (%d) %s %s %x\n", 
-                    pdbc, rc, __LINE__, pdbc->hdr.err.sqlState, 
-                    pdbc->hdr.err.messageText,
-                    pdbc->hdr.err.native );
-                break;
-            }
+            return_code = IIDBI_ERROR( rc, NULL, NULL, NULL, &pdbc->hdr.err );
+            DBPRINTF(DBI_TRC_STAT)( "%p: %d = SQLSetEnvAttr (%d) %s %s %x\n", 
+                pdbc, rc, __LINE__, pdbc->hdr.err.sqlState, 
+                pdbc->hdr.err.messageText,
+                pdbc->hdr.err.native );
+            break;
         }
         rc = SQLAllocHandle(SQL_HANDLE_ENV, NULL, &henv);
         if (rc != SQL_SUCCESS)
@@ -167,6 +190,51 @@ dbi_alloc_env( IIDBI_ENV *penv, IIDBI_DBC *pdbc)
     return return_code;
 }
 
+/*{
+** Name: dbi_free_env
+**
+** Description:
+**     Free an ODBC environment handle. All connections allocated from
+**     it must be closed.
+**
+** Inputs:
+**     penv - DBI environment handle.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     SQL_SUCCESS
+**     SQL_INVALID_HANDLE
+**     SQL_ERROR
+** 
+** Side Effects:
+**     The handle of penv is cleared.
+**
+** History:
+**      17-Oct-2026 (agent)
+**          Created.
+}*/
+
+RETCODE
+dbi_free_env( IIDBI_ENV *penv )
+{
+    RETCODE rc = SQL_SUCCESS;
+
+    DBPRINTF(DBI_TRC_ENTRY)( "%p: dbi_free_env }}}1\n", penv );
+
+    if (penv->hdr.handle)
+    {
+        rc = SQLFreeHandle( SQL_HANDLE_ENV, penv->hdr.handle );
+        DBPRINTF(DBI_TRC_STAT)( "%p: %d = SQLFreeHandle SQL_HANDLE_ENV\n",
+            penv, rc );
+        penv->hdr.handle = NULL;
+    }
+
+    DBPRINTF(DBI_TRC_ENTRY)( "%p: dbi_free_env {{{1\n", penv );
+    return rc;
+}
+
 /*{
 ** Name: dbi_connect	-Create a connection to the specified database.
 **
@@ -216,6 +284,8 @@ dbi_alloc_env( IIDBI_ENV *penv, IIDBI_DBC *pdbc)
 **      11-Jul-2004 (raymond.fan@ca.com)
 **          Assign IIDBIenv with initial value on initialization.
 **          Initialize henv from IIDBIenv.
+**      16-Oct-2026 (agent)
+**          Enable the prepared statement cache.
 }*/
 RETCODE
 dbi_connect( IIDBI_DBC *pdbc)
@@ -425,6 +495,7 @@ dbi_connect( IIDBI_DBC *pdbc)
                 pdbc->hdr.err.native );
             break;
         }
+        pdbc->stmtCacheLock = PyThread_allocate_lock();
         return_code = DBI_SQL_SUCCESS;
         break;
     }
@@ -448,6 +519,8 @@ dbi_connect( IIDBI_DBC *pdbc)
 **          Created.
 **      10-Jul-2004 (raymond.fan@ca.com)
 **          Add ODBC connect code from clach04, loera01 
+**      16-Oct-2026 (agent)
+**          Drop the cached statement handles before disconnecting.
 }*/
 RETCODE
 dbi_connectionClose( IIDBI_DBC *pdbc )
@@ -457,6 +530,8 @@ dbi_connectionClose( IIDBI_DBC *pdbc )
     int         return_code = DBI_SQL_SUCCESS;
 
     DBPRINTF(DBI_TRC_ENTRY)("%p: dbi_connectionClose {{{1\n", pdbc);
+
+    dbi_stmtCacheFree(pdbc);
     
     if (hdbc)
     {
@@ -627,3 +702,379 @@ dbi_connectionRollback( IIDBI_DBC *pdbc )
     DBPRINTF(DBI_TRC_ENTRY)("%p: dbi_connectionRollback }}}1\n", pdbc);
     return return_code;
 }
+
+/*{
+** Name: dbi_connectionValidate - Check that a connection is usable
+**
+** Description:
+**     Executes a validation query on the connection, discarding any
+**     result, then rolls back so the next user starts with no
+**     transaction open. Used by the connection pool before it hands
+**     out an idle connection.
+**
+** Inputs:
+**     pdbc - DBI connection handle.
+**     query - validation query.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     DBI_SQL_SUCCESS if the query ran, else the error of the failing
+**     call, in pdbc->hdr.err.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**      17-Oct-2026 (agent)
+**          Created.
+}*/
+RETCODE
+dbi_connectionValidate( IIDBI_DBC *pdbc, char *query )
+{
+    RETCODE rc;
+    HDBC hdbc = pdbc->hdr.handle;
+    SQLHANDLE hstmt = dbi_stmtPoolGet(pdbc);
+    int         return_code = DBI_SQL_SUCCESS;
+
+    DBPRINTF(DBI_TRC_ENTRY)("%p: dbi_connectionValidate {{{1\n", pdbc);
+
+    if (!hstmt)
+    {
+        rc = SQLAllocHandle(SQL_HANDLE_STMT, hdbc, &hstmt);
+        if (rc != SQL_SUCCESS)
+        {
+            return_code = IIDBI_ERROR( rc, NULL, hdbc, NULL, &pdbc->hdr.err );
+            DBPRINTF(DBI_TRC_STAT)( "%p: %d = SQLAllocHandle SQL_HANDLE_STMT (%d) %s %s %x\n", pdbc,
+                rc, __LINE__, pdbc->hdr.err.sqlState, pdbc->hdr.err.messageText,
+                pdbc->hdr.err.native );
+            DBPRINTF(DBI_TRC_ENTRY)("%p: dbi_connectionValidate }}}1\n", pdbc);
+            return return_code;
+        }
+    }
+
+    rc = SQLExecDirect(hstmt, (SQLCHAR *)query, SQL_NTS);
+    if (rc != SQL_SUCCESS && rc != SQL_SUCCESS_WITH_INFO && rc != SQL_NO_DATA)
+    {
+        return_code = IIDBI_ERROR( rc, NULL, NULL, hstmt, &pdbc->hdr.err );
+        DBPRINTF(DBI_TRC_STAT)( "%p: %d = SQLExecDirect (%d) %s %s %x\n", pdbc,
+            rc, __LINE__, pdbc->hdr.err.sqlState, pdbc->hdr.err.messageText,
+            pdbc->hdr.err.native );
+    }
+    dbi_stmtPoolPut(pdbc, hstmt);
+
+    if (return_code == DBI_SQL_SUCCESS)
+        return_code = dbi_connectionRollback(pdbc);
+
+    DBPRINTF(DBI_TRC_ENTRY)("%p: dbi_connectionValidate }}}1\n", pdbc);
+    return return_code;
+}
+
+/*{
+** Name: dbi_stmtCacheGet - Take a prepared statement from the cache
+**
+** Description:
+**     Looks up a statement handle prepared with the given query text.
+**     The handle is removed from the cache and belongs to the caller
+**     until it is returned with dbi_stmtCachePut().
+**
+** Inputs:
+**     pdbc - DBI connection handle.
+**     stmnt - query text.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     The prepared statement handle, NULL if the query is not cached.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**      16-Oct-2026 (agent)
+**          Created.
+}*/
+SQLHANDLE
+dbi_stmtCacheGet( IIDBI_DBC *pdbc, char *stmnt )
+{
+    IIDBI_CACHED_STMT *entry, *prev = NULL;
+    SQLHANDLE hstmt = NULL;
+
+    if (!pdbc->stmtCacheLock)
+        return NULL;
+
+    PyThread_acquire_lock(pdbc->stmtCacheLock, WAIT_LOCK);
+    for (entry = pdbc->stmtCache; entry; prev = entry, entry = entry->next)
+    {
+        if (!strcmp(entry->sqlText, stmnt))
+        {
+            if (prev)
+                prev->next = entry->next;
+            else
+                pdbc->stmtCache = entry->next;
+            pdbc->stmtCacheCount--;
+            break;
+        }
+    }
+    PyThread_release_lock(pdbc->stmtCacheLock);
+
+    if (entry)
+    {
+        hstmt = entry->handle;
+        free(entry->sqlText);
+        free(entry);
+    }
+    DBPRINTF(DBI_TRC_STAT)( "%p: statement cache %s for %s\n", pdbc,
+        hstmt ? "hit" : "miss", stmnt );
+    return hstmt;
+}
+
+/*{
+** Name: dbi_stmtCachePut - Return a prepared statement to the cache
+**
+** Description:
+**     Closes any open cursor on the handle, releases its column and
+**     parameter bindings, resets the row and parameter array attributes
+**     and adds it to the front of the cache. The
+**     least recently used handles beyond IIDBI_STMT_CACHE_SIZE are
+**     dropped. When the cache is disabled the handle is dropped.
+**
+** Inputs:
+**     pdbc - DBI connection handle.
+**     hstmt - statement handle prepared with sqlText.
+**     sqlText - query text, allocated with malloc().
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None.
+**
+** Side Effects:
+**     The cache takes over hstmt and sqlText.
+**
+** History:
+**      16-Oct-2026 (agent)
+**          Created.
+}*/
+void
+dbi_stmtCachePut( IIDBI_DBC *pdbc, SQLHANDLE hstmt, char *sqlText )
+{
+    IIDBI_CACHED_STMT *entry = NULL, *evict = NULL, *next;
+    int i;
+
+    dbi_stmtReset(hstmt);
+
+    if (pdbc->stmtCacheLock)
+        entry = (IIDBI_CACHED_STMT *)calloc(1, sizeof(IIDBI_CACHED_STMT));
+    if (!entry)
+    {
+        SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
+        free(sqlText);
+        return;
+    }
+    entry->sqlText = sqlText;
+    entry->handle = hstmt;
+
+    PyThread_acquire_lock(pdbc->stmtCacheLock, WAIT_LOCK);
+    entry->next = pdbc->stmtCache;
+    pdbc->stmtCache = entry;
+    if (++pdbc->stmtCacheCount > IIDBI_STMT_CACHE_SIZE)
+    {
+        for (i = 1; i < IIDBI_STMT_CACHE_SIZE; i++)
+            entry = entry->next;
+        evict = entry->next;
+        entry->next = NULL;
+        pdbc->stmtCacheCount = IIDBI_STMT_CACHE_SIZE;
+    }
+    PyThread_release_lock(pdbc->stmtCacheLock);
+
+    for (; evict; evict = next)
+    {
+        next = evict->next;
+        DBPRINTF(DBI_TRC_STAT)( "%p: statement cache drops %s\n", pdbc,
+            evict->sqlText );
+        SQLFreeHandle(SQL_HANDLE_STMT, evict->handle);
+        free(evict->sqlText);
+        free(evict);
+    }
+}
+
+/*{
+** Name: dbi_stmtCacheFree - Drop all cached statements
+**
+** Description:
+**     Frees every cached and pooled statement handle and disables the
+**     cache and the pool.
+**     Must be called before the connection handle is disconnected.
+**
+** Inputs:
+**     pdbc - DBI connection handle.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**      16-Oct-2026 (agent)
+**          Created.
+**      16-Oct-2026 (agent)
+**          Drop the pooled handles too.
+}*/
+void
+dbi_stmtCacheFree( IIDBI_DBC *pdbc )
+{
+    IIDBI_CACHED_STMT *entry, *next;
+
+    if (!pdbc->stmtCacheLock)
+        return;
+
+    PyThread_acquire_lock(pdbc->stmtCacheLock, WAIT_LOCK);
+    entry = pdbc->stmtCache;
+    pdbc->stmtCache = NULL;
+    pdbc->stmtCacheCount = 0;
+    PyThread_release_lock(pdbc->stmtCacheLock);
+    PyThread_free_lock(pdbc->stmtCacheLock);
+    pdbc->stmtCacheLock = NULL;
+
+    while (pdbc->stmtPoolCount > 0)
+        SQLFreeHandle(SQL_HANDLE_STMT, 
+            pdbc->stmtPool[--pdbc->stmtPoolCount]);
+
+    for (; entry; entry = next)
+    {
+        next = entry->next;
+        SQLFreeHandle(SQL_HANDLE_STMT, entry->handle);
+        free(entry->sqlText);
+        free(entry);
+    }
+}
+
+/*{
+** Name: dbi_stmtPoolGet - Take a free statement handle from the pool
+**
+** Description:
+**     Returns an unprepared statement handle left by a closed cursor.
+**
+** Inputs:
+**     pdbc - DBI connection handle.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     A statement handle, NULL if the pool is empty.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**      16-Oct-2026 (agent)
+**          Created.
+}*/
+SQLHANDLE
+dbi_stmtPoolGet( IIDBI_DBC *pdbc )
+{
+    SQLHANDLE hstmt = NULL;
+
+    if (!pdbc->stmtCacheLock)
+        return NULL;
+
+    PyThread_acquire_lock(pdbc->stmtCacheLock, WAIT_LOCK);
+    if (pdbc->stmtPoolCount > 0)
+        hstmt = pdbc->stmtPool[--pdbc->stmtPoolCount];
+    PyThread_release_lock(pdbc->stmtCacheLock);
+
+    return hstmt;
+}
+
+/*{
+** Name: dbi_stmtPoolPut - Return a statement handle to the pool
+**
+** Description:
+**     Resets the handle as for dbi_stmtCachePut() and keeps it for the
+**     next cursor. The handle is dropped if the pool is full.
+**
+** Inputs:
+**     pdbc - DBI connection handle.
+**     hstmt - statement handle.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None.
+**
+** Side Effects:
+**     The pool takes over hstmt.
+**
+** History:
+**      16-Oct-2026 (agent)
+**          Created.
+}*/
+void
+dbi_stmtPoolPut( IIDBI_DBC *pdbc, SQLHANDLE hstmt )
+{
+    int pooled = FALSE;
+
+    dbi_stmtReset(hstmt);
+
+    if (pdbc->stmtCacheLock)
+    {
+        PyThread_acquire_lock(pdbc->stmtCacheLock, WAIT_LOCK);
+        if (pdbc->stmtPoolCount < IIDBI_STMT_POOL_SIZE)
+        {
+            pdbc->stmtPool[pdbc->stmtPoolCount++] = hstmt;
+            pooled = TRUE;
+        }
+        PyThread_release_lock(pdbc->stmtCacheLock);
+    }
+    if (!pooled)
+        SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
+}
+
+/*{
+** Name: dbi_stmtReset - Reset a statement handle for reuse
+**
+** Description:
+**     Closes any open cursor, releases the column and parameter
+**     bindings and restores the row and parameter array attributes.
+**
+** Inputs:
+**     hstmt - statement handle.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**      16-Oct-2026 (agent)
+**          Created.
+**      16-Oct-2026 (agent)
+**          Clear SQL_ATTR_QUERY_TIMEOUT.
+}*/
+static void
+dbi_stmtReset( SQLHANDLE hstmt )
+{
+    SQLFreeStmt(hstmt, SQL_CLOSE);
+    SQLFreeStmt(hstmt, SQL_UNBIND);
+    SQLFreeStmt(hstmt, SQL_RESET_PARAMS);
+    SQLSetStmtAttr(hstmt, SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER)1, 0);
+    SQLSetStmtAttr(hstmt, SQL_ATTR_ROWS_FETCHED_PTR, NULL, 0);
+    SQLSetStmtAttr(hstmt, SQL_ATTR_PARAMSET_SIZE, (SQLPOINTER)1, 0);
+    SQLSetStmtAttr(hstmt, SQL_ATTR_PARAM_STATUS_PTR, NULL, 0);
+    SQLSetStmtAttr(hstmt, SQL_ATTR_PARAMS_PROCESSED_PTR, NULL, 0);
+    SQLSetStmtAttr(hstmt, SQL_ATTR_QUERY_TIMEOUT, (SQLPOINTER)0, 0);
+}
@@ -23,6 +23,7 @@
 # include <sqlext.h>
 # include <iidbi.h>
 # include <iidbicurs.h>
+# include <iidbiconn.h>
 # include <iidbiutil.h>
 
 #define MAX_DISPLAY_SIZE 0x7fffffff
@@ -34,7 +35,10 @@
 **(E
 ** 	 dbi_cursorClose() Close the cursor.
 ** 	 dbi_cursorExecute() Prepare and execute a statement with vargs.
+** 	 dbi_cursorCancel() Cancel the query a statement is executing.
 ** 	 dbi_cursorFetchone() Fetch one row from a cursor.
+** 	 dbi_bindColumns() Bind result columns for block (rowset) fetches.
+** 	 dbi_rowsetDetach() Hand over the rowset buffer of a column.
 ** 		
 **)E
 **
@@ -159,6 +163,75 @@
 **      issue with other LONG types (LONG BYTE and LONG VARCHAR),
 **      lack of correct orInd was not an issue for these types
 **      but is inconsistent hence the change.
+**  16-Oct-2026 (agent)
+**      Added block fetch path. When the cursor arraysize is greater than
+**      one and the result set has no LONG columns, the columns are bound
+**      column-wise with SQLBindCol and SQL_ATTR_ROW_ARRAY_SIZE rows are
+**      retrieved per SQLFetch. dbi_cursorFetchone() then hands out rows
+**      from the rowset buffer. dbi_cursorClose() clears the statement
+**      handle once it has been dropped.
+**  16-Oct-2026 (agent)
+**      Column data buffers are allocated once per result set rather than
+**      for every fetched row.
+**  16-Oct-2026 (agent)
+**      Added dbi_rowsetPending().
+**  16-Oct-2026 (agent)
+**      Added parameter arrays. When pstmt->paramsetSize is greater than
+**      one BindParameters() binds column-wise parameter arrays with
+**      SQL_ATTR_PARAMSET_SIZE so a whole batch is sent in one execute.
+**  16-Oct-2026 (agent)
+**      With pstmt->keepParameters set, parameter descriptors survive
+**      dbi_cursorExecute() and BindParameters() skips parameters whose
+**      binding is unchanged.
+**  16-Oct-2026 (agent)
+**      Prepared statement handles are returned to the connection's
+**      statement cache instead of being dropped, and a query found in
+**      the cache is executed without preparing it again.
+**  16-Oct-2026 (agent)
+**      Direct execution reuses the cursor's statement handle. Handles of
+**      closed cursors go to a per-connection pool of free handles.
+**  16-Oct-2026 (agent)
+**      Without block fetches, columns of bounded size are still bound
+**      with SQLBindCol() (pstmt->colsBound) and only LONG columns are
+**      read with SQLGetData().
+**  16-Oct-2026 (agent)
+**      With pstmt->lobStreaming set, the last LONG column read with
+**      SQLGetData() is left in the driver after its first segment, the
+**      rest is read on demand through dbi_cursorGetSegment().
+**  16-Oct-2026 (agent)
+**      Parameters with a putStream are bound as data-at-execution of
+**      unknown length and sent segment by segment as the stream is read,
+**      see dbi_putStream().
+**  16-Oct-2026 (agent)
+**      LONG columns are read into a buffer sized from the driver's length
+**      indicator or grown geometrically, character and binary values
+**      directly into the Python string returned for them.
+**  16-Oct-2026 (agent)
+**      The rowset buffer of a column can be handed over to the caller,
+**      see dbi_rowsetDetach(), for cursor.fetchbuffers().
+**  16-Oct-2026 (agent)
+**      Parameter descriptors, and a slot per parameter for fixed size
+**      and Decimal values, come from an arena kept by the statement (see
+**      dbi_paramArenaAlloc()), so executes with the same number of
+**      parameters or fewer allocate nothing for them.
+**  16-Oct-2026 (agent)
+**      dbi_paramArenaFree() also frees the statement's wide character
+**      parameter buffer.
+**  16-Oct-2026 (agent)
+**      With pstmt->prefetch set, a native worker thread fetches the next
+**      rowset into a second set of buffers while the caller converts the
+**      current one, see dbi_prefetchStart().
+**  16-Oct-2026 (agent)
+**      dbi_cursorExecute() sets SQL_ATTR_QUERY_TIMEOUT from
+**      pstmt->queryTimeout and publishes the executing handle for
+**      dbi_cursorCancel().
+**  17-Oct-2026 (agent)
+**      The Python strings LONG columns are read into come from the
+**      allocator set by dbi_lobAllocator(), this file makes no Python
+**      calls for them.
+**  17-Oct-2026 (agent)
+**      The first failed row of a parameter array is kept in
+**      pstmt->paramsetError.
 **/
 
 /* 
@@ -177,6 +250,36 @@
 #define MAX_STRING_LEN_FOR_DECIMAL_PRECISION(x) (x+4)
 
 RETCODE BindParameters(IIDBI_STMT *pstmt, unsigned char isProc);
+static SQLLEN dbi_columnBinding(IIDBI_DESCRIPTOR *desc, SQLSMALLINT *cType);
+static RETCODE dbi_rowsetFetch(IIDBI_STMT *pstmt);
+static void dbi_unbindColumns(IIDBI_STMT *pstmt);
+static RETCODE dbi_bindParameterArrays(IIDBI_STMT *pstmt);
+static RETCODE dbi_paramArenaAlloc(IIDBI_STMT *pstmt, int numCols);
+static void dbi_unbindParameterArrays(IIDBI_STMT *pstmt);
+static int dbi_paramsetError(IIDBI_STMT *pstmt);
+static RETCODE dbi_prefetchStart(IIDBI_STMT *pstmt);
+static void dbi_prefetchWorker(void *arg);
+static RETCODE dbi_prefetchNext(IIDBI_STMT *pstmt);
+static void dbi_prefetchStop(IIDBI_STMT *pstmt);
+static void dbi_cursorRunning(IIDBI_STMT *pstmt, SQLHANDLE hstmt);
+static void dbi_prefetchFree(IIDBI_STMT *pstmt, IIDBI_PREFETCH *pf);
+static void dbi_paramIndicator(IIDBI_DESCRIPTOR *desc);
+static void dbi_forgetParameterBindings(IIDBI_STMT *pstmt);
+static int dbi_getDataAnyColumn(IIDBI_STMT *pstmt);
+static void dbi_copyBoundColumn(IIDBI_DESCRIPTOR *desc, int row);
+static int dbi_lobColumn(IIDBI_STMT *pstmt);
+static RETCODE dbi_fetchLobHead(IIDBI_STMT *pstmt, int colNbr);
+static RETCODE dbi_fetchLong(IIDBI_STMT *pstmt, int i, int segmentSize);
+static char *dbi_lobBuffer(IIDBI_DESCRIPTOR *desc, SQLSMALLINT cType, 
+    char *buf, SQLLEN count, SQLLEN size);
+static void dbi_lobRelease(IIDBI_DESCRIPTOR *desc);
+
+/*
+** Allocator of LONG column values, see dbi_lobAllocator().
+*/
+static IIDBI_LOBALLOC *dbi_lobAlloc = NULL;
+static RETCODE dbi_putStream(IIDBI_STMT *pstmt, IIDBI_PUTSTREAM *stream, 
+    int segmentSize);
 
 /*{
 ** Name: dbi_cursorClose - Close the cursor
@@ -199,6 +302,19 @@ RETCODE BindParameters(IIDBI_STMT *pstmt, unsigned char isProc);
 ** History:
 **     08-Jul-2004 (peeje01)
 **         Created.
+**     16-Oct-2026 (agent)
+**         Clear the statement handle after SQL_DROP so later cleanup
+**         (dbi_freeDescriptor) does not use a freed handle.
+**     16-Oct-2026 (agent)
+**         Return a prepared handle to the connection's statement cache.
+**     16-Oct-2026 (agent)
+**         Return other handles to the connection's statement pool.
+**     16-Oct-2026 (agent)
+**         Invalidate LOB readers on the current row.
+**     16-Oct-2026 (agent)
+**         Stop the prefetch worker before the handle is given up.
+**     17-Oct-2026 (agent)
+**         Check pstmt before invalidating the LOB readers.
 }*/
 
 RETCODE
@@ -215,6 +331,9 @@ dbi_cursorClose( IIDBI_STMT* pstmt )
         return_code = DBI_INTERNAL_ERROR; 
         goto exitCloseCursor;
     }
+    pstmt->rowGeneration++;
+    pstmt->lobColumn = 0;
+    dbi_prefetchStop(pstmt);
     pstmt->rowCount = -1;
     hstmt = pstmt->hdr.handle;
     if (hstmt)
@@ -246,7 +365,16 @@ dbi_cursorClose( IIDBI_STMT* pstmt )
             pstmt->hasResultSet = 0;
         }
 exitCloseCursor:
-        if (hstmt)
+        if (hstmt && pstmt->pdbc && return_code == DBI_SQL_SUCCESS)
+        {
+            if (pstmt->preparedText)
+                dbi_stmtCachePut(pstmt->pdbc, hstmt, pstmt->preparedText);
+            else
+                dbi_stmtPoolPut(pstmt->pdbc, hstmt);
+            pstmt->preparedText = NULL;
+            pstmt->hdr.handle = NULL;
+        }
+        else if (hstmt)
         {
             rc = SQLFreeStmt( hstmt, SQL_DROP );
             if (rc == SQL_INVALID_HANDLE)
@@ -267,6 +395,7 @@ exitCloseCursor:
                     pstmt->hdr.err.messageText,
                     pstmt->hdr.err.native );
             }
+            pstmt->hdr.handle = NULL;
         }
     }
 
@@ -329,6 +458,36 @@ exitCloseCursor:
 **          boundary include an increment of the data pointer.
 **      30-Jul-2008 (clach04)
 **          dbi_cursorExecute() now checks for failed calls to BindParameters()
+**      16-Oct-2026 (agent)
+**          Report a parameter array execute as failed if any of its rows
+**          failed. Returns DBI_SQL_NO_DATA, without executing, if the
+**          driver does not accept the parameter array size.
+**      16-Oct-2026 (agent)
+**          Keep the parameter descriptors when pstmt->keepParameters is
+**          set. Clear prepareCompleted when the handle is replaced and
+**          close any open cursor before re-preparing a handle.
+**      16-Oct-2026 (agent)
+**          Take prepared handles from, and return them to, the
+**          connection's statement cache.
+**      16-Oct-2026 (agent)
+**          Reuse the statement handle for direct execution rather than
+**          dropping and allocating one per execute. New handles are
+**          taken from the connection's statement pool when possible.
+**      16-Oct-2026 (agent)
+**          Invalidate LOB readers on the current row.
+**      16-Oct-2026 (agent)
+**          Send parameters with a putStream through dbi_putStream().
+**      16-Oct-2026 (agent)
+**          Stop the prefetch worker of the previous result set.
+**      16-Oct-2026 (agent)
+**          Set SQL_ATTR_QUERY_TIMEOUT from pstmt->queryTimeout. The handle
+**          is published in pstmt->running while the query executes, for
+**          dbi_cursorCancel().
+**     17-Oct-2026 (agent)
+**         Clear streamFailed.
+**     17-Oct-2026 (agent)
+**         Set pstmt->paramsetError to the first failed row of a parameter
+**         array.
 }*/
 
 RETCODE
@@ -362,6 +521,12 @@ dbi_cursorExecute( IIDBI_DBC* pdbc, IIDBI_STMT* pstmt, char *stmnt,
         return DBI_INTERNAL_ERROR;
     }
 
+    pstmt->pdbc = pdbc;
+    pstmt->rowGeneration++;
+    pstmt->lobColumn = 0;
+    pstmt->hdr.err.streamFailed = FALSE;
+    pstmt->paramsetError = -1;
+    dbi_prefetchStop(pstmt);
     for(;;)
     {
         hstmt = pstmt->hdr.handle ? pstmt->hdr.handle : NULL;
@@ -379,9 +544,17 @@ dbi_cursorExecute( IIDBI_DBC* pdbc, IIDBI_STMT* pstmt, char *stmnt,
         }
         if (!pstmt->prepareRequested)
         {
-            if (hstmt)
+            if (hstmt && pstmt->preparedText)
+            {
+                dbi_stmtCachePut(pdbc, hstmt, pstmt->preparedText);
+                pstmt->preparedText = NULL;
+                pstmt->hdr.handle = hstmt = NULL;
+            }
+            else if (hstmt)
             {
-                rc = SQLFreeStmt(hstmt, SQL_DROP);
+                /* reuse the handle, closing any cursor left open */
+                SQLFreeStmt(hstmt, SQL_CLOSE);
+                rc = SQLFreeStmt(hstmt, SQL_RESET_PARAMS);
                 if (rc == SQL_INVALID_HANDLE)
                 {
                     DBPRINTF(DBI_TRC_STAT)( "%p: Invalid ODBC handle (%d)\n", 
@@ -392,38 +565,67 @@ dbi_cursorExecute( IIDBI_DBC* pdbc, IIDBI_STMT* pstmt, char *stmnt,
     
                 if (rc != SQL_SUCCESS) 
                 {
-                    return_code = IIDBI_ERROR( rc, NULL, hdbc, hstmt, 
+                    return_code = IIDBI_ERROR( rc, NULL, NULL, hstmt, 
                         &pstmt->hdr.err );
                     DBPRINTF(DBI_TRC_STAT)
-                        ( "%d = SQLAllocHandle SQL_HANDLE_STMT (%d) %s %s %x\n",
+                        ( "%d = SQLFreeStmt SQL_RESET_PARAMS (%d) %s %s %x\n",
                         rc, __LINE__, pstmt->hdr.err.sqlState, 
                         pstmt->hdr.err.messageText, pstmt->hdr.err.native );
                     break; 
                 }
             }
-            rc = SQLAllocHandle(SQL_HANDLE_STMT, hdbc, &hstmt);
-            if (rc == SQL_INVALID_HANDLE)
+            pstmt->prepareCompleted = FALSE;
+            if (!hstmt)
+                hstmt = dbi_stmtPoolGet(pdbc);
+            if (!hstmt)
             {
-                DBPRINTF(DBI_TRC_STAT)( "%p: Invalid ODBC handle (%d)\n", pstmt, __LINE__ );
-                return_code = DBI_INTERNAL_ERROR;
-                break; 
-            }
+                rc = SQLAllocHandle(SQL_HANDLE_STMT, hdbc, &hstmt);
+                if (rc == SQL_INVALID_HANDLE)
+                {
+                    DBPRINTF(DBI_TRC_STAT)( "%p: Invalid ODBC handle (%d)\n", pstmt, __LINE__ );
+                    return_code = DBI_INTERNAL_ERROR;
+                    break; 
+                }
     
-            if (rc != SQL_SUCCESS) 
-            {
-                return_code = IIDBI_ERROR( rc, NULL, hdbc, hstmt, 
-                    &pstmt->hdr.err );
-                DBPRINTF(DBI_TRC_STAT)
-                    ( "%d = SQLAllocHandle SQL_HANDLE_STMT (%d) %s %s %x\n",
-                    rc, __LINE__, pstmt->hdr.err.sqlState, 
-                    pstmt->hdr.err.messageText, pstmt->hdr.err.native );
-                break; 
+                if (rc != SQL_SUCCESS) 
+                {
+                    return_code = IIDBI_ERROR( rc, NULL, hdbc, hstmt, 
+                        &pstmt->hdr.err );
+                    DBPRINTF(DBI_TRC_STAT)
+                        ( "%d = SQLAllocHandle SQL_HANDLE_STMT (%d) %s %s %x\n",
+                        rc, __LINE__, pstmt->hdr.err.sqlState, 
+                        pstmt->hdr.err.messageText, pstmt->hdr.err.native );
+                    break; 
+                }
             }
          
             pstmt->hdr.handle = hstmt; 
+            dbi_forgetParameterBindings(pstmt);
         } /* if (!pstmt->prepareRequested */
         else
         {
+            if (hstmt && pstmt->preparedText && 
+                strcmp(pstmt->preparedText, stmnt))
+            {
+                /* prepared for another query, keep it for later */
+                dbi_stmtCachePut(pdbc, hstmt, pstmt->preparedText);
+                pstmt->preparedText = NULL;
+                pstmt->hdr.handle = hstmt = NULL;
+                pstmt->prepareCompleted = FALSE;
+            }
+            if (!hstmt && (hstmt = dbi_stmtCacheGet(pdbc, stmnt)))
+            {
+                pstmt->preparedText = strdup(stmnt);
+                pstmt->hdr.handle = hstmt; 
+                dbi_forgetParameterBindings(pstmt);
+            }
+            if (hstmt && pstmt->preparedText)
+                pstmt->prepareCompleted = TRUE;
+            if (!hstmt && (hstmt = dbi_stmtPoolGet(pdbc)))
+            {
+                pstmt->hdr.handle = hstmt; 
+                dbi_forgetParameterBindings(pstmt);
+            }
             if (!hstmt)
             {
                 rc = SQLAllocHandle(SQL_HANDLE_STMT, hdbc, &hstmt);
@@ -446,9 +648,15 @@ dbi_cursorExecute( IIDBI_DBC* pdbc, IIDBI_STMT* pstmt, char *stmnt,
                     break; 
                 }
                 pstmt->hdr.handle = hstmt; 
+                dbi_forgetParameterBindings(pstmt);
             }
             if (!pstmt->prepareCompleted) 
             {
+                /* the handle may still have a cursor open */
+                SQLFreeStmt(hstmt, SQL_CLOSE);
+                if (pstmt->preparedText)
+                    free(pstmt->preparedText);
+                pstmt->preparedText = NULL;
                 DBPRINTF(DBI_TRC_STAT)("Preparing the query %s\n",stmnt);
                 rc = SQLPrepare(hstmt, (SQLCHAR *)stmnt, SQL_NTS);
                 if (rc != SQL_SUCCESS) 
@@ -463,6 +671,7 @@ dbi_cursorExecute( IIDBI_DBC* pdbc, IIDBI_STMT* pstmt, char *stmnt,
                     break; 
                 }
                 pstmt->prepareCompleted = TRUE;
+                pstmt->preparedText = strdup(stmnt);
             }
         }
         if (pstmt->parmCount)
@@ -470,12 +679,37 @@ dbi_cursorExecute( IIDBI_DBC* pdbc, IIDBI_STMT* pstmt, char *stmnt,
         if (return_code != DBI_SQL_SUCCESS)
             break;
 
+        if (pstmt->queryTimeout || pstmt->timeoutSet)
+        {
+            rc = SQLSetStmtAttr(hstmt, SQL_ATTR_QUERY_TIMEOUT, 
+                (SQLPOINTER)pstmt->queryTimeout, 0);
+            if (rc == SQL_ERROR) 
+            {
+                return_code = IIDBI_ERROR( rc, NULL, NULL, hstmt, 
+                    &pstmt->hdr.err );
+                DBPRINTF(DBI_TRC_STAT)
+                    ( "%d = SQLSetStmtAttr SQL_ATTR_QUERY_TIMEOUT (%d) %s %s %x\n",
+                    rc, __LINE__, pstmt->hdr.err.sqlState, 
+                    pstmt->hdr.err.messageText, pstmt->hdr.err.native );
+                break;
+            }
+            pstmt->timeoutSet = pstmt->queryTimeout ? TRUE : FALSE;
+        }
+
         DBPRINTF(DBI_TRC_STAT)("Executing the query %s\n",stmnt);
 
+        dbi_cursorRunning(pstmt, hstmt);
         if (pstmt->prepareCompleted)
             rc = SQLExecute(hstmt);
         else
             rc = SQLExecDirect(hstmt, (SQLCHAR *)stmnt, SQL_NTS);
+        if (pstmt->paramsetSize > 1 && 
+            (rc == SQL_SUCCESS_WITH_INFO || rc == SQL_ERROR))
+        {
+            pstmt->paramsetError = dbi_paramsetError(pstmt);
+            if (pstmt->paramsetError >= 0)
+                rc = SQL_ERROR;
+        }
         if( rc == SQL_NEED_DATA)
         {
             while(rc == SQL_NEED_DATA)
@@ -505,6 +739,15 @@ dbi_cursorExecute( IIDBI_DBC* pdbc, IIDBI_STMT* pstmt, char *stmnt,
                     else
                         putSegmentSize = PUTSEGMENT_SIZE;
 
+                    if (parameter[idx]->putStream)
+                    {
+                        return_code = dbi_putStream(pstmt, 
+                            parameter[idx]->putStream, putSegmentSize);
+                        if (return_code != DBI_SQL_SUCCESS)
+                            break;
+                        continue;
+                    }
+
                     do
                     {
                         int putrc;
@@ -550,6 +793,8 @@ dbi_cursorExecute( IIDBI_DBC* pdbc, IIDBI_STMT* pstmt, char *stmnt,
                     }while (lenCntr);
                 } /* if (rc == SQL_NEED_DATA) from SQLParamData */
             } /* while rc == SQL_NEED_DATA */
+            if (return_code != DBI_SQL_SUCCESS)
+                break;
         }
         if (rc != SQL_SUCCESS) 
         {
@@ -560,7 +805,7 @@ dbi_cursorExecute( IIDBI_DBC* pdbc, IIDBI_STMT* pstmt, char *stmnt,
                 pstmt->hdr.err.messageText, pstmt->hdr.err.native, stmnt );
             break;
         }
-        if ( !isProc && pstmt->parmCount)
+        if ( !isProc && pstmt->parmCount && !pstmt->keepParameters)
         {
             rc = dbi_freeDescriptor(pstmt, 1);
         }
@@ -606,12 +851,106 @@ dbi_cursorExecute( IIDBI_DBC* pdbc, IIDBI_STMT* pstmt, char *stmnt,
         break; 
 
     } /* end for (;;) */
+    dbi_cursorRunning(pstmt, NULL);
 
     DBPRINTF(DBI_TRC_ENTRY)("%p: dbi_cursorExecute }}}1\n", pstmt);
 
     return( return_code );
 }
 
+/*{
+** Name: dbi_cursorCancel - Cancel the query a statement is executing
+**
+** Description:
+**     Calls SQLCancel() on the statement handle if dbi_cursorExecute()
+**     is executing a query on it, presumably in another thread. The
+**     execute then fails as cancelled. A statement not executing is
+**     left alone.
+**
+** Inputs:
+**     pstmt - statement handle.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     DBI_SQL_SUCCESS, or the SQLCancel() error.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+RETCODE
+dbi_cursorCancel( IIDBI_STMT* pstmt )
+{
+    IIDBI_DBC *pdbc = pstmt->pdbc;
+    IIDBI_ERROR err;
+    RETCODE rc = SQL_SUCCESS;
+    int return_code = DBI_SQL_SUCCESS;
+
+    DBPRINTF(DBI_TRC_ENTRY)("%p: dbi_cursorCancel {{{1\n", pstmt);
+
+    if (!pdbc || !pdbc->stmtCacheLock)
+        return DBI_SQL_SUCCESS;
+
+    /* the handle is not given up while running is set */
+    PyThread_acquire_lock(pdbc->stmtCacheLock, WAIT_LOCK);
+    if (pstmt->running)
+    {
+        rc = SQLCancel(pstmt->running);
+        if (!SQL_SUCCEEDED(rc))
+        {
+            /* pstmt->hdr.err belongs to the executing thread */
+            return_code = IIDBI_ERROR( rc, NULL, NULL, pstmt->running, 
+                &err );
+            DBPRINTF(DBI_TRC_STAT)( "%d = SQLCancel (%d) %s %s %x\n",
+                rc, __LINE__, err.sqlState, err.messageText, err.native );
+        }
+    }
+    PyThread_release_lock(pdbc->stmtCacheLock);
+
+    DBPRINTF(DBI_TRC_ENTRY)("%p: dbi_cursorCancel }}}1\n", pstmt);
+    return return_code;
+}
+
+/*{
+** Name: dbi_cursorRunning - Publish the handle executing a query
+**
+** Description:
+**     Sets the handle dbi_cursorCancel() may cancel, NULL once the
+**     execute is over.
+**
+** Inputs:
+**     pstmt - statement handle.
+**     hstmt - ODBC statement handle or NULL.
+**
+** Outputs:
+**     pstmt->running is set.
+**
+** Returns:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static void
+dbi_cursorRunning( IIDBI_STMT *pstmt, SQLHANDLE hstmt )
+{
+    IIDBI_DBC *pdbc = pstmt->pdbc;
+
+    if (!pdbc->stmtCacheLock)
+    {
+        pstmt->running = NULL;
+        return;
+    }
+    PyThread_acquire_lock(pdbc->stmtCacheLock, WAIT_LOCK);
+    pstmt->running = hstmt;
+    PyThread_release_lock(pdbc->stmtCacheLock);
+}
+
 /*{
 ** Name: dbi_cursorFetchone - Fetch one row from a statement
 **
@@ -662,6 +1001,22 @@ dbi_cursorExecute( IIDBI_DBC* pdbc, IIDBI_STMT* pstmt, char *stmnt,
 **    31-Jan-2005 (Ralph.Loen@ca.com)
 **          Allow for terminating character in segments when fetching long 
 **          varchars.
+**    16-Oct-2026 (agent)
+**          Serve rows from the rowset buffer when columns are bound.
+**          Column buffers now live as long as the result set, release the
+**          previous row's LONG segment before fetching the next.
+**    16-Oct-2026 (agent)
+**          Take bound columns from their binding buffer, SQLGetData() is
+**          only called for columns left unbound.
+**    16-Oct-2026 (agent)
+**          Only read the first segment of a streamed LONG column, see
+**          dbi_lobColumn().
+**    16-Oct-2026 (agent)
+**          LONG columns are read by dbi_fetchLong(), which grows the
+**          buffer geometrically instead of by one segment per call. A
+**          failed SQLGetData() on a LONG column is now returned, and
+**          LONG NVARCHAR segments after the first are read as
+**          SQL_C_WCHAR rather than SQL_C_CHAR.
 }*/
 RETCODE
 dbi_cursorFetchone( IIDBI_STMT *pstmt )
@@ -671,13 +1026,15 @@ dbi_cursorFetchone( IIDBI_STMT *pstmt )
     int i, nType;
     SQLINTEGER orind=0;
 #define SEGMENT_SIZE 1000000
-    char *segment = NULL;
-    int count;
-    char* ptr;
-    int newalloc = 0;
     int segment_size = 0;
+    int lobColumn;
 
     DBPRINTF(DBI_TRC_ENTRY)("%p: dbi_cursorFetchone {{{1\n", pstmt);
+    pstmt->rowGeneration++;
+    pstmt->lobColumn = 0;
+    if (pstmt->rowsetBound)
+        return dbi_rowsetFetch(pstmt);
+
     rc = SQLFetch(hstmt);
     if (rc == SQL_NO_DATA)
     {
@@ -694,187 +1051,26 @@ dbi_cursorFetchone( IIDBI_STMT *pstmt )
         else
              pstmt->rowCount++;
 
+        lobColumn = dbi_lobColumn(pstmt);
         for (i = 0; i < pstmt->descCount; i++)
         {
+            if (pstmt->colsBound && pstmt->descriptor[i]->rowsetInd)
+            {
+                dbi_copyBoundColumn(pstmt->descriptor[i], 0);
+                continue;
+            }
+            if (i + 1 == lobColumn)
+            {
+                return_code = dbi_fetchLobHead(pstmt, lobColumn);
+                if (return_code != DBI_SQL_SUCCESS)
+                    return return_code;
+                continue;
+            }
             switch (pstmt->descriptor[i]->type)
             {
             case SQL_WLONGVARCHAR:
-                /*
-                ** Initialization of descriptor and temporaries
-                */
-                count = 0;
-                pstmt->descriptor[i]->data = NULL;
-                pstmt->descriptor[i]->isNull = 0;
-                pstmt->descriptor[i]->precision = 0;
-                pstmt->descriptor[i]->orInd = 0;
-                if (pstmt->outputColumnIndex && (i+1) == 
-                    pstmt->outputColumnIndex)
-                    segment_size = pstmt->outputSegmentSize;
-                else if (pstmt->outputColumnIndex && (i+1) != 
-                    pstmt->outputColumnIndex)
-                    segment_size = SEGMENT_SIZE;
-                else if (pstmt->outputSegmentSize)
-                    segment_size = pstmt->outputSegmentSize;
-                else
-                    segment_size = SEGMENT_SIZE;
-                segment = malloc( segment_size + 1);
-                ptr = segment; 
-                rc = SQLGetData(pstmt->hdr.handle, i+1, SQL_C_WCHAR, 
-                    ptr, segment_size, &orind);
-                if (orind == SQL_NULL_DATA)
-                {
-                    if (segment != NULL)
-                    {
-                        free( segment );
-                    }
-                    pstmt->descriptor[i]->isNull = 1;
-                    rc = SQL_SUCCESS;
-                }
-                else
-                {
-                    while(SQL_SUCCEEDED(rc))
-                    {
-                        /*
-                        ** orind contains length of data left in the driver
-                        ** Not sure that this is correct.
-                        */
-                        if (orind > segment_size)
-                        {
-                            /*
-                            ** We have segment_size in the buffer
-                            */
-                            count += segment_size;                            
-                            /*
-                            ** Add another segment to the buffer
-                            ** include adjustment for null terminator
-                            ** for long varchar.
-                            */
-                            newalloc = count + segment_size + 1;
-                            segment = realloc( segment, newalloc );
-                            ptr = segment + count;
-                            rc = SQLGetData(pstmt->hdr.handle, i+1, SQL_C_CHAR, 
-                                ptr, segment_size, &orind);
-                        }
-                        else
-                        {
-                            count += orind;
-                            break;
-                        }
-                    }
-                    if (SQL_SUCCEEDED(rc))
-                    {
-                        pstmt->descriptor[i]->data = segment;
-                        pstmt->descriptor[i]->precision = count;
-                        pstmt->descriptor[i]->orInd = count;
-                    }
-                }
-                if (!SQL_SUCCEEDED(rc))
-                {
-                    if (segment != NULL)
-                    {
-                        free( segment );
-                    }
-                    return_code = IIDBI_ERROR( rc, NULL, NULL, 
-                        hstmt, &pstmt->hdr.err );
-                }
-                break;
-
-
             case SQL_LONGVARCHAR:
-                /*
-                ** Initialization of descriptor and temporaries
-                */
-                count = 0;
-                pstmt->descriptor[i]->data = NULL;
-                pstmt->descriptor[i]->isNull = 0;
-                pstmt->descriptor[i]->precision = 0;
-                pstmt->descriptor[i]->orInd = 0;
-                if (pstmt->outputColumnIndex && (i+1) == 
-                    pstmt->outputColumnIndex)
-                    segment_size = pstmt->outputSegmentSize;
-                else if (pstmt->outputColumnIndex && (i+1) != 
-                    pstmt->outputColumnIndex)
-                    segment_size = SEGMENT_SIZE;
-                else if (pstmt->outputSegmentSize)
-                    segment_size = pstmt->outputSegmentSize;
-                else
-                    segment_size = SEGMENT_SIZE;
-                segment = malloc( segment_size + 1);
-                ptr = segment; 
-                rc = SQLGetData(pstmt->hdr.handle, i+1, SQL_C_CHAR, 
-                    ptr, segment_size, &orind);
-                if (orind == SQL_NULL_DATA)
-                {
-                    if (segment != NULL)
-                    {
-                        free( segment );
-                    }
-                    pstmt->descriptor[i]->isNull = 1;
-                    rc = SQL_SUCCESS;
-                }
-                else if (rc == SQL_SUCCESS)
-                {
-                    pstmt->descriptor[i]->data = segment;
-                    pstmt->descriptor[i]->precision = orind;
-                    pstmt->descriptor[i]->orInd = orind;
-                }
-                else
-                {
-                    while(SQL_SUCCEEDED(rc))
-                    {
-                        /*
-                        ** Orind contains length of data left in the driver.
-                        */
-                        if (orind >= segment_size)
-                        {
-                            /*
-                            ** We have segment_size in the buffer
-                            */
-                            count += segment_size - 1;                            
-                            /*
-                            ** Add another segment to the buffer
-                            ** include adjustment for null terminator
-                            ** for long varchar.
-                            */
-                            newalloc = count + segment_size;
-                            segment = realloc( segment, newalloc );
-                            ptr = segment + count;
-                            rc = SQLGetData(pstmt->hdr.handle, i+1, SQL_C_CHAR, 
-                                ptr, segment_size, &orind);
-                        }
-                        else
-                        {
-                            count += orind;
-                            break;
-                        }
-                    }
-                    if (SQL_SUCCEEDED(rc))
-                    {
-                        pstmt->descriptor[i]->data = segment;
-                        pstmt->descriptor[i]->precision = count;
-                        pstmt->descriptor[i]->orInd = count;
-                    }
-                }
-                if (!SQL_SUCCEEDED(rc))
-                {
-                    if (segment != NULL)
-                    {
-                        free( segment );
-                    }
-                    return_code = IIDBI_ERROR( rc, NULL, NULL, 
-                        hstmt, &pstmt->hdr.err );
-                }
-                break;
-
             case SQL_LONGVARBINARY:
-                /*
-                ** Initialization of descriptor and temporaries
-                */
-                count = 0;
-                pstmt->descriptor[i]->data = NULL;
-                pstmt->descriptor[i]->isNull = 0;
-                pstmt->descriptor[i]->precision = 0;
-                pstmt->descriptor[i]->orInd = 0;
                 if (pstmt->outputColumnIndex && (i+1) == 
                     pstmt->outputColumnIndex)
                     segment_size = pstmt->outputSegmentSize;
@@ -885,66 +1081,9 @@ dbi_cursorFetchone( IIDBI_STMT *pstmt )
                     segment_size = pstmt->outputSegmentSize;
                 else
                     segment_size = SEGMENT_SIZE;
-                segment = malloc( segment_size + 1);
-                ptr = segment; 
-                rc = SQLGetData(pstmt->hdr.handle, i+1, SQL_C_BINARY, 
-                    ptr, segment_size, &orind);
-                if (orind == SQL_NULL_DATA)
-                {
-                    if (segment != NULL)
-                    {
-                        free( segment );
-                    }
-                    pstmt->descriptor[i]->isNull = 1;
-                    rc = SQL_SUCCESS;
-                }
-                else
-                {
-                    while(SQL_SUCCEEDED(rc))
-                    {
-                        /*
-                        ** orind contains length of data left in the driver
-                        ** Not sure that this is correct.
-                        */
-                        if (orind > segment_size)
-                        {
-                            /*
-                            ** We have segment_size in the buffer
-                            */
-                            count += segment_size;                            
-                            /*
-                            ** Add another segment to the buffer
-                            ** include adjustment for null terminator
-                            ** for long varchar.
-                            */
-                            newalloc = count + segment_size + 1;
-                            segment = realloc( segment, newalloc );
-                            ptr = segment + count;
-                            rc = SQLGetData(pstmt->hdr.handle, i+1,
-                                SQL_C_BINARY, ptr, segment_size, &orind);
-                        }
-                        else
-                        {
-                            count += orind;
-                            break;
-                        }
-                    }
-                    if (SQL_SUCCEEDED(rc))
-                    {
-                        pstmt->descriptor[i]->data = segment;
-                        pstmt->descriptor[i]->precision = count;
-                        pstmt->descriptor[i]->orInd = count;
-                    }
-                }
-                if (!SQL_SUCCEEDED(rc))
-                {
-                    if (segment != NULL)
-                    {
-                        free( segment );
-                    }
-                    return_code = IIDBI_ERROR( rc, NULL, NULL, 
-                        hstmt, &pstmt->hdr.err );
-                }
+                return_code = dbi_fetchLong(pstmt, i, segment_size);
+                if (return_code != DBI_SQL_SUCCESS)
+                    return return_code;
                 break;
 
             case SQL_FLOAT:
@@ -976,11 +1115,6 @@ dbi_cursorFetchone( IIDBI_STMT *pstmt )
                             rc, __LINE__, pstmt->hdr.err.sqlState, 
                             pstmt->hdr.err.messageText, 
                             pstmt->hdr.err.native);
-                    if (segment)
-                    {
-                        free(segment);
-                        segment = 0;
-                    }
                     return return_code;
                 }
                 break;
@@ -1309,6 +1443,20 @@ IIDBI_DESCRIPTOR *dbi_getDescriptor ( IIDBI_STMT *pstmt, int colNbr,
 **     17-Jul-2004 (komve01@ca.com)
 **         Fixed dbi_freeDescriptor. Clean parameter if isParam is one.
 **         else clean descriptor block.
+**     16-Oct-2026 (agent)
+**         Unbind columns and release rowset buffers.
+**     16-Oct-2026 (agent)
+**         Tolerate a column count without a descriptor array (executemany
+**         of a row returning statement never allocates one).
+**     16-Oct-2026 (agent)
+**         Unbind and release parameter arrays.
+**     16-Oct-2026 (agent)
+**         Release parameter streams.
+**     16-Oct-2026 (agent)
+**         Leave borrowed parameter arrays to their owner.
+**     16-Oct-2026 (agent)
+**         Parameter descriptors and the values in their slots belong to
+**         the parameter arena.
 }*/
 
 RETCODE dbi_freeDescriptor(IIDBI_STMT *pstmt, unsigned char isParam)
@@ -1322,6 +1470,7 @@ RETCODE dbi_freeDescriptor(IIDBI_STMT *pstmt, unsigned char isParam)
 
     if (isParam)
     {
+        dbi_unbindParameterArrays(pstmt);
         if (!pstmt->parmCount)
             return DBI_SQL_SUCCESS;
     
@@ -1338,7 +1487,8 @@ RETCODE dbi_freeDescriptor(IIDBI_STMT *pstmt, unsigned char isParam)
             ** PyBufferFromObject(), we rely on Python to free the
             ** memory for the data.  Same for ASCII and Unicode.
             */
-            if (pstmt->parameter[i]->data)
+            if (pstmt->parameter[i]->data &&
+                pstmt->parameter[i]->data != pstmt->parameter[i]->slot)
             {
                 switch (pstmt->parameter[i]->type)
                 {
@@ -1356,23 +1506,32 @@ RETCODE dbi_freeDescriptor(IIDBI_STMT *pstmt, unsigned char isParam)
                         break;
                 }
             }
-            free (pstmt->parameter[i]);             
+            if (pstmt->parameter[i]->rowsetData &&
+                !pstmt->parameter[i]->rowsetBorrowed)
+                free(pstmt->parameter[i]->rowsetData);
+            if (pstmt->parameter[i]->rowsetInd)
+                free(pstmt->parameter[i]->rowsetInd);
+            if (pstmt->parameter[i]->putStream)
+                pstmt->parameter[i]->putStream->release(
+                    pstmt->parameter[i]->putStream);
         }
-        free(pstmt->parameter);                        
+        /* the descriptors stay in the arena for the next execute */
         pstmt->parameter = 0;
         pstmt->parmCount = 0;
         pstmt->rowCount = -1;
     }
     else
     {
+        dbi_unbindColumns(pstmt);
         dbi_freeData(pstmt);
-        for (i = 0; i < pstmt->descCount; i++) 
+        for (i = 0; pstmt->descriptor && i < pstmt->descCount; i++) 
         {
 			DBPRINTF(DBI_TRC_STAT)("Freeing descriptor[%i]\n", i);
 	    free(pstmt->descriptor[i]->columnName);
             free (pstmt->descriptor[i]);
 	}
-        free(pstmt->descriptor);                        
+        if (pstmt->descriptor)
+            free(pstmt->descriptor);                        
         pstmt->descriptor = 0;
         pstmt->descCount = 0;
         pstmt->rowCount = -1;
@@ -1402,6 +1561,13 @@ RETCODE dbi_freeDescriptor(IIDBI_STMT *pstmt, unsigned char isParam)
 ** History:
 **     15-Jul-2004 (loera01@ca.com)
 **         Created.
+**     16-Oct-2026 (agent)
+**         Clear the descriptor pointer and count after a failed
+**         allocation so a later dbi_freeDescriptor() does not free them
+**         again.
+**     16-Oct-2026 (agent)
+**         Take parameter descriptors from the parameter arena, see
+**         dbi_paramArenaAlloc().
 }*/
 
 RETCODE 
@@ -1420,30 +1586,14 @@ dbi_allocDescriptor(IIDBI_STMT *pstmt, int numCols, unsigned char isParam )
 
      if (isParam)
      {
-         pstmt->parmCount = numCols;
-    
-         pstmt->parameter = calloc(1,sizeof(IIDBI_DESCRIPTOR *) * numCols);
-         if (!pstmt->parameter)
+         /* parameter descriptors live in the statement's arena */
+         if (dbi_paramArenaAlloc(pstmt, numCols) != DBI_SQL_SUCCESS)
          {
              pstmt->parameter = 0;
+             pstmt->parmCount = 0;
              return DBI_INTERNAL_ERROR;
          }
-         for (i = 0; i < pstmt->parmCount; i++)
-         {
-             pstmt->parameter[i] = calloc(1,sizeof(IIDBI_DESCRIPTOR));
-             if (!pstmt->parameter[i])
-             {
-                 int k;
-                 for (k=0; k <= i; k++)
-                 {
-                     if (pstmt->parameter[k])
-                         free (pstmt->parameter[k]);  
-                 }
-                 free(pstmt->parameter);                        
-                 return_code = DBI_INTERNAL_ERROR;
-                 break;
-             }
-         }
+         pstmt->parmCount = numCols;
      } 
      else
      {
@@ -1468,6 +1618,8 @@ dbi_allocDescriptor(IIDBI_STMT *pstmt, int numCols, unsigned char isParam )
                         free (pstmt->descriptor[k]);  
                 }
                 free(pstmt->descriptor);                        
+                pstmt->descriptor = 0;
+                pstmt->descCount = 0;
                 return_code = DBI_INTERNAL_ERROR;
                 break;
             }
@@ -1477,6 +1629,108 @@ dbi_allocDescriptor(IIDBI_STMT *pstmt, int numCols, unsigned char isParam )
     return return_code;
 }
 
+/*{
+** Name: dbi_paramArenaAlloc - Take parameter descriptors from the arena
+**
+** Description:
+**     The parameter arena of a statement holds, for up to
+**     paramArenaCount parameters, the parameter descriptor array, the
+**     descriptors and a slot of IIDBI_PARAM_SLOT_SIZE bytes per
+**     parameter. The slot holds the value of a fixed size or Decimal
+**     parameter, so binding one allocates nothing. The arena is only
+**     reallocated when a statement has more parameters than it holds,
+**     the previous descriptors must have been freed by then.
+**
+** Inputs:
+**     pstmt - statement handle.
+**     numCols - number of parameters.
+**
+** Outputs:
+**     pstmt->parameter - numCols cleared descriptors, each with its slot.
+**
+** Returns:
+**     DBI_SQL_SUCCESS
+**     DBI_INTERNAL_ERROR if the arena could not be allocated.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static RETCODE
+dbi_paramArenaAlloc( IIDBI_STMT *pstmt, int numCols )
+{
+    IIDBI_DESCRIPTOR *desc;
+    char *slot;
+    int i;
+
+    if (numCols > pstmt->paramArenaCount)
+    {
+        if (pstmt->paramArena)
+            free(pstmt->paramArena);
+        pstmt->paramArena = malloc(numCols * (sizeof(IIDBI_DESCRIPTOR *) +
+            sizeof(IIDBI_DESCRIPTOR) + IIDBI_PARAM_SLOT_SIZE));
+        if (!pstmt->paramArena)
+        {
+            pstmt->paramArenaCount = 0;
+            return DBI_INTERNAL_ERROR;
+        }
+        pstmt->paramArenaCount = numCols;
+        DBPRINTF(DBI_TRC_STAT)("%p: parameter arena for %d parameters\n",
+            pstmt, numCols);
+    }
+
+    pstmt->parameter = (IIDBI_DESCRIPTOR **)pstmt->paramArena;
+    desc = (IIDBI_DESCRIPTOR *)(pstmt->parameter + pstmt->paramArenaCount);
+    slot = (char *)(desc + pstmt->paramArenaCount);
+    memset(desc, 0, numCols * sizeof(IIDBI_DESCRIPTOR));
+    for (i = 0; i < numCols; i++)
+    {
+        desc[i].slot = slot + i * IIDBI_PARAM_SLOT_SIZE;
+        pstmt->parameter[i] = &desc[i];
+    }
+    return DBI_SQL_SUCCESS;
+}
+
+/*{
+** Name: dbi_paramArenaFree - Free the parameter arena
+**
+** Description:
+**     Frees the parameter arena of a statement about to be freed. Any
+**     parameter descriptors still pointing into the arena must not be
+**     used afterwards.
+**
+** Inputs:
+**     pstmt - statement handle.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+**     16-Oct-2026 (agent)
+**         Free the wide character parameter buffer too.
+**     17-Oct-2026 (agent)
+**         Also called when the parameter descriptors could not be freed.
+}*/
+
+void
+dbi_paramArenaFree( IIDBI_STMT *pstmt )
+{
+    if (pstmt->paramArena)
+        free(pstmt->paramArena);
+    pstmt->paramArena = NULL;
+    pstmt->paramArenaCount = 0;
+    if (pstmt->wideBuffer)
+        free(pstmt->wideBuffer);
+    pstmt->wideBuffer = NULL;
+    pstmt->wideBufferSize = 0;
+}
+
 /*{
 ** Name: dbi_allocData - Allocate data in tuple descriptor
 **
@@ -1500,6 +1754,13 @@ dbi_allocDescriptor(IIDBI_STMT *pstmt, int numCols, unsigned char isParam )
 **         Created.
 **      16-Jul-2004 (raymond.fan@ca.com)
 **          Use precision value for sizeof data.
+**      16-Oct-2026 (agent)
+**          Allocate at least bindSize bytes, the size of the C type the
+**          column is fetched as (e.g. REAL columns are fetched as doubles).
+**      16-Oct-2026 (agent)
+**          Called once per result set, buffers are kept until the
+**          descriptor is freed. Columns that already have a buffer are
+**          skipped, on failure all buffers are released.
 }*/
 RETCODE
 dbi_allocData ( IIDBI_STMT *pstmt)
@@ -1513,36 +1774,35 @@ dbi_allocData ( IIDBI_STMT *pstmt)
      if (!pstmt)
          return DBI_INTERNAL_ERROR;
 
-         if (!pstmt->descCount)
-             return DBI_SQL_SUCCESS;
+     if (!pstmt->descCount)
+         return DBI_SQL_SUCCESS;
     
-         for (i = 0; i < pstmt->descCount; i++)
+     for (i = 0; i < pstmt->descCount; i++)
+     {
+         dataLen = pstmt->descriptor[i]->internalSize;
+         if (pstmt->descriptor[i]->bindSize > dataLen)
+             dataLen = (int)pstmt->descriptor[i]->bindSize;
+         switch (pstmt->descriptor[i]->type)
          {
-	     dataLen = pstmt->descriptor[i]->internalSize;
-             switch (pstmt->descriptor[i]->type)
-             {
-             case SQL_LONGVARCHAR:
-             case SQL_LONGVARBINARY:
-             case SQL_WLONGVARCHAR:
-                 pstmt->descriptor[i]->data = NULL;
-                 break;
+         case SQL_LONGVARCHAR:
+         case SQL_LONGVARBINARY:
+         case SQL_WLONGVARCHAR:
+             break;
     
-             default:
-                 pstmt->descriptor[i]->data = 
-                     calloc(1, dataLen);
-                 if (!pstmt->descriptor[i]->data)
-                 {
-                     int k=i;
-                     return_code = DBI_INTERNAL_ERROR;
-                     for (i=0; i <= k; i++)
-                     {
-                         if (pstmt->descriptor[i]->data)
-                             free (pstmt->descriptor[i]->data);  
-                     }
-                 }
+         default:
+             if (pstmt->descriptor[i]->data)
                  break;
+             pstmt->descriptor[i]->data = calloc(1, dataLen);
+             if (!pstmt->descriptor[i]->data)
+             {
+                 dbi_freeData(pstmt);
+                 return_code = DBI_INTERNAL_ERROR;
              }
+             break;
          }
+         if (return_code != DBI_SQL_SUCCESS)
+             break;
+     }
      DBPRINTF(DBI_TRC_ENTRY)("%p: dbi_allocData }}}1\n", pstmt);
      return return_code;
 }
@@ -1569,6 +1829,8 @@ dbi_allocData ( IIDBI_STMT *pstmt)
 ** History:
 **     07-Jan-2005 (loera01@ca.com)
 **         Created.
+**     16-Oct-2026 (agent)
+**         Release LONG values no row has taken.
 }*/
 RETCODE
 dbi_freeData ( IIDBI_STMT *pstmt)
@@ -1588,6 +1850,7 @@ dbi_freeData ( IIDBI_STMT *pstmt)
 
      for (i = 0; i < pstmt->descCount; i++)
      {
+         dbi_lobRelease(pstmt->descriptor[i]);
          if (pstmt->descriptor[i]->data)
          {
              if (pstmt->descriptor[i]->data)
@@ -1635,6 +1898,14 @@ dbi_freeData ( IIDBI_STMT *pstmt)
 **          Added support for long type parameters
 **      22-Jul-2004 (komve01@ca.com)
 **          Fixed BIGINT conversion.
+**      16-Oct-2026 (agent)
+**          Hand parameter arrays to dbi_bindParameterArrays().
+**      16-Oct-2026 (agent)
+**          With pstmt->keepParameters set, only refresh the indicator of
+**          parameters that are still bound.
+**      16-Oct-2026 (agent)
+**          Bind a LONG VARBINARY parameter with a putStream as
+**          SQL_DATA_AT_EXEC, its length is not known up front.
 }*/
 RETCODE
 BindParameters(IIDBI_STMT *pstmt, unsigned char isProc)
@@ -1661,10 +1932,18 @@ BindParameters(IIDBI_STMT *pstmt, unsigned char isProc)
     if (!pstmt->parameter)
         return DBI_INTERNAL_ERROR;
 
+    if (pstmt->paramsetSize > 1)
+        return dbi_bindParameterArrays(pstmt);
+
     pdesc = pstmt->parameter;
 
     for (i = 0; i < pstmt->parmCount; i++)
     {
+        if (pstmt->keepParameters && pdesc[i]->isBound)
+        {
+            dbi_paramIndicator(pdesc[i]);
+            continue;
+        }
         type = pstmt->parameter[i]->type;
         data = pstmt->parameter[i]->data;
         precision = pstmt->parameter[i]->precision;
@@ -1687,6 +1966,8 @@ BindParameters(IIDBI_STMT *pstmt, unsigned char isProc)
         case SQL_LONGVARBINARY:
             if (isNull)
                 *orind = SQL_NULL_DATA;
+            else if (pstmt->parameter[i]->putStream)
+                *orind = SQL_DATA_AT_EXEC;
             else if (precision > 0)
                 *orind = SQL_LEN_DATA_AT_EXEC((SQLINTEGER)precision);
             else 
@@ -1908,6 +2189,7 @@ BindParameters(IIDBI_STMT *pstmt, unsigned char isProc)
             }
             break; 
         }
+        pdesc[i]->isBound = TRUE;
     }
     DBPRINTF(DBI_TRC_ENTRY)("%p: End BindParameters\n", pstmt);
     return DBI_SQL_SUCCESS;
@@ -1926,6 +2208,7 @@ RETCODE dbi_describeColumns (IIDBI_STMT *pstmt)
     SQLINTEGER displaySize; 
     SQLUINTEGER precision;  
     int cType;
+    SQLSMALLINT bindType;
 
     numCols = pstmt->descCount;
 
@@ -2028,6 +2311,1857 @@ RETCODE dbi_describeColumns (IIDBI_STMT *pstmt)
          pstmt->descriptor[i]->displaySize = displaySize;
          pstmt->descriptor[i]->internalSize = internalSize;
          pstmt->descriptor[i]->cType = cType;
+         pstmt->descriptor[i]->bindSize = 
+             dbi_columnBinding(pstmt->descriptor[i], &bindType);
      }
      return DBI_SQL_SUCCESS;
 }
+
+/*{
+** Name: dbi_columnBinding - Get the C type and size used to fetch a column
+**
+** Description:
+**     Mirrors the conversions made in dbi_cursorFetchone(), returning the
+**     ODBC C type a result column is fetched as and the number of bytes
+**     needed to hold one value. LONG columns have no bounded size.
+**
+** Inputs:
+**     desc - column descriptor set up by dbi_describeColumns().
+**
+** Outputs:
+**     cType - ODBC C type for SQLGetData()/SQLBindCol().
+**
+** Returns:
+**     Size in bytes of one value, 0 for LONG columns.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static SQLLEN
+dbi_columnBinding(IIDBI_DESCRIPTOR *desc, SQLSMALLINT *cType)
+{
+    SQLLEN size = desc->internalSize;
+
+    switch (desc->type)
+    {
+    case SQL_LONGVARCHAR:
+    case SQL_LONGVARBINARY:
+    case SQL_WLONGVARCHAR:
+        *cType = SQL_C_CHAR;
+        size = 0;
+        break;
+
+    case SQL_FLOAT:
+    case SQL_REAL:
+    case SQL_DOUBLE:
+        *cType = SQL_C_DOUBLE;
+        size = sizeof(SQLDOUBLE);
+        break;
+
+    case SQL_BIGINT:
+        *cType = SQL_C_SBIGINT;
+        size = sizeof(ODBCINT64);
+        break;
+
+    case SQL_INTEGER:
+        *cType = SQL_C_LONG;
+        size = sizeof(SQLINTEGER);
+        break;
+
+    case SQL_TINYINT:
+        *cType = SQL_C_TINYINT;
+        size = sizeof(SQLCHAR);
+        break;
+
+    case SQL_BIT:
+        *cType = SQL_C_BIT;
+        size = sizeof(SQLCHAR);
+        break;
+
+    case SQL_SMALLINT:
+        *cType = SQL_C_SHORT;
+        size = sizeof(SQLSMALLINT);
+        break;
+
+    case SQL_TYPE_DATE:
+    case SQL_TYPE_TIME:
+    case SQL_TYPE_TIMESTAMP:
+        *cType = SQL_C_TIMESTAMP;
+        size = sizeof(SQL_TIMESTAMP_STRUCT);
+        break;
+
+    case SQL_DECIMAL:
+    case SQL_WVARCHAR:
+    case SQL_WCHAR:
+    case SQL_CHAR:
+    case SQL_VARCHAR:
+        *cType = desc->cType;
+        break;
+
+    default:
+        *cType = SQL_C_CHAR;
+        if (size < desc->precision + 1)
+            size = desc->precision + 1;
+        break;
+    }
+    return size;
+}
+
+/*{
+** Name: dbi_bindColumns - Bind result columns for block fetches
+**
+** Description:
+**     If the requested rowset size (pstmt->arraySize) is greater than one
+**     and every column has a bounded size, bind each column column-wise
+**     with SQLBindCol() into a buffer holding a full rowset, and set
+**     SQL_ATTR_ROW_ARRAY_SIZE so that each SQLFetch() returns up to
+**     arraySize rows. Result sets containing LONG columns are left
+**     unbound and fetched a row at a time with SQLGetData().
+**
+**     A driver that refuses the rowset size is not treated as an error,
+**     the cursor simply falls back to single row fetches.
+**
+**     Without block fetches the columns of bounded size are bound for
+**     single row fetches, leaving only LONG columns to SQLGetData().
+**     Unless the driver supports SQL_GD_ANY_COLUMN, only the columns
+**     before the first LONG column are bound.
+**
+** Inputs:
+**     pstmt - statement with described columns.
+**
+** Outputs:
+**     pstmt->rowsetBound is set if the block fetch path is in use,
+**     pstmt->colsBound if columns are bound for single row fetches.
+**
+** Returns:
+**     DBI_SQL_SUCCESS
+**     DBI_SQL_ERROR
+**     DBI_INTERNAL_ERROR
+**
+** Side Effects:
+**     Allocates rowsetData and rowsetInd for each column descriptor.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+**     16-Oct-2026 (agent)
+**         Bind bounded columns for single row fetches when the block
+**         fetch path is not used.
+**     16-Oct-2026 (agent)
+**         Start the prefetch worker when pstmt->prefetch is set.
+}*/
+
+RETCODE
+dbi_bindColumns( IIDBI_STMT *pstmt )
+{
+    HSTMT hstmt;
+    RETCODE rc;
+    int return_code = DBI_SQL_SUCCESS;
+    int i;
+    SQLSMALLINT cType;
+    SQLULEN rowsetSize = 0;
+    IIDBI_DESCRIPTOR *desc;
+    int anyColumn;
+
+    DBPRINTF(DBI_TRC_ENTRY)("%p: dbi_bindColumns {{{1\n", pstmt);
+
+    if (!pstmt || !pstmt->hdr.handle || !pstmt->descriptor)
+        return DBI_INTERNAL_ERROR;
+
+    hstmt = pstmt->hdr.handle;
+    if (pstmt->colsBound)
+        dbi_unbindColumns(pstmt);
+    pstmt->rowsetBound = FALSE;
+    pstmt->rowsetSize = 1;
+    pstmt->rowsetIndex = 0;
+    pstmt->rowsFetched = 0;
+
+    if (pstmt->arraySize <= 1)
+        goto bindSingleRow;
+
+    for (i = 0; i < pstmt->descCount; i++)
+    {
+        if (!pstmt->descriptor[i]->bindSize)
+        {
+            DBPRINTF(DBI_TRC_STAT)("%p: column %d is a LONG type, no block fetch\n",
+                pstmt, i+1);
+            goto bindSingleRow;
+        }
+    }
+
+    rc = SQLSetStmtAttr(hstmt, SQL_ATTR_ROW_BIND_TYPE, 
+        (SQLPOINTER)SQL_BIND_BY_COLUMN, 0);
+    if (SQL_SUCCEEDED(rc))
+        rc = SQLSetStmtAttr(hstmt, SQL_ATTR_ROW_ARRAY_SIZE, 
+            (SQLPOINTER)(SQLULEN)pstmt->arraySize, 0);
+    if (SQL_SUCCEEDED(rc))
+        rc = SQLGetStmtAttr(hstmt, SQL_ATTR_ROW_ARRAY_SIZE, &rowsetSize, 
+            0, NULL);
+    if (!SQL_SUCCEEDED(rc) || rowsetSize <= 1)
+    {
+        DBPRINTF(DBI_TRC_STAT)("%p: %d = rowset size %d refused, no block fetch\n",
+            pstmt, rc, pstmt->arraySize);
+        SQLSetStmtAttr(hstmt, SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER)1, 0);
+        goto bindSingleRow;
+    }
+    pstmt->rowsetSize = (int)rowsetSize;
+
+    rc = SQLSetStmtAttr(hstmt, SQL_ATTR_ROWS_FETCHED_PTR, 
+        &pstmt->rowsFetched, 0);
+    if (!SQL_SUCCEEDED(rc))
+    {
+        return_code = IIDBI_ERROR( rc, NULL, NULL, hstmt, &pstmt->hdr.err );
+        DBPRINTF(DBI_TRC_STAT)
+            ( "%d = dbi_bindColumns (%d) %s %s %x\n",
+            rc, __LINE__, pstmt->hdr.err.sqlState, 
+            pstmt->hdr.err.messageText, pstmt->hdr.err.native );
+        goto errorBindColumns;
+    }
+    pstmt->rowsetBound = TRUE;
+
+    for (i = 0; i < pstmt->descCount; i++)
+    {
+        desc = pstmt->descriptor[i];
+        dbi_columnBinding(desc, &cType);
+        desc->rowsetData = malloc(desc->bindSize * pstmt->rowsetSize);
+        desc->rowsetInd = malloc(sizeof(SQLLEN) * pstmt->rowsetSize);
+        if (!desc->rowsetData || !desc->rowsetInd)
+        {
+            return_code = DBI_INTERNAL_ERROR;
+            goto errorBindColumns;
+        }
+        rc = SQLBindCol(hstmt, i+1, cType, desc->rowsetData, desc->bindSize,
+            desc->rowsetInd);
+        if (!SQL_SUCCEEDED(rc))
+        {
+            return_code = IIDBI_ERROR( rc, NULL, NULL, hstmt, 
+                &pstmt->hdr.err );
+            DBPRINTF(DBI_TRC_STAT)
+                ( "%d = SQLBindCol (%d) %s %s %x\n",
+                rc, __LINE__, pstmt->hdr.err.sqlState, 
+                pstmt->hdr.err.messageText, pstmt->hdr.err.native );
+            goto errorBindColumns;
+        }
+    }
+    DBPRINTF(DBI_TRC_STAT)("%p: bound %d columns, rowset size %d\n",
+        pstmt, pstmt->descCount, pstmt->rowsetSize);
+    if (pstmt->prefetch && dbi_prefetchStart(pstmt) != DBI_SQL_SUCCESS)
+    {
+        /* not fatal, the rowsets are fetched by the caller */
+        DBPRINTF(DBI_TRC_STAT)("%p: no prefetch worker\n", pstmt);
+    }
+    goto exitBindColumns;
+
+bindSingleRow:
+    anyColumn = dbi_getDataAnyColumn(pstmt);
+    for (i = 0; i < pstmt->descCount; i++)
+    {
+        desc = pstmt->descriptor[i];
+        if (!desc->bindSize)
+        {
+            if (!anyColumn)
+                break;
+            continue;
+        }
+        dbi_columnBinding(desc, &cType);
+        desc->rowsetData = malloc(desc->bindSize);
+        desc->rowsetInd = malloc(sizeof(SQLLEN));
+        pstmt->colsBound = TRUE;
+        if (!desc->rowsetData || !desc->rowsetInd)
+        {
+            return_code = DBI_INTERNAL_ERROR;
+            goto errorBindColumns;
+        }
+        rc = SQLBindCol(hstmt, i+1, cType, desc->rowsetData, desc->bindSize,
+            desc->rowsetInd);
+        if (!SQL_SUCCEEDED(rc))
+        {
+            /* not fatal, the columns are read with SQLGetData() */
+            DBPRINTF(DBI_TRC_STAT)("%p: %d = SQLBindCol column %d, no binding\n",
+                pstmt, rc, i+1);
+            dbi_unbindColumns(pstmt);
+            break;
+        }
+    }
+    DBPRINTF(DBI_TRC_STAT)("%p: bound %d of %d columns for single row fetches\n",
+        pstmt, pstmt->colsBound ? i : 0, pstmt->descCount);
+
+exitBindColumns:
+    DBPRINTF(DBI_TRC_ENTRY)("%p: dbi_bindColumns }}}1\n", pstmt);
+    return return_code;
+
+errorBindColumns:
+    pstmt->rowsetBound = TRUE; /* force unbind of anything done so far */
+    dbi_unbindColumns(pstmt);
+    DBPRINTF(DBI_TRC_ENTRY)("%p: dbi_bindColumns }}}1\n", pstmt);
+    return return_code;
+}
+
+/*{
+** Name: dbi_unbindColumns - Undo dbi_bindColumns()
+**
+** Description:
+**     Unbinds the result columns, restores single row fetches on the
+**     statement handle (which may be reused when prepared) and frees the
+**     rowset buffers. Also used for columns bound for single row
+**     fetches.
+**
+** Inputs:
+**     pstmt - pointer to DBI statement structure.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+**     16-Oct-2026 (agent)
+**         Stop the prefetch worker.
+}*/
+
+static void
+dbi_unbindColumns( IIDBI_STMT *pstmt )
+{
+    int i;
+    HSTMT hstmt = pstmt->hdr.handle;
+
+    dbi_prefetchStop(pstmt);
+    if (pstmt->rowsetBound && hstmt)
+    {
+        SQLFreeStmt(hstmt, SQL_UNBIND);
+        SQLSetStmtAttr(hstmt, SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER)1, 0);
+        SQLSetStmtAttr(hstmt, SQL_ATTR_ROWS_FETCHED_PTR, NULL, 0);
+    }
+    else if (pstmt->colsBound && hstmt)
+        SQLFreeStmt(hstmt, SQL_UNBIND);
+    pstmt->rowsetBound = FALSE;
+    pstmt->colsBound = FALSE;
+    pstmt->rowsetSize = 1;
+    pstmt->rowsetIndex = 0;
+    pstmt->rowsFetched = 0;
+
+    if (!pstmt->descriptor)
+        return;
+
+    for (i = 0; i < pstmt->descCount; i++)
+    {
+        if (!pstmt->descriptor[i])
+            continue;
+        if (pstmt->descriptor[i]->rowsetData)
+            free(pstmt->descriptor[i]->rowsetData);
+        if (pstmt->descriptor[i]->rowsetInd)
+            free(pstmt->descriptor[i]->rowsetInd);
+        pstmt->descriptor[i]->rowsetData = NULL;
+        pstmt->descriptor[i]->rowsetInd = NULL;
+    }
+}
+
+/*{
+** Name: dbi_rowsetFetch - Fetch one row using the bound rowset
+**
+** Description:
+**     Hands out the next row of the current rowset, calling SQLFetch()
+**     for a new rowset when the current one has been consumed. The row
+**     is copied into the descriptor data buffers so callers see the same
+**     layout as with SQLGetData().
+**
+** Inputs:
+**     pstmt - statement with columns bound by dbi_bindColumns().
+**
+** Outputs:
+**     descriptor data, isNull and orInd for each column.
+**
+** Returns:
+**     DBI_SQL_SUCCESS
+**     DBI_SQL_NO_DATA
+**     DBI_SQL_ERROR
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+**     16-Oct-2026 (agent)
+**         Take the rowset from the prefetch worker when there is one.
+}*/
+
+static RETCODE
+dbi_rowsetFetch( IIDBI_STMT *pstmt )
+{
+    RETCODE rc;
+    int return_code;
+    HSTMT hstmt = pstmt->hdr.handle;
+    int i;
+
+    if (pstmt->rowsetIndex >= (int)pstmt->rowsFetched)
+    {
+        pstmt->rowsetIndex = 0;
+        pstmt->rowsFetched = 0;
+        if (pstmt->prefetcher)
+            rc = dbi_prefetchNext(pstmt);
+        else
+            rc = SQLFetch(hstmt);
+        if (rc == SQL_NO_DATA || (SQL_SUCCEEDED(rc) && !pstmt->rowsFetched))
+        {
+            pstmt->fetchDone = TRUE;
+            DBPRINTF(DBI_TRC_ENTRY)("%p: dbi_cursorFetchone }}}1\n", pstmt);
+            return DBI_SQL_NO_DATA;
+        }
+        pstmt->fetchDone = FALSE;
+        if (!SQL_SUCCEEDED(rc))
+        {
+            return_code = IIDBI_ERROR( rc, NULL, NULL, hstmt, &pstmt->hdr.err );
+            DBPRINTF(DBI_TRC_STAT) ( "%p: %d = dbi_cursorFetchone (%d) %s %s %x\n\n", 
+                pstmt, rc, __LINE__, pstmt->hdr.err.sqlState, 
+                pstmt->hdr.err.messageText, pstmt->hdr.err.native);
+            return return_code;
+        }
+        DBPRINTF(DBI_TRC_STAT)("%p: fetched rowset of %d rows\n", pstmt,
+            (int)pstmt->rowsFetched);
+    }
+
+    for (i = 0; i < pstmt->descCount; i++)
+        dbi_copyBoundColumn(pstmt->descriptor[i], pstmt->rowsetIndex);
+    pstmt->rowsetIndex++;
+
+    if (pstmt->rowCount == -1)
+         pstmt->rowCount = 1;
+    else
+         pstmt->rowCount++;
+
+    DBPRINTF(DBI_TRC_ENTRY)("%p: dbi_cursorFetchone }}}1\n", pstmt);
+    return DBI_SQL_SUCCESS;
+}
+
+/*{
+** Name: dbi_rowsetPending - Rows left in the current rowset
+**
+** Description:
+**     Returns the number of rows of the current rowset not yet handed out
+**     by dbi_cursorFetchone(). While this is non-zero the next fetch is
+**     served from memory and does not call the driver.
+**
+** Inputs:
+**     pstmt - statement handle.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     Number of buffered rows, 0 if the columns are not bound.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+int
+dbi_rowsetPending( IIDBI_STMT *pstmt )
+{
+    if (!pstmt->rowsetBound || 
+        pstmt->rowsetIndex >= (int)pstmt->rowsFetched)
+        return 0;
+    return (int)pstmt->rowsFetched - pstmt->rowsetIndex;
+}
+
+/*{
+** Name: dbi_rowsetCopy - Copy one column of a rowset row
+**
+** Description:
+**     Copies a column of a row of the current rowset into the column's
+**     descriptor data, as dbi_rowsetFetch() does for whole rows.
+**
+** Inputs:
+**     pstmt - statement with columns bound by dbi_bindColumns().
+**     row - row of the rowset, from 0.
+**     i - column index, from 0.
+**
+** Outputs:
+**     descriptor data, isNull and orInd of the column.
+**
+** Returns:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+void
+dbi_rowsetCopy( IIDBI_STMT *pstmt, int row, int i )
+{
+    dbi_copyBoundColumn(pstmt->descriptor[i], row);
+}
+
+/*{
+** Name: dbi_rowsetDetach - Hand over the rowset buffer of a column
+**
+** Description:
+**     Gives the caller the rowset buffer of a bound column, holding the
+**     values of the current rowset, and binds a new buffer for the next
+**     SQLFetch(). The length/indicator array stays with the column.
+**
+** Inputs:
+**     pstmt - statement with the rowset bound (rowsetBound).
+**     i - column index, from 0.
+**
+** Outputs:
+**     data - the former buffer, to be freed by the caller.
+**
+** Returns:
+**     DBI_SQL_SUCCESS
+**     DBI_SQL_ERROR
+**     DBI_INTERNAL_ERROR, the buffer is not handed over.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+**     16-Oct-2026 (agent)
+**         With a prefetch worker, which binds its own buffers for each
+**         fetch, only swap the buffer.
+}*/
+
+RETCODE
+dbi_rowsetDetach( IIDBI_STMT *pstmt, int i, void **data )
+{
+    HSTMT hstmt = pstmt->hdr.handle;
+    IIDBI_DESCRIPTOR *desc = pstmt->descriptor[i];
+    SQLSMALLINT cType;
+    void *rowsetData;
+    RETCODE rc;
+    int return_code;
+
+    if (!pstmt->rowsetBound || !desc->rowsetData)
+        return DBI_INTERNAL_ERROR;
+
+    rowsetData = malloc(desc->bindSize * pstmt->rowsetSize);
+    if (!rowsetData)
+        return DBI_INTERNAL_ERROR;
+
+    dbi_columnBinding(desc, &cType);
+    rc = pstmt->prefetcher ? SQL_SUCCESS : SQLBindCol(hstmt, i+1, cType, 
+        rowsetData, desc->bindSize, desc->rowsetInd);
+    if (!SQL_SUCCEEDED(rc))
+    {
+        return_code = IIDBI_ERROR( rc, NULL, NULL, hstmt, &pstmt->hdr.err );
+        DBPRINTF(DBI_TRC_STAT)
+            ( "%d = SQLBindCol (%d) %s %s %x\n",
+            rc, __LINE__, pstmt->hdr.err.sqlState, 
+            pstmt->hdr.err.messageText, pstmt->hdr.err.native );
+        free(rowsetData);
+        return return_code;
+    }
+    *data = desc->rowsetData;
+    desc->rowsetData = rowsetData;
+    return DBI_SQL_SUCCESS;
+}
+
+/*{
+** Name: dbi_rowsetConsume - Hand out the rest of the current rowset
+**
+** Description:
+**     Marks the rows of the current rowset not yet handed out by
+**     dbi_cursorFetchone() as fetched, for callers that read them from
+**     the rowset buffers directly.
+**
+** Inputs:
+**     pstmt - statement with the rowset bound (rowsetBound).
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+void
+dbi_rowsetConsume( IIDBI_STMT *pstmt )
+{
+    int rows = dbi_rowsetPending(pstmt);
+
+    if (!rows)
+        return;
+    if (pstmt->rowCount == -1)
+        pstmt->rowCount = rows;
+    else
+        pstmt->rowCount += rows;
+    pstmt->rowsetIndex = (int)pstmt->rowsFetched;
+    pstmt->rowGeneration++;
+}
+
+/*{
+** Name: dbi_prefetchStart - Start fetching rowsets ahead
+**
+** Description:
+**     Allocates a second set of rowset buffers and starts a native
+**     thread that fetches the next rowset into them while the caller
+**     converts the current one. dbi_rowsetFetch() then takes each rowset
+**     from the worker with dbi_prefetchNext(), which swaps the buffers
+**     and sets the worker off on the following rowset. The worker never
+**     touches Python objects and runs without the interpreter lock.
+**
+**     The first rowset is requested straight away, so it is on its way
+**     while the caller builds the cursor description.
+**
+** Inputs:
+**     pstmt - statement with the rowset bound (rowsetBound).
+**
+** Outputs:
+**     pstmt->prefetcher is set while the worker runs.
+**
+** Returns:
+**     DBI_SQL_SUCCESS
+**     DBI_SQL_ERROR
+**     DBI_INTERNAL_ERROR, no worker was started.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static RETCODE
+dbi_prefetchStart( IIDBI_STMT *pstmt )
+{
+    HSTMT hstmt = pstmt->hdr.handle;
+    IIDBI_PREFETCH *pf;
+    IIDBI_DESCRIPTOR *desc;
+    RETCODE rc;
+    int i;
+
+    pf = (IIDBI_PREFETCH *)calloc(1, sizeof(IIDBI_PREFETCH));
+    if (!pf)
+        return DBI_INTERNAL_ERROR;
+    pf->rowsetData = (void **)calloc(pstmt->descCount, sizeof(void *));
+    pf->rowsetInd = (SQLLEN **)calloc(pstmt->descCount, sizeof(SQLLEN *));
+    pf->empty = PyThread_allocate_lock();
+    pf->filled = PyThread_allocate_lock();
+    if (!pf->rowsetData || !pf->rowsetInd || !pf->empty || !pf->filled)
+        goto errorPrefetchStart;
+    for (i = 0; i < pstmt->descCount; i++)
+    {
+        desc = pstmt->descriptor[i];
+        pf->rowsetData[i] = malloc(desc->bindSize * pstmt->rowsetSize);
+        pf->rowsetInd[i] = malloc(sizeof(SQLLEN) * pstmt->rowsetSize);
+        if (!pf->rowsetData[i] || !pf->rowsetInd[i])
+            goto errorPrefetchStart;
+    }
+    /* both are held until there is something to signal */
+    PyThread_acquire_lock(pf->empty, WAIT_LOCK);
+    PyThread_acquire_lock(pf->filled, WAIT_LOCK);
+
+    rc = SQLSetStmtAttr(hstmt, SQL_ATTR_ROWS_FETCHED_PTR, 
+        &pf->rowsFetched, 0);
+    if (!SQL_SUCCEEDED(rc))
+        goto errorPrefetchStart;
+
+    pstmt->prefetcher = pf;
+    if (PyThread_start_new_thread(dbi_prefetchWorker, pstmt) == -1)
+    {
+        pstmt->prefetcher = NULL;
+        SQLSetStmtAttr(hstmt, SQL_ATTR_ROWS_FETCHED_PTR, 
+            &pstmt->rowsFetched, 0);
+        goto errorPrefetchStart;
+    }
+    pf->pending = TRUE;
+    PyThread_release_lock(pf->empty);
+    DBPRINTF(DBI_TRC_STAT)("%p: prefetch worker started\n", pstmt);
+    return DBI_SQL_SUCCESS;
+
+errorPrefetchStart:
+    dbi_prefetchFree(pstmt, pf);
+    return DBI_INTERNAL_ERROR;
+}
+
+/*{
+** Name: dbi_prefetchWorker - Prefetch thread
+**
+** Description:
+**     Waits to be let go by the statement, binds the back buffers and
+**     fetches a rowset into them, then hands it over. Exits when told to
+**     stop, or after a fetch that returned no rows or failed. The
+**     diagnostics of a failed fetch are left on the statement handle
+**     for the caller to read.
+**
+** Inputs:
+**     arg - statement, with pstmt->prefetcher set.
+**
+** Outputs:
+**     pf->rowsetData, pf->rowsetInd, pf->rowsFetched and pf->rc.
+**
+** Returns:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static void
+dbi_prefetchWorker( void *arg )
+{
+    IIDBI_STMT *pstmt = (IIDBI_STMT *)arg;
+    IIDBI_PREFETCH *pf = pstmt->prefetcher;
+    HSTMT hstmt = pstmt->hdr.handle;
+    SQLSMALLINT cType;
+    RETCODE rc;
+    int done;
+    int i;
+
+    for (;;)
+    {
+        PyThread_acquire_lock(pf->empty, WAIT_LOCK);
+        if (pf->stop)
+            break;
+        rc = SQL_SUCCESS;
+        for (i = 0; i < pstmt->descCount && SQL_SUCCEEDED(rc); i++)
+        {
+            dbi_columnBinding(pstmt->descriptor[i], &cType);
+            rc = SQLBindCol(hstmt, i+1, cType, pf->rowsetData[i],
+                pstmt->descriptor[i]->bindSize, pf->rowsetInd[i]);
+        }
+        pf->rowsFetched = 0;
+        if (SQL_SUCCEEDED(rc))
+            rc = SQLFetch(hstmt);
+        pf->rc = rc;
+        done = !SQL_SUCCEEDED(rc) || !pf->rowsFetched;
+        /* pf may be freed as soon as it is handed over */
+        PyThread_release_lock(pf->filled);
+        if (done)
+            return;
+    }
+    PyThread_release_lock(pf->filled);
+}
+
+/*{
+** Name: dbi_prefetchNext - Take the next rowset from the worker
+**
+** Description:
+**     Waits for the rowset the worker is fetching, makes its buffers the
+**     current rowset and gives the worker the consumed ones to fetch the
+**     following rowset into.
+**
+** Inputs:
+**     pstmt - statement with a prefetch worker.
+**
+** Outputs:
+**     rowsetData and rowsetInd of each column descriptor, rowsFetched.
+**
+** Returns:
+**     The SQLFetch() return code.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+**     17-Oct-2026 (agent)
+**         Take the return code before the worker is let go, it could be
+**         overwritten by the following fetch.
+}*/
+
+static RETCODE
+dbi_prefetchNext( IIDBI_STMT *pstmt )
+{
+    IIDBI_PREFETCH *pf = pstmt->prefetcher;
+    IIDBI_DESCRIPTOR *desc;
+    void *data;
+    SQLLEN *ind;
+    RETCODE rc;
+    int i;
+
+    /* the worker is gone after the last rowset, report it again */
+    if (!pf->pending)
+        return pf->rc;
+
+    PyThread_acquire_lock(pf->filled, WAIT_LOCK);
+    pf->pending = FALSE;
+    for (i = 0; i < pstmt->descCount; i++)
+    {
+        desc = pstmt->descriptor[i];
+        data = desc->rowsetData;
+        ind = desc->rowsetInd;
+        desc->rowsetData = pf->rowsetData[i];
+        desc->rowsetInd = pf->rowsetInd[i];
+        pf->rowsetData[i] = data;
+        pf->rowsetInd[i] = ind;
+    }
+    /* the worker overwrites both once it is let go */
+    rc = pf->rc;
+    pstmt->rowsFetched = pf->rowsFetched;
+    if (SQL_SUCCEEDED(rc) && pstmt->rowsFetched)
+    {
+        pf->pending = TRUE;
+        PyThread_release_lock(pf->empty);
+    }
+    return rc;
+}
+
+/*{
+** Name: dbi_prefetchStop - Stop the prefetch worker
+**
+** Description:
+**     Waits for a fetch in progress, tells the worker to exit and frees
+**     the back buffers. The current rowset buffers are bound again, so
+**     the statement is left as dbi_bindColumns() set it up. A rowset
+**     fetched ahead is discarded, so this is only called when the
+**     result set is given up.
+**
+** Inputs:
+**     pstmt - statement handle.
+**
+** Outputs:
+**     pstmt->prefetcher is cleared.
+**
+** Returns:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static void
+dbi_prefetchStop( IIDBI_STMT *pstmt )
+{
+    IIDBI_PREFETCH *pf = pstmt->prefetcher;
+    HSTMT hstmt = pstmt->hdr.handle;
+    SQLSMALLINT cType;
+    int i;
+
+    if (!pf)
+        return;
+
+    if (pf->pending)
+    {
+        PyThread_acquire_lock(pf->filled, WAIT_LOCK);
+        if (SQL_SUCCEEDED(pf->rc) && pf->rowsFetched)
+        {
+            /* waiting for the next request, have it exit instead */
+            pf->stop = TRUE;
+            PyThread_release_lock(pf->empty);
+            PyThread_acquire_lock(pf->filled, WAIT_LOCK);
+        }
+    }
+    pstmt->prefetcher = NULL;
+
+    if (hstmt)
+    {
+        SQLSetStmtAttr(hstmt, SQL_ATTR_ROWS_FETCHED_PTR, 
+            &pstmt->rowsFetched, 0);
+        for (i = 0; i < pstmt->descCount; i++)
+        {
+            dbi_columnBinding(pstmt->descriptor[i], &cType);
+            SQLBindCol(hstmt, i+1, cType, pstmt->descriptor[i]->rowsetData,
+                pstmt->descriptor[i]->bindSize, 
+                pstmt->descriptor[i]->rowsetInd);
+        }
+    }
+    dbi_prefetchFree(pstmt, pf);
+    DBPRINTF(DBI_TRC_STAT)("%p: prefetch worker stopped\n", pstmt);
+}
+
+/*{
+** Name: dbi_prefetchFree - Free the prefetch state
+**
+** Description:
+**     Frees the back buffers and locks of a worker that is not running.
+**
+** Inputs:
+**     pstmt - statement handle.
+**     pf - prefetch state, may be partly allocated.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static void
+dbi_prefetchFree( IIDBI_STMT *pstmt, IIDBI_PREFETCH *pf )
+{
+    int i;
+
+    for (i = 0; i < pstmt->descCount; i++)
+    {
+        if (pf->rowsetData && pf->rowsetData[i])
+            free(pf->rowsetData[i]);
+        if (pf->rowsetInd && pf->rowsetInd[i])
+            free(pf->rowsetInd[i]);
+    }
+    if (pf->rowsetData)
+        free(pf->rowsetData);
+    if (pf->rowsetInd)
+        free(pf->rowsetInd);
+    if (pf->empty)
+        PyThread_free_lock(pf->empty);
+    if (pf->filled)
+        PyThread_free_lock(pf->filled);
+    free(pf);
+}
+
+/*{
+** Name: dbi_bindParameterArrays - Bind column-wise parameter arrays
+**
+** Description:
+**     Binds pstmt->paramsetSize rows of parameters in one go. Each
+**     parameter descriptor holds an array of bindSize byte elements in
+**     rowsetData and a length/indicator array in rowsetInd, filled in by
+**     the caller. The per-row status array is allocated here.
+**
+** Inputs:
+**     pstmt - statement with parameter arrays.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     DBI_SQL_SUCCESS
+**     DBI_SQL_NO_DATA if the driver refused the array size, nothing
+**         has been bound.
+**     DBI_SQL_ERROR
+**     DBI_INTERNAL_ERROR
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static RETCODE
+dbi_bindParameterArrays( IIDBI_STMT *pstmt )
+{
+    HSTMT hstmt = pstmt->hdr.handle;
+    RETCODE rc;
+    int return_code = DBI_SQL_SUCCESS;
+    SQLULEN paramsetSize = 0;
+    IIDBI_DESCRIPTOR *desc;
+    int i;
+
+    DBPRINTF(DBI_TRC_ENTRY)("%p: dbi_bindParameterArrays %d {{{1\n", pstmt,
+        pstmt->paramsetSize);
+
+    rc = SQLSetStmtAttr(hstmt, SQL_ATTR_PARAM_BIND_TYPE, 
+        (SQLPOINTER)SQL_PARAM_BIND_BY_COLUMN, 0);
+    if (SQL_SUCCEEDED(rc))
+        rc = SQLSetStmtAttr(hstmt, SQL_ATTR_PARAMSET_SIZE, 
+            (SQLPOINTER)(SQLULEN)pstmt->paramsetSize, 0);
+    if (SQL_SUCCEEDED(rc))
+        rc = SQLGetStmtAttr(hstmt, SQL_ATTR_PARAMSET_SIZE, &paramsetSize, 
+            0, NULL);
+    if (!SQL_SUCCEEDED(rc) || paramsetSize != (SQLULEN)pstmt->paramsetSize)
+    {
+        DBPRINTF(DBI_TRC_STAT)("%p: %d = parameter array size %d refused\n",
+            pstmt, rc, pstmt->paramsetSize);
+        SQLSetStmtAttr(hstmt, SQL_ATTR_PARAMSET_SIZE, (SQLPOINTER)1, 0);
+        return_code = DBI_SQL_NO_DATA;
+        goto exitBindParameterArrays;
+    }
+
+    pstmt->paramStatus = calloc(pstmt->paramsetSize, sizeof(SQLUSMALLINT));
+    if (!pstmt->paramStatus)
+    {
+        return_code = DBI_INTERNAL_ERROR;
+        goto exitBindParameterArrays;
+    }
+    rc = SQLSetStmtAttr(hstmt, SQL_ATTR_PARAM_STATUS_PTR, 
+        pstmt->paramStatus, 0);
+    if (SQL_SUCCEEDED(rc))
+        rc = SQLSetStmtAttr(hstmt, SQL_ATTR_PARAMS_PROCESSED_PTR, 
+            &pstmt->paramsProcessed, 0);
+    if (!SQL_SUCCEEDED(rc))
+    {
+        return_code = IIDBI_ERROR( rc, NULL, NULL, hstmt, &pstmt->hdr.err );
+        DBPRINTF(DBI_TRC_STAT)
+            ( "%d = dbi_bindParameterArrays (%d) %s %s %x\n",
+            rc, __LINE__, pstmt->hdr.err.sqlState, 
+            pstmt->hdr.err.messageText, pstmt->hdr.err.native );
+        goto exitBindParameterArrays;
+    }
+
+    for (i = 0; i < pstmt->parmCount; i++)
+    {
+        desc = pstmt->parameter[i];
+        DBPRINTF(DBI_TRC_STAT)("BindParameter array %d cType %d, type %d, precision %d, scale %d, bindSize %d\n", 
+            i+1, desc->cType, desc->type, desc->precision, desc->scale, 
+            (int)desc->bindSize);
+        rc = SQLBindParameter(hstmt, i+1, SQL_PARAM_INPUT, desc->cType, 
+            desc->type, desc->precision, desc->scale, desc->rowsetData, 
+            desc->bindSize, desc->rowsetInd);
+        if (rc != SQL_SUCCESS) 
+        {
+            return_code = IIDBI_ERROR( rc, NULL, NULL, hstmt, 
+                &pstmt->hdr.err );
+            DBPRINTF(DBI_TRC_STAT)
+                ( "%d = SQLBindParameter (%d) %s %s %x\n",
+                rc, __LINE__, pstmt->hdr.err.sqlState, 
+                pstmt->hdr.err.messageText, pstmt->hdr.err.native );
+            break;
+        }
+    }
+
+exitBindParameterArrays:
+    DBPRINTF(DBI_TRC_ENTRY)("%p: dbi_bindParameterArrays }}}1\n", pstmt);
+    return return_code;
+}
+
+/*{
+** Name: dbi_unbindParameterArrays - Undo dbi_bindParameterArrays()
+**
+** Description:
+**     Resets the parameter bindings and array size on the statement
+**     handle, which may be reused when prepared, and frees the row
+**     status array. The arrays themselves belong to the parameter
+**     descriptors.
+**
+** Inputs:
+**     pstmt - statement handle.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static void
+dbi_unbindParameterArrays( IIDBI_STMT *pstmt )
+{
+    HSTMT hstmt = pstmt->hdr.handle;
+
+    if (pstmt->paramsetSize <= 1)
+        return;
+
+    if (hstmt)
+    {
+        SQLFreeStmt(hstmt, SQL_RESET_PARAMS);
+        SQLSetStmtAttr(hstmt, SQL_ATTR_PARAMSET_SIZE, (SQLPOINTER)1, 0);
+        SQLSetStmtAttr(hstmt, SQL_ATTR_PARAM_STATUS_PTR, NULL, 0);
+        SQLSetStmtAttr(hstmt, SQL_ATTR_PARAMS_PROCESSED_PTR, NULL, 0);
+    }
+    if (pstmt->paramStatus)
+        free(pstmt->paramStatus);
+    pstmt->paramStatus = NULL;
+    pstmt->paramsProcessed = 0;
+    pstmt->paramsetSize = 0;
+}
+
+/*{
+** Name: dbi_paramsetError - Find the first failed row of a parameter array
+**
+** Description:
+**     Scans the row status array filled in by the driver during the
+**     execution of a parameter array.
+**
+** Inputs:
+**     pstmt - statement handle.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     Zero based index of the first row in error, -1 if none failed.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static int
+dbi_paramsetError( IIDBI_STMT *pstmt )
+{
+    SQLULEN i;
+
+    if (!pstmt->paramStatus)
+        return -1;
+
+    for (i = 0; i < pstmt->paramsProcessed; i++)
+    {
+        if (pstmt->paramStatus[i] == SQL_PARAM_ERROR)
+        {
+            DBPRINTF(DBI_TRC_STAT)("%p: parameter row %d failed\n", pstmt, 
+                (int)i);
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+/*{
+** Name: dbi_paramIndicator - Refresh the indicator of a bound parameter
+**
+** Description:
+**     Sets the length/indicator of a parameter whose binding is kept
+**     between executes, the same way BindParameters() does when it
+**     binds the parameter.
+**
+** Inputs:
+**     desc - parameter descriptor.
+**
+** Outputs:
+**     desc->orInd
+**
+** Returns:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static void
+dbi_paramIndicator( IIDBI_DESCRIPTOR *desc )
+{
+    if (desc->isNull)
+    {
+        desc->orInd = SQL_NULL_DATA;
+        return;
+    }
+    switch (desc->type)
+    {
+    case SQL_LONGVARBINARY:
+        if (desc->precision > 0)
+            desc->orInd = SQL_LEN_DATA_AT_EXEC((SQLINTEGER)desc->precision);
+        else
+            desc->orInd = 0;
+        break;
+
+    case SQL_INTEGER:
+    case SQL_SMALLINT:
+    case SQL_TINYINT:
+    case SQL_BIT:
+    case SQL_BIGINT:
+    case SQL_FLOAT:
+    case SQL_REAL:
+    case SQL_DOUBLE:
+    case SQL_TYPE_TIME:
+    case SQL_TYPE_DATE:
+    case SQL_TYPE_TIMESTAMP:
+        desc->orInd = 0;
+        break;
+
+    case SQL_DECIMAL:
+    case SQL_CHAR:
+    case SQL_VARCHAR:
+    case SQL_WCHAR:
+    case SQL_WVARCHAR:
+    case SQL_TYPE_NULL:
+        break; /* length set by the caller */
+
+    default:
+        desc->orInd = SQL_NTS;
+        break;
+    }
+}
+
+/*{
+** Name: dbi_forgetParameterBindings - Mark all parameters as unbound
+**
+** Description:
+**     Called when the statement handle is replaced, the bindings made on
+**     the previous handle no longer apply.
+**
+** Inputs:
+**     pstmt - statement handle.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static void
+dbi_forgetParameterBindings( IIDBI_STMT *pstmt )
+{
+    int i;
+
+    for (i = 0; pstmt->parameter && i < pstmt->parmCount; i++)
+        pstmt->parameter[i]->isBound = FALSE;
+}
+
+/*{
+** Name: dbi_resetParameter - Release the data of a parameter descriptor
+**
+** Description:
+**     Frees the data a parameter descriptor owns, using the same rules
+**     as dbi_freeDescriptor(), so the descriptor can be reused for a
+**     value of another type. The descriptor is marked as unbound.
+**
+** Inputs:
+**     desc - parameter descriptor.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+**     16-Oct-2026 (agent)
+**         Release the parameter stream.
+**     16-Oct-2026 (agent)
+**         Leave a value in the descriptor's arena slot.
+}*/
+
+void
+dbi_resetParameter( IIDBI_DESCRIPTOR *desc )
+{
+    if (desc->data && desc->data != desc->rowsetData && 
+        desc->data != desc->slot)
+    {
+        switch (desc->type)
+        {
+            case SQL_LONGVARCHAR:
+            case SQL_LONGVARBINARY:
+            case SQL_WLONGVARCHAR:
+            case SQL_CHAR:
+            case SQL_VARCHAR:
+            case SQL_WVARCHAR:
+            case SQL_WCHAR:
+                break;
+
+            default:
+                free (desc->data);  
+                break;
+        }
+    }
+    if (desc->rowsetData)
+        free(desc->rowsetData);
+    if (desc->putStream)
+        desc->putStream->release(desc->putStream);
+    desc->putStream = NULL;
+    desc->rowsetData = NULL;
+    desc->bindSize = 0;
+    desc->data = NULL;
+    desc->isBound = FALSE;
+}
+
+/*{
+** Name: dbi_getDataAnyColumn - Can unbound columns precede bound ones
+**
+** Description:
+**     Reports whether the driver supports SQLGetData() on any unbound
+**     column (SQL_GD_ANY_COLUMN), not just those after the last bound
+**     column. The answer is kept on the connection.
+**
+** Inputs:
+**     pstmt - statement handle.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     TRUE if SQL_GD_ANY_COLUMN is supported.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static int
+dbi_getDataAnyColumn( IIDBI_STMT *pstmt )
+{
+    IIDBI_DBC *pdbc = pstmt->pdbc;
+    SQLUINTEGER extensions = 0;
+
+    if (!pdbc || !pdbc->hdr.handle)
+        return FALSE;
+    if (!pdbc->getDataKnown)
+    {
+        if (SQL_SUCCEEDED(SQLGetInfo(pdbc->hdr.handle, SQL_GETDATA_EXTENSIONS,
+            &extensions, sizeof(extensions), NULL)))
+            pdbc->getDataExtensions = extensions;
+        pdbc->getDataKnown = TRUE;
+    }
+    return (pdbc->getDataExtensions & SQL_GD_ANY_COLUMN) ? TRUE : FALSE;
+}
+
+/*{
+** Name: dbi_copyBoundColumn - Copy a bound column value to the descriptor
+**
+** Description:
+**     Copies the value of a bound column for the given row of the
+**     binding buffer into the descriptor data buffer, so callers see
+**     the same layout as with SQLGetData().
+**
+** Inputs:
+**     desc - column descriptor bound by dbi_bindColumns().
+**     row - row of the rowset, 0 for single row fetches.
+**
+** Outputs:
+**     desc->data, desc->isNull and desc->orInd.
+**
+** Returns:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static void
+dbi_copyBoundColumn( IIDBI_DESCRIPTOR *desc, int row )
+{
+    SQLLEN ind = desc->rowsetInd[row];
+
+    if (ind == SQL_NULL_DATA)
+        desc->isNull = 1;
+    else
+    {
+        desc->isNull = 0;
+        memcpy(desc->data, (char *)desc->rowsetData + row * desc->bindSize,
+            desc->bindSize);
+    }
+    desc->orInd = ind;
+}
+
+/*{
+** Name: dbi_lobColumn - Find the LONG column to stream
+**
+** Description:
+**     With LOB streaming requested, the value of a LONG column can be
+**     left in the driver only if no later column is read with
+**     SQLGetData(), which would skip past it. That is the last column
+**     not served from a binding buffer, if it is a LONG column.
+**
+** Inputs:
+**     pstmt - statement with described (and possibly bound) columns.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     The 1-based column number, or 0 if no column is streamed.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static int
+dbi_lobColumn( IIDBI_STMT *pstmt )
+{
+    int i;
+    IIDBI_DESCRIPTOR *desc;
+
+    if (!pstmt->lobStreaming)
+        return 0;
+
+    for (i = pstmt->descCount - 1; i >= 0; i--)
+    {
+        desc = pstmt->descriptor[i];
+        if (pstmt->colsBound && desc->rowsetInd)
+            continue;
+        switch (desc->type)
+        {
+        case SQL_LONGVARCHAR:
+        case SQL_LONGVARBINARY:
+        case SQL_WLONGVARCHAR:
+            return i + 1;
+        default:
+            return 0;
+        }
+    }
+    return 0;
+}
+
+/*{
+** Name: dbi_fetchLobHead - Read the first segment of a streamed column
+**
+** Description:
+**     Reads up to IIDBI_LOB_HEAD_SIZE bytes of a streamed LONG column
+**     into the descriptor, which tells NULL from non-NULL values. The
+**     remainder stays in the driver.
+**
+** Inputs:
+**     pstmt - statement positioned on a row.
+**     colNbr - 1-based column number, from dbi_lobColumn().
+**
+** Outputs:
+**     desc->data, desc->precision and desc->orInd hold the segment,
+**     desc->isNull is set for NULL values. pstmt->lobColumn is set to
+**     colNbr and pstmt->lobPending if more data follows.
+**
+** Returns:
+**     DBI_SQL_SUCCESS
+**     DBI_SQL_ERROR
+**     DBI_INTERNAL_ERROR
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static RETCODE
+dbi_fetchLobHead( IIDBI_STMT *pstmt, int colNbr )
+{
+    IIDBI_DESCRIPTOR *desc = pstmt->descriptor[colNbr - 1];
+    RETCODE return_code;
+    SQLLEN len = 0;
+    unsigned char more = FALSE;
+
+    dbi_lobRelease(desc);
+    if (desc->data)
+        free(desc->data);
+    desc->isNull = 0;
+    desc->precision = 0;
+    desc->orInd = 0;
+    desc->data = malloc(IIDBI_LOB_HEAD_SIZE + sizeof(SQLWCHAR));
+    if (!desc->data)
+        return DBI_INTERNAL_ERROR;
+
+    return_code = dbi_cursorGetSegment(pstmt, colNbr, 
+        dbi_lobCType(desc->type), desc->data, IIDBI_LOB_HEAD_SIZE, &len, 
+        &more, NULL);
+    if (return_code == DBI_SQL_NO_DATA)
+        return_code = DBI_SQL_SUCCESS;
+    else if (return_code != DBI_SQL_SUCCESS)
+        return return_code;
+
+    if (len == SQL_NULL_DATA)
+    {
+        desc->isNull = 1;
+        return DBI_SQL_SUCCESS;
+    }
+    desc->precision = len;
+    desc->orInd = len;
+    pstmt->lobColumn = colNbr;
+    pstmt->lobPending = more;
+    DBPRINTF(DBI_TRC_STAT)("%p: streaming column %d, %d bytes read%s\n",
+        pstmt, colNbr, (int)len, more ? ", more pending" : "");
+    return DBI_SQL_SUCCESS;
+}
+
+/*{
+** Name: dbi_fetchLong - Read a LONG column of the current row
+**
+** Description:
+**     Reads a LONG VARCHAR, LONG NVARCHAR or LONG BYTE column with
+**     SQLGetData(). A value that fits in one segment is left in a
+**     malloc()ed buffer. For longer values the buffer is sized from
+**     the length the driver reports, or doubled when the driver does
+**     not know it, so each byte is read once and moved at most a
+**     logarithmic number of times. Character and binary values are
+**     read straight into the object returned for them when an
+**     allocator is set, see dbi_lobBuffer().
+**
+** Inputs:
+**     pstmt - statement positioned on a row.
+**     i - 0-based column number.
+**     segmentSize - bytes read by the first SQLGetData() call.
+**
+** Outputs:
+**     desc->data or desc->lobObject, desc->precision and desc->orInd
+**     hold the value, desc->isNull is set for NULL values.
+**
+** Returns:
+**     DBI_SQL_SUCCESS
+**     DBI_SQL_ERROR
+**     DBI_INTERNAL_ERROR
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created from the per-type loops of dbi_cursorFetchone().
+**     17-Oct-2026 (agent)
+**         Character and binary values grow through the allocator.
+}*/
+
+static RETCODE
+dbi_fetchLong( IIDBI_STMT *pstmt, int i, int segmentSize )
+{
+    IIDBI_DESCRIPTOR *desc = pstmt->descriptor[i];
+    SQLSMALLINT cType = dbi_lobCType(desc->type);
+    RETCODE return_code;
+    SQLLEN count, size, len = 0, avail = SQL_NO_TOTAL;
+    unsigned char more = FALSE;
+    char *buf;
+
+    dbi_lobRelease(desc);
+    if (desc->data)
+        free(desc->data);
+    desc->data = NULL;
+    desc->isNull = 0;
+    desc->precision = 0;
+    desc->orInd = 0;
+
+    buf = malloc(segmentSize + sizeof(SQLWCHAR));
+    if (!buf)
+        return DBI_INTERNAL_ERROR;
+    return_code = dbi_cursorGetSegment(pstmt, i + 1, cType, buf, 
+        segmentSize, &len, &more, &avail);
+    if (return_code == DBI_SQL_NO_DATA)
+        return_code = DBI_SQL_SUCCESS;
+    if (return_code != DBI_SQL_SUCCESS || len == SQL_NULL_DATA)
+    {
+        free(buf);
+        desc->isNull = (len == SQL_NULL_DATA);
+        return return_code;
+    }
+    count = len;
+    size = count;
+
+    while (more)
+    {
+        if (count == size)
+        {
+            /*
+            ** Grow to the length still in the driver when it is known,
+            ** otherwise double the buffer.
+            */
+            if (avail != SQL_NO_TOTAL && avail > len)
+                size = count + avail - len;
+            else
+                size = (count + sizeof(SQLWCHAR)) * 2;
+            buf = dbi_lobBuffer(desc, cType, buf, count, size);
+            if (!buf)
+                return DBI_INTERNAL_ERROR;
+        }
+        return_code = dbi_cursorGetSegment(pstmt, i + 1, cType, 
+            buf + count, size - count, &len, &more, &avail);
+        if (return_code == DBI_SQL_NO_DATA)
+        {
+            return_code = DBI_SQL_SUCCESS;
+            break;
+        }
+        if (return_code != DBI_SQL_SUCCESS)
+        {
+            if (!desc->lobObject)
+                free(buf);
+            dbi_lobRelease(desc);
+            return return_code;
+        }
+        count += len;
+    }
+
+    if (!desc->lobObject)
+        desc->data = buf;
+    desc->precision = count;
+    desc->orInd = count;
+    DBPRINTF(DBI_TRC_STAT)("%p: column %d, %d bytes read into %d\n",
+        pstmt, i + 1, (int)count, (int)size);
+    return DBI_SQL_SUCCESS;
+}
+
+/*{
+** Name: dbi_lobBuffer - Grow the buffer of a LONG column
+**
+** Description:
+**     Returns a buffer of size bytes holding the first count bytes of
+**     buf. Unicode values stay in malloc()ed memory as they are
+**     converted when the row is built. Character and binary values
+**     move into desc->lobObject through the allocator set by
+**     dbi_lobAllocator(), so the row takes the value without copying
+**     it again.
+**
+** Inputs:
+**     desc - column descriptor.
+**     cType - C type the column is read as.
+**     buf - current buffer.
+**     count - bytes of buf in use.
+**     size - new buffer size.
+**
+** Outputs:
+**     desc->lobObject - object holding the buffer.
+**
+** Returns:
+**     The new buffer, or NULL if no memory is left. buf is released
+**     either way.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+**     17-Oct-2026 (agent)
+**         Use the allocator instead of creating the Python string here.
+}*/
+
+static char *
+dbi_lobBuffer( IIDBI_DESCRIPTOR *desc, SQLSMALLINT cType, char *buf, 
+    SQLLEN count, SQLLEN size )
+{
+    char *newBuf;
+
+    if (cType != SQL_C_WCHAR && dbi_lobAlloc)
+        return dbi_lobAlloc->grow(desc, buf, count, size);
+
+    newBuf = realloc(buf, size + sizeof(SQLWCHAR));
+    if (!newBuf)
+        free(buf);
+    return newBuf;
+}
+
+/*{
+** Name: dbi_lobRelease - Drop a LONG value not taken by a row
+**
+** Description:
+**     Releases desc->lobObject, left by dbi_fetchLong() when the row
+**     was not built.
+**
+** Inputs:
+**     desc - column descriptor.
+**
+** Outputs:
+**     desc->lobObject is cleared.
+**
+** Returns:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+**     17-Oct-2026 (agent)
+**         Release the value through the allocator.
+}*/
+
+static void
+dbi_lobRelease( IIDBI_DESCRIPTOR *desc )
+{
+    if (desc->lobObject && dbi_lobAlloc)
+        dbi_lobAlloc->release(desc);
+}
+
+/*{
+** Name: dbi_lobAllocator - Set the allocator of LONG column values
+**
+** Description:
+**     Sets the allocator LONG VARCHAR and LONG BYTE values are read
+**     into, see IIDBI_LOBALLOC. Without one the values are left in
+**     malloc()ed memory in desc->data.
+**
+** Inputs:
+**     alloc - allocator, NULL for none.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None.
+**
+** History:
+**     17-Oct-2026 (agent)
+**         Created.
+}*/
+
+void
+dbi_lobAllocator( IIDBI_LOBALLOC *alloc )
+{
+    dbi_lobAlloc = alloc;
+}
+
+/*{
+** Name: dbi_lobCType - C type a LONG column is read as
+**
+** Description:
+**     Maps a LONG column's SQL type to the C type used to read it
+**     in segments.
+**
+** Inputs:
+**     type - SQL type of the column.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     SQL_C_WCHAR, SQL_C_BINARY or SQL_C_CHAR.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+SQLSMALLINT
+dbi_lobCType( int type )
+{
+    switch (type)
+    {
+    case SQL_WLONGVARCHAR:
+        return SQL_C_WCHAR;
+    case SQL_LONGVARBINARY:
+        return SQL_C_BINARY;
+    default:
+        return SQL_C_CHAR;
+    }
+}
+
+/*{
+** Name: dbi_cursorGetSegment - Read the next segment of a column
+**
+** Description:
+**     Reads the next part of a column of the current row with
+**     SQLGetData(). Character data is null terminated by the driver,
+**     the terminator is not counted in the returned length.
+**
+** Inputs:
+**     pstmt - statement positioned on a row.
+**     colNbr - 1-based column number.
+**     cType - C type to read the column as, see dbi_lobCType().
+**     buf - buffer of at least bufLen + sizeof(SQLWCHAR) bytes.
+**     bufLen - largest number of bytes to return.
+**
+** Outputs:
+**     len - number of bytes read, or SQL_NULL_DATA.
+**     more - TRUE if data remains in the driver.
+**     avail - optional, bytes the driver held before the read, or
+**             SQL_NO_TOTAL if it does not know.
+**
+** Returns:
+**     DBI_SQL_SUCCESS
+**     DBI_SQL_NO_DATA   all of the column has been read.
+**     DBI_SQL_ERROR
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+**     16-Oct-2026 (agent)
+**         Added avail.
+}*/
+
+RETCODE
+dbi_cursorGetSegment( IIDBI_STMT *pstmt, int colNbr, SQLSMALLINT cType,
+    char *buf, SQLLEN bufLen, SQLLEN *len, unsigned char *more, 
+    SQLLEN *avail )
+{
+    RETCODE rc, return_code;
+    SQLLEN ind = 0;
+    SQLLEN terminator = 0;
+
+    *len = 0;
+    *more = FALSE;
+    if (avail)
+        *avail = SQL_NO_TOTAL;
+    if (cType == SQL_C_CHAR)
+        terminator = 1;
+    else if (cType == SQL_C_WCHAR)
+    {
+        terminator = sizeof(SQLWCHAR);
+        bufLen -= bufLen % sizeof(SQLWCHAR);
+    }
+
+    rc = SQLGetData(pstmt->hdr.handle, (SQLUSMALLINT)colNbr, cType, buf, 
+        bufLen + terminator, &ind);
+    if (rc == SQL_NO_DATA)
+        return DBI_SQL_NO_DATA;
+    if (!SQL_SUCCEEDED(rc))
+    {
+        return_code = IIDBI_ERROR( rc, NULL, NULL, pstmt->hdr.handle, 
+            &pstmt->hdr.err );
+        DBPRINTF(DBI_TRC_STAT)
+            ( "%d = dbi_cursorGetSegment (%d) %s %s %x\n",
+            rc, __LINE__, pstmt->hdr.err.sqlState, 
+            pstmt->hdr.err.messageText, pstmt->hdr.err.native );
+        return return_code;
+    }
+
+    if (avail)
+        *avail = ind;
+    if (ind == SQL_NULL_DATA)
+        *len = SQL_NULL_DATA;
+    else if (ind == SQL_NO_TOTAL || ind > bufLen)
+    {
+        *len = bufLen;
+        *more = TRUE;
+    }
+    else
+        *len = ind;
+    return DBI_SQL_SUCCESS;
+}
+
+/*{
+** Name: dbi_putStream - Send a parameter from its stream
+**
+** Description:
+**     Answers SQL_NEED_DATA for a parameter with a putStream: reads the
+**     stream and passes each segment to SQLPutData() until the stream
+**     ends, so the value is never held in memory as a whole. If reading
+**     the stream fails the statement is cancelled and streamFailed is
+**     set in the statement's error, so the stream's own error can be
+**     reported instead.
+**
+** Inputs:
+**     pstmt - statement being executed.
+**     stream - parameter stream.
+**     segmentSize - largest segment to request from the stream.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     DBI_SQL_SUCCESS
+**     DBI_SQL_ERROR        SQLPutData() failed.
+**     DBI_INTERNAL_ERROR   the stream failed.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+**     17-Oct-2026 (agent)
+**         Set streamFailed when the stream fails.
+}*/
+
+static RETCODE
+dbi_putStream( IIDBI_STMT *pstmt, IIDBI_PUTSTREAM *stream, int segmentSize )
+{
+    HSTMT hstmt = pstmt->hdr.handle;
+    RETCODE rc, return_code;
+    char *data;
+    SQLLEN len;
+    int status;
+    int segments = 0;
+
+    for (;;)
+    {
+        status = stream->read(stream, segmentSize, &data, &len);
+        if (status == DBI_SQL_NO_DATA)
+            break;
+        if (status != DBI_SQL_SUCCESS)
+        {
+            SQLCancel(hstmt);
+            strcpy(pstmt->hdr.err.sqlState, "HY000");
+            strcpy(pstmt->hdr.err.messageText, 
+                "Reading LOB parameter data failed");
+            pstmt->hdr.err.native = 0;
+            pstmt->hdr.err.streamFailed = TRUE;
+            DBPRINTF(DBI_TRC_STAT)("%p: parameter stream failed after %d segments\n",
+                pstmt, segments);
+            return DBI_INTERNAL_ERROR;
+        }
+        rc = SQLPutData(hstmt, data, len);
+        if (!SQL_SUCCEEDED(rc))
+            goto putError;
+        segments++;
+    }
+
+    /* an empty value still needs one (empty) segment */
+    if (!segments)
+    {
+        rc = SQLPutData(hstmt, "", 0);
+        if (!SQL_SUCCEEDED(rc))
+            goto putError;
+    }
+    return DBI_SQL_SUCCESS;
+
+putError:
+    return_code = IIDBI_ERROR( rc, NULL, NULL, hstmt, &pstmt->hdr.err );
+    DBPRINTF(DBI_TRC_STAT)
+        ( "%d = SQLPutData (%d) %s %s %x\n",
+        rc, __LINE__, pstmt->hdr.err.sqlState, 
+        pstmt->hdr.err.messageText, pstmt->hdr.err.native );
+    return return_code;
+}
@@ -25,6 +25,11 @@
 #include <datetime.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#ifndef WIN32
+#include <errno.h>
+#include <unistd.h>
+#include <poll.h>
+#endif /* WIN32 */
 
 /**
 ** Name: iingresdbi.c - Ingres Python DB API base module classes and
@@ -41,6 +46,9 @@
     IIDBI_dateFromTicks
     IIDBI_date
     IIDBI_connect
+    IIDBI_envAcquire
+    IIDBI_envRelease
+    IIDBI_envExit
     IIDBI_CONNECTION *IIDBI_connConstructor
     IIDBI_connCursor
     IIDBI_CURSOR *IIDBI_cursorConstructor
@@ -83,9 +91,16 @@
     IIDBI_cursorSetErrorHandler
     IIDBI_cursorGetPrepared
     IIDBI_cursorSetPrepared
+    IIDBI_cursorGetLobStreaming
+    IIDBI_cursorSetLobStreaming
+    IIDBI_cursorGetPrefetch
+    IIDBI_cursorSetPrefetch
     IIDBI_connDestructor
     IIDBI_connPrint
     IIDBI_cursorExecuteMany
+    IIDBI_cursorExecuteColumns
+    IIDBI_cursorExecuteParamSet
+    IIDBI_paramSetErrorRow
     IIDBI_cursorExecute
     IIDBI_cursorCallProc
     IIDBI_cursorNextSet
@@ -94,6 +109,13 @@
     IIDBI_cursorSetOutputSize
     IIDBI_cursorFetchMany
     IIDBI_cursorFetchAll
+    IIDBI_cursorFetchCheck
+    IIDBI_cursorBindRowset
+    IIDBI_cursorBuildRow
+    IIDBI_cursorBuildValue
+    IIDBI_cursorFetchRows
+    IIDBI_cursorFetchColumns
+    IIDBI_cursorFetchBuffers
     IIDBI_connCommit
     IIDBI_connRollback
     IIDBI_mapError2exception
@@ -108,7 +130,99 @@
     IIDBI_clearMessages
     IIDBI_connCleanup
     IIDBI_sendParameters
+    IIDBI_paramKind
+    IIDBI_paramKindCache
+    IIDBI_paramKindRelease
+    IIDBI_unicodeToWide
+    IIDBI_paramWideReserve
+    IIDBI_sendParameterArray
+    IIDBI_paramArrayType
+    IIDBI_paramArrayScan
+    IIDBI_paramArrayDescribe
+    IIDBI_paramArrayStore
+    IIDBI_sendColumnArray
+    IIDBI_paramBufferType
+    IIDBI_paramColumnInit
+    IIDBI_paramColumnCheck
+    IIDBI_paramColumnItem
+    IIDBI_paramColumnRelease
+    IIDBI_paramSetSendRows
+    IIDBI_paramSetGetRow
+    IIDBI_paramSetSendColumns
+    IIDBI_paramSetColumnRow
+    IIDBI_releaseParameters
+    IIDBI_lobReaderNew
+    IIDBI_lobReaderCheck
+    IIDBI_lobReaderGet
+    IIDBI_lobReaderRead
+    IIDBI_lobReaderClose
+    IIDBI_lobReaderIterNext
+    IIDBI_lobReaderDestructor
+    IIDBI_columnBufferFormat
+    IIDBI_columnBufferNew
+    IIDBI_columnBufferDestructor
+    IIDBI_columnBufferLength
+    IIDBI_columnBufferItem
+    IIDBI_columnBufferRead
+    IIDBI_columnBufferSegments
+    IIDBI_columnBufferGet
+    IIDBI_putSourceNew
+    IIDBI_putSourceRead
+    IIDBI_putSourceRelease
+    IIDBI_lobGrow
+    IIDBI_lobDrop
+    IIDBI_connGetDecimal
+    IIDBI_connSetDecimal
+    IIDBI_decimalModeArg
+    IIDBI_decimalFromChar
+    IIDBI_decimalToChar
+    IIDBI_connGetConverters
+    IIDBI_connSetConverters
+    IIDBI_cursorGetConverters
+    IIDBI_cursorSetConverters
+    IIDBI_convertResolve
+    IIDBI_convertRelease
+    IIDBI_convertLookup
+    IIDBI_convertTypeName
+    IIDBI_convertColumn
+    IIDBI_convertScaled
+    IIDBI_fetchColumnPut
+    IIDBI_fetchColumnList
+    IIDBI_fetchColumnResult
+    IIDBI_fetchColumnFree
     IIDBI_IsTrue
+    IIDBI_cursorExecuteBegin
+    IIDBI_cursorExecuteEnd
+    IIDBI_cursorExecuteAbort
+    IIDBI_cursorExecuteAsync
+    IIDBI_asyncExecWorker
+    IIDBI_asyncExecFinish
+    IIDBI_asyncExecJoin
+    IIDBI_asyncExecDone
+    IIDBI_asyncExecWait
+    IIDBI_asyncExecFileno
+    IIDBI_asyncExecDestructor
+    IIDBI_cursorCancel
+    IIDBI_cursorGetTimeout
+    IIDBI_cursorSetTimeout
+    IIDBI_connGetTimeout
+    IIDBI_connSetTimeout
+    IIDBI_timeoutArg
+    IIDBI_poolNew
+    IIDBI_poolConnect
+    IIDBI_poolClose
+    IIDBI_poolGetStats
+    IIDBI_poolRelease
+    IIDBI_poolOpen
+    IIDBI_poolWrap
+    IIDBI_poolDetach
+    IIDBI_poolHandOff
+    IIDBI_poolDrop
+    IIDBI_poolGrant
+    IIDBI_poolWait
+    IIDBI_poolPrune
+    IIDBI_poolDisconnect
+    IIDBI_poolDestructor
 **)E
 **
 ** History:
@@ -257,6 +371,114 @@
 **      connection/cursror resource. Other Windows ODBC drivers also crash.
 **  24-Nov-2009 (clach04)
 **      Added debug trace for unknown types on select/fetch.
+**  16-Oct-2026 (agent)
+**      Result sets are fetched in blocks of cursor.arraysize rows when
+**      arraysize is greater than one (see dbi_bindColumns()).
+**  16-Oct-2026 (agent)
+**      Removed per-row dbi_allocData()/dbi_freeData() calls, column
+**      buffers are allocated by execute and freed with the descriptor.
+**  16-Oct-2026 (agent)
+**      fetchmany() and fetchall() no longer go through IIDBI_cursorFetch()
+**      for each row; IIDBI_cursorFetchRows() validates the cursor once and
+**      builds the result list directly.
+**  16-Oct-2026 (agent)
+**      The cursor iterator warns once per cursor rather than once per row,
+**      binds the result columns for block fetches and returns buffered
+**      rows without going through IIDBI_cursorFetch().
+**  16-Oct-2026 (agent)
+**      executemany() sends its parameters as column-wise arrays,
+**      IIDBI_PARAMSET_SIZE rows per execute, see IIDBI_sendParameterArray().
+**  16-Oct-2026 (agent)
+**      executemany() prepares the query once and keeps the parameter
+**      bindings between rows, see IIDBI_releaseParameters().
+**  16-Oct-2026 (agent)
+**      A prepared cursor whose query changes stays prepared; handles
+**      prepared with earlier queries are kept in a per-connection
+**      statement cache (see dbi_stmtCacheGet()).
+**  16-Oct-2026 (agent)
+**      Added the cursor.lobstreaming attribute. When set, fetchone() and
+**      iteration return a LOB reader (IIDBI_lobReaderType) for the last
+**      LONG column rather than its whole value.
+**  16-Oct-2026 (agent)
+**      A file-like object or an iterator can be passed as a LONG BYTE
+**      parameter, it is read segment by segment while the query
+**      executes (see IIDBI_putSourceNew()).
+**  16-Oct-2026 (agent)
+**      LONG VARCHAR and LONG BYTE values are returned in the string the
+**      dbi layer fetched them into rather than a copy.
+**  16-Oct-2026 (agent)
+**      DECIMAL columns are converted without calling the Decimal
+**      constructor, and Decimal parameters formatted without str(), see
+**      IIDBI_decimalFromChar() and IIDBI_decimalToChar(). Added the
+**      decimal connect keyword and connection attribute.
+**  16-Oct-2026 (agent)
+**      Added the connection.converters and cursor.converters registries
+**      of output converters, by column index or ODBC type name. They are
+**      resolved once per execute, see IIDBI_convertResolve(), and applied
+**      by IIDBI_cursorBuildRow() through IIDBI_convertColumn().
+**  16-Oct-2026 (agent)
+**      Added cursor.fetchcolumns(), which returns the result column by
+**      column with numeric columns in array.array objects rather than
+**      a tuple per row.
+**  16-Oct-2026 (agent)
+**      Added cursor.fetchbuffers(), which returns the numeric columns of
+**      a rowset as column buffer objects (IIDBI_columnBufferType) over
+**      the memory the driver fetched into.
+**  16-Oct-2026 (agent)
+**      Added cursor.executecolumns(), which takes the parameter set as
+**      one sequence or numeric buffer per parameter and sends it as
+**      parameter arrays, see IIDBI_sendColumnArray().
+**  16-Oct-2026 (agent)
+**      IIDBI_sendParameters() caches the kind of parameter found at each
+**      position by type, see IIDBI_paramKindCache().
+**  16-Oct-2026 (agent)
+**      IIDBI_sendParameters() keeps fixed size and Decimal values in the
+**      statement's parameter arena, see dbi_paramArenaAlloc().
+**  16-Oct-2026 (agent)
+**      IIDBI_sendParameters() binds a unicode parameter's own storage when
+**      Py_UNICODE and SQLWCHAR have the same width, and otherwise
+**      transcodes it into the statement's wide buffer, see
+**      IIDBI_unicodeToWide().
+**  16-Oct-2026 (agent)
+**      Added the cursor.prefetch attribute. When set, rowsets are fetched
+**      ahead by a worker thread, see dbi_prefetchStart().
+**  16-Oct-2026 (agent)
+**      Added cursor.execute_async(), which runs the query in a worker
+**      thread and returns an asynchronous execute object
+**      (IIDBI_asyncExecType) to poll or wait on. IIDBI_cursorExecute() is
+**      split into IIDBI_cursorExecuteBegin() and IIDBI_cursorExecuteEnd()
+**      for it.
+**  16-Oct-2026 (agent)
+**      Added cursor.cancel() and the cursor.timeout and connection.timeout
+**      query timeouts, see dbi_cursorCancel() and IIDBI_QUERY_TIMEOUT.
+**  17-Oct-2026 (agent)
+**      Added ingresdbi.ConnectionPool (IIDBI_poolType), which keeps 
+**      connected DBI connection handles and hands them out in new
+**      connection objects. Connections keep a list of their open cursors
+**      so a pooled connection's cursors are closed when it is returned.
+**  17-Oct-2026 (agent)
+**      The ODBC environment is shared by all connections with the same
+**      pooled setting, IIDBIenv holds one per setting. It is allocated by
+**      the first connect() and reference counted by the connections and
+**      the module.
+**  17-Oct-2026 (agent)
+**      The Python strings LONG columns are read into are allocated by
+**      IIDBI_lobGrow(), set as the DBI layer's IIDBI_LOBALLOC.
+**  17-Oct-2026 (agent)
+**      DECIMAL columns are built by calling Decimal with the driver
+**      string and Decimal parameters formatted with str(), instead of
+**      through the private slots of Decimal.
+**  17-Oct-2026 (agent)
+**      executemany() and executecolumns() share the loop executing their
+**      parameter sets, IIDBI_cursorExecuteParamSet(), given an
+**      IIDBI_PARAMSET for each.
+**  17-Oct-2026 (agent)
+**      fetchmany(), fetchall() and fetchcolumns() bind the result columns
+**      for block fetches before the first row, as iterating does, see
+**      IIDBI_cursorBindRowset().
+**  17-Oct-2026 (agent)
+**      The error raised when a row of executemany() or executecolumns()
+**      fails names the row, see IIDBI_paramSetErrorRow().
 **/
 
 static PyObject *IIDBI_Warning;
@@ -284,11 +506,33 @@ static PyObject *IIDBI_connClose(IIDBI_CONNECTION *self);
 static IIDBI_CURSOR *IIDBI_cursorConstructor(void);
 static PyObject *IIDBI_cursorExecute(IIDBI_CURSOR *self, PyObject *args);
 static PyObject *IIDBI_cursorExecuteMany(IIDBI_CURSOR *self, PyObject *args);
+static PyObject *IIDBI_cursorExecuteColumns(IIDBI_CURSOR *self, 
+    PyObject *args);
+static int IIDBI_cursorExecuteParamSet(IIDBI_CURSOR *self, 
+    IIDBI_STMT *IIDBIpstmt, char *szSqlStr, IIDBI_PARAMSET *paramSet, 
+    Py_ssize_t paramSetSize, int *result);
+static void IIDBI_paramSetErrorRow(IIDBI_ERROR *err, Py_ssize_t row);
 static PyObject *IIDBI_cursorFetch(IIDBI_CURSOR *self);
 static PyObject *IIDBI_cursorFetchAll(IIDBI_CURSOR *self);
 static PyObject *IIDBI_cursorFetchMany(IIDBI_CURSOR *self, PyObject *args);
+static IIDBI_STMT *IIDBI_cursorFetchCheck(IIDBI_CURSOR *self, int *result);
+static void IIDBI_cursorBindRowset(IIDBI_CURSOR *self, IIDBI_STMT *IIDBIpstmt);
+static IIDBI_STMT *IIDBI_cursorExecuteBegin(IIDBI_CURSOR *self, 
+    char *szSqlStr, PyObject *params, int *result);
+static PyObject *IIDBI_cursorExecuteEnd(IIDBI_CURSOR *self, 
+    IIDBI_STMT *IIDBIpstmt, RETCODE rc, char *szSqlStr);
+static void IIDBI_cursorExecuteAbort(IIDBI_CURSOR *self, 
+    IIDBI_STMT *IIDBIpstmt);
+static PyObject *IIDBI_cursorExecuteAsync(IIDBI_CURSOR *self, 
+    PyObject *args);
+static PyObject *IIDBI_cursorBuildRow(IIDBI_CURSOR *self, 
+    IIDBI_STMT *IIDBIpstmt, int *result);
+static PyObject *IIDBI_cursorFetchRows(IIDBI_CURSOR *self, long maxRows);
+static PyObject *IIDBI_cursorFetchColumns(IIDBI_CURSOR *self, PyObject *args);
+static PyObject *IIDBI_cursorFetchBuffers(IIDBI_CURSOR *self);
 static PyObject *IIDBI_cursorCallProc(IIDBI_CURSOR *self, PyObject *args);
 static PyObject *IIDBI_cursorClose(IIDBI_CURSOR *self);
+static PyObject *IIDBI_cursorCancel(IIDBI_CURSOR *self);
 static PyObject *IIDBI_cursorSetInputSizes(IIDBI_CURSOR *self, PyObject *args);
 static PyObject *IIDBI_cursorSetOutputSize(IIDBI_CURSOR *self, PyObject *args);
 static PyObject *IIDBI_cursorNextSet(IIDBI_CURSOR *self);
@@ -305,6 +549,9 @@ static PyObject * IIDBI_cursorIterNext(IIDBI_CURSOR *self);
 static int IIDBI_IsTrue(PyObject* x);
 
 PyMODINIT_FUNC SQL_API initingresdbi(void);
+static RETCODE IIDBI_envAcquire(IIDBI_DBC *pdbc);
+static void IIDBI_envRelease(IIDBI_DBC *pdbc);
+static void IIDBI_envExit(void);
 int IIDBI_cursorCleanup(IIDBI_CURSOR *self);
 void IIDBI_connCleanup(IIDBI_CONNECTION * self);
 static void IIDBI_cursorDestructor(IIDBI_CURSOR *self);
@@ -315,6 +562,118 @@ int IIDBI_handleError(PyObject *self, PyObject *exception, char *errMsg);
 void IIDBI_handleWarning(char *errMsg, PyObject *messages);
 void IIDBI_clearMessages(PyObject *messages);
 int IIDBI_sendParameters(IIDBI_CURSOR *self, PyObject *params);
+static int IIDBI_paramKind(PyObject *elem);
+static void IIDBI_paramKindCache(IIDBI_CURSOR *self, int i, int parmCount,
+    PyObject *elem, int kind);
+static void IIDBI_paramKindRelease(IIDBI_CURSOR *self);
+static Py_ssize_t IIDBI_unicodeToWide(Py_UNICODE *src, Py_ssize_t len, 
+    SQLWCHAR *dst);
+static int IIDBI_paramWideReserve(IIDBI_STMT *IIDBIpstmt, int count, 
+    Py_ssize_t used, Py_ssize_t need);
+int IIDBI_sendParameterArray(IIDBI_CURSOR *self, PyObject *rows, int start,
+    int count);
+static int IIDBI_paramArrayType(PyObject *elem);
+static int IIDBI_paramArrayScan(PyObject *elem, int *type, int *maxLen,
+    int *maxDigits, int *maxScale);
+static void IIDBI_paramArrayDescribe(IIDBI_DESCRIPTOR *desc, int type, 
+    int maxLen, int maxDigits, int maxScale);
+static int IIDBI_paramArrayStore(IIDBI_DESCRIPTOR *desc, int j, 
+    PyObject *elem);
+int IIDBI_sendColumnArray(IIDBI_CURSOR *self, IIDBI_PARAMCOLUMN *columns,
+    int parmCount, int start, int count);
+static int IIDBI_paramBufferType(char *format, Py_ssize_t itemSize, 
+    int *cType, int *type);
+static int IIDBI_paramColumnInit(IIDBI_PARAMCOLUMN *column, 
+    PyObject *source, Py_ssize_t *count);
+static int IIDBI_paramColumnCheck(IIDBI_PARAMCOLUMN *column, 
+    Py_ssize_t end, char **data);
+static PyObject *IIDBI_paramColumnItem(IIDBI_PARAMCOLUMN *column, 
+    char *data, Py_ssize_t j);
+static void IIDBI_paramColumnRelease(IIDBI_PARAMCOLUMN *columns, int count);
+static int IIDBI_paramSetSendRows(IIDBI_PARAMSET *set, IIDBI_CURSOR *self,
+    int start, int count);
+static PyObject *IIDBI_paramSetGetRow(IIDBI_PARAMSET *set, 
+    IIDBI_CURSOR *self, Py_ssize_t row, int *result);
+static int IIDBI_paramSetSendColumns(IIDBI_PARAMSET *set, 
+    IIDBI_CURSOR *self, int start, int count);
+static PyObject *IIDBI_paramSetColumnRow(IIDBI_PARAMSET *set, 
+    IIDBI_CURSOR *self, Py_ssize_t row, int *result);
+static void IIDBI_releaseParameters(IIDBI_STMT *IIDBIpstmt, int prepareForced);
+static PyObject *IIDBI_lobReaderNew(IIDBI_CURSOR *cursor, 
+    IIDBI_STMT *IIDBIpstmt, IIDBI_DESCRIPTOR *desc);
+static int IIDBI_lobReaderCheck(IIDBI_LOBREADER *self, int *result);
+static PyObject *IIDBI_lobReaderGet(IIDBI_LOBREADER *self, long size, 
+    int *result);
+static PyObject *IIDBI_lobReaderRead(IIDBI_LOBREADER *self, PyObject *args);
+static PyObject *IIDBI_lobReaderClose(IIDBI_LOBREADER *self);
+static PyObject *IIDBI_lobReaderIterNext(IIDBI_LOBREADER *self);
+static void IIDBI_lobReaderDestructor(IIDBI_LOBREADER *self);
+static void IIDBI_asyncExecWorker(void *arg);
+static PyObject *IIDBI_asyncExecFinish(IIDBI_ASYNCEXEC *self, int end);
+static int IIDBI_asyncExecJoin(IIDBI_CURSOR *cursor, int end);
+static PyObject *IIDBI_asyncExecDone(IIDBI_ASYNCEXEC *self);
+static PyObject *IIDBI_asyncExecWait(IIDBI_ASYNCEXEC *self, PyObject *args);
+static PyObject *IIDBI_asyncExecFileno(IIDBI_ASYNCEXEC *self);
+static void IIDBI_asyncExecDestructor(IIDBI_ASYNCEXEC *self);
+static PyObject *IIDBI_poolNew(PyTypeObject *type, PyObject *args, 
+    PyObject *keywords);
+static PyObject *IIDBI_poolConnect(IIDBI_POOL *self, PyObject *args);
+static PyObject *IIDBI_poolClose(IIDBI_POOL *self);
+static PyObject *IIDBI_poolGetStats(IIDBI_POOL *self, void *closure);
+static void IIDBI_poolRelease(IIDBI_CONNECTION *conn);
+static IIDBI_CONNECTION *IIDBI_poolOpen(IIDBI_POOL *pool);
+static IIDBI_CONNECTION *IIDBI_poolWrap(IIDBI_POOL *pool, IIDBI_DBC *pdbc);
+static IIDBI_DBC *IIDBI_poolDetach(IIDBI_CONNECTION *conn);
+static void IIDBI_poolHandOff(IIDBI_POOL *pool, IIDBI_DBC *pdbc);
+static void IIDBI_poolDrop(IIDBI_POOL *pool);
+static void IIDBI_poolGrant(IIDBI_POOL *pool, IIDBI_DBC *pdbc);
+static int IIDBI_poolWait(IIDBI_POOL *pool, IIDBI_POOLWAITER *waiter,
+    double seconds);
+static void IIDBI_poolPrune(IIDBI_POOL *pool, int all);
+static void IIDBI_poolDisconnect(IIDBI_POOL *pool, IIDBI_DBC *pdbc);
+static void IIDBI_poolDestructor(IIDBI_POOL *self);
+static char *IIDBI_columnBufferFormat(int type);
+static PyObject *IIDBI_columnBufferNew(IIDBI_DESCRIPTOR *descriptor, 
+    char *data, int start, int count);
+static void IIDBI_columnBufferDestructor(IIDBI_COLUMNBUFFER *self);
+static Py_ssize_t IIDBI_columnBufferLength(IIDBI_COLUMNBUFFER *self);
+static PyObject *IIDBI_columnBufferItem(IIDBI_COLUMNBUFFER *self, 
+    Py_ssize_t i);
+static Py_ssize_t IIDBI_columnBufferRead(IIDBI_COLUMNBUFFER *self, 
+    Py_ssize_t segment, void **ptr);
+static Py_ssize_t IIDBI_columnBufferSegments(IIDBI_COLUMNBUFFER *self, 
+    Py_ssize_t *lenp);
+#ifdef Py_TPFLAGS_HAVE_NEWBUFFER
+static int IIDBI_columnBufferGet(IIDBI_COLUMNBUFFER *self, Py_buffer *view,
+    int flags);
+#endif
+static IIDBI_PUTSTREAM *IIDBI_putSourceNew(PyObject *elem);
+static int IIDBI_putSourceRead(IIDBI_PUTSTREAM *stream, int size, 
+    char **data, SQLLEN *len);
+static void IIDBI_putSourceRelease(IIDBI_PUTSTREAM *stream);
+static char *IIDBI_lobGrow(IIDBI_DESCRIPTOR *desc, char *buf, SQLLEN count,
+    SQLLEN size);
+static void IIDBI_lobDrop(IIDBI_DESCRIPTOR *desc);
+static int IIDBI_decimalModeArg(char *arg);
+static PyObject *IIDBI_decimalFromChar(char *data, int mode);
+static int IIDBI_decimalToChar(PyObject *value, char *buf, int bufLen, 
+    int *precision, int *scale);
+static int IIDBI_convertResolve(IIDBI_CURSOR *self, IIDBI_STMT *IIDBIpstmt, 
+    char **errMsg);
+static void IIDBI_convertRelease(IIDBI_CURSOR *self);
+static PyObject *IIDBI_convertLookup(PyObject *converters, int column, 
+    char *typeName);
+static char *IIDBI_convertTypeName(int type);
+static PyObject *IIDBI_convertColumn(IIDBI_DESCRIPTOR *descriptor, int mode,
+    PyObject *call);
+static PyObject *IIDBI_convertScaled(IIDBI_DESCRIPTOR *descriptor);
+static PyObject *IIDBI_cursorBuildValue(IIDBI_CURSOR *self, 
+    IIDBI_STMT *IIDBIpstmt, int i, int decimalMode, int *result);
+static int IIDBI_fetchColumnPut(IIDBI_FETCHCOLUMN *column, 
+    IIDBI_DESCRIPTOR *descriptor);
+static int IIDBI_fetchColumnList(IIDBI_FETCHCOLUMN *column);
+static PyObject *IIDBI_fetchColumnResult(IIDBI_FETCHCOLUMN *column);
+static void IIDBI_fetchColumnFree(IIDBI_FETCHCOLUMN *columns, int count);
 
 /*
 ** Get/Setters
@@ -373,21 +732,61 @@ static PyObject *IIDBI_connGetErrorHandler(IIDBI_CONNECTION *self,
     void *closure); 
 static int IIDBI_connSetErrorHandler(IIDBI_CONNECTION *self, PyObject *value, 
     void *closure);
+static PyObject *IIDBI_connGetDecimal(IIDBI_CONNECTION *self, 
+    void *closure); 
+static int IIDBI_connSetDecimal(IIDBI_CONNECTION *self, PyObject *value, 
+    void *closure);
+static PyObject *IIDBI_connGetConverters(IIDBI_CONNECTION *self, 
+    void *closure); 
+static int IIDBI_connSetConverters(IIDBI_CONNECTION *self, PyObject *value, 
+    void *closure);
 static PyObject *IIDBI_cursorGetPrepared(IIDBI_CURSOR *self, 
     void *closure); 
 static int IIDBI_cursorSetPrepared(IIDBI_CURSOR *self, PyObject *value, 
     void *closure);
+static PyObject *IIDBI_cursorGetLobStreaming(IIDBI_CURSOR *self, 
+    void *closure); 
+static int IIDBI_cursorSetLobStreaming(IIDBI_CURSOR *self, PyObject *value, 
+    void *closure);
+static PyObject *IIDBI_cursorGetPrefetch(IIDBI_CURSOR *self, 
+    void *closure); 
+static int IIDBI_cursorSetPrefetch(IIDBI_CURSOR *self, PyObject *value, 
+    void *closure);
+static PyObject *IIDBI_cursorGetTimeout(IIDBI_CURSOR *self, 
+    void *closure); 
+static int IIDBI_cursorSetTimeout(IIDBI_CURSOR *self, PyObject *value, 
+    void *closure);
+static PyObject *IIDBI_connGetTimeout(IIDBI_CONNECTION *self, 
+    void *closure); 
+static int IIDBI_connSetTimeout(IIDBI_CONNECTION *self, PyObject *value, 
+    void *closure);
+static int IIDBI_timeoutArg(PyObject *value, long *seconds);
+static PyObject *IIDBI_cursorGetConverters(IIDBI_CURSOR *self, 
+    void *closure); 
+static int IIDBI_cursorSetConverters(IIDBI_CURSOR *self, PyObject *value, 
+    void *closure);
 
 int checkBooleanArg(char *arg);
 int IIDBI_mapType(int type);
 
 /*
-** Globally shared environment
+** Globally shared environments, for non-pooled [0] and pooled [1]
+** connections.
 */
-IIDBI_ENV IIDBIenv;
+IIDBI_ENV IIDBIenv[2];
 
 static PyObject *IIDBI_module = NULL;
+static IIDBI_LOBALLOC IIDBI_lobAlloc = { IIDBI_lobGrow, IIDBI_lobDrop };
 static PyObject *decimalType;
+static PyObject *arrayType;
+static char *decimalModes[] =
+{
+    "decimal", "float", "int", "string"
+};
+static char *convertModeNames[] =
+{
+    "default", "string", "bytes", "int", "float"
+};
 
 static char ingresdbi_doc[] = 
 "The ingresdbi module is a DBI driver intended for Ingres databases, \n" \
@@ -454,6 +853,15 @@ static PyMethodDef IIDBI_cursorMethods[] =
     { 
         "executemany", (PyCFunction)IIDBI_cursorExecuteMany, METH_VARARGS, "Executemany" 
     },
+    { 
+        "executecolumns", (PyCFunction)IIDBI_cursorExecuteColumns, METH_VARARGS, "Executecolumns" 
+    },
+    { 
+        "execute_async", (PyCFunction)IIDBI_cursorExecuteAsync, METH_VARARGS, "Execute_async" 
+    },
+    { 
+        "cancel", (PyCFunction)IIDBI_cursorCancel, METH_NOARGS, "Cancel" 
+    },
     { 
         "callproc", (PyCFunction)IIDBI_cursorCallProc, METH_VARARGS, "Callproc" 
     },
@@ -466,6 +874,12 @@ static PyMethodDef IIDBI_cursorMethods[] =
     { 
         "fetchmany", (PyCFunction)IIDBI_cursorFetchMany, METH_VARARGS, "Fetchmany" 
     },
+    { 
+        "fetchcolumns", (PyCFunction)IIDBI_cursorFetchColumns, METH_VARARGS, "Fetchcolumns" 
+    },
+    { 
+        "fetchbuffers", (PyCFunction)IIDBI_cursorFetchBuffers, METH_NOARGS, "Fetchbuffers" 
+    },
     { 
         "close", (PyCFunction)IIDBI_cursorClose, METH_NOARGS, "Close" 
     },
@@ -545,6 +959,30 @@ static PyGetSetDef IIDBI_cursorGetSetters[] =
         "ingresdbi.cursor.prepared",
         NULL
     },
+    {
+        "lobstreaming",
+        (getter)IIDBI_cursorGetLobStreaming, (setter)IIDBI_cursorSetLobStreaming,
+        "ingresdbi.cursor.lobstreaming",
+        NULL
+    },
+    {
+        "prefetch",
+        (getter)IIDBI_cursorGetPrefetch, (setter)IIDBI_cursorSetPrefetch,
+        "ingresdbi.cursor.prefetch",
+        NULL
+    },
+    {
+        "timeout",
+        (getter)IIDBI_cursorGetTimeout, (setter)IIDBI_cursorSetTimeout,
+        "ingresdbi.cursor.timeout",
+        NULL
+    },
+    {
+        "converters",
+        (getter)IIDBI_cursorGetConverters, (setter)IIDBI_cursorSetConverters,
+        "ingresdbi.cursor.converters",
+        NULL
+    },
     {
         NULL
     }  /* Sentinel */
@@ -624,6 +1062,24 @@ static PyGetSetDef IIDBI_connGetSetters[] =
         "ingresdbi.connection.errorhandler",
         NULL
     },
+    {
+        "decimal",
+        (getter)IIDBI_connGetDecimal, (setter)IIDBI_connSetDecimal,
+        "ingresdbi.connection.decimal",
+        NULL
+    },
+    {
+        "timeout",
+        (getter)IIDBI_connGetTimeout, (setter)IIDBI_connSetTimeout,
+        "ingresdbi.connection.timeout",
+        NULL
+    },
+    {
+        "converters",
+        (getter)IIDBI_connGetConverters, (setter)IIDBI_connSetConverters,
+        "ingresdbi.connection.converters",
+        NULL
+    },
     {
         NULL
     }  /* Sentinel */
@@ -717,6 +1173,301 @@ static PyTypeObject IIDBI_cursorType =
     0                                /* tp_new */
 };
 
+static PyMethodDef IIDBI_lobReaderMethods[] = 
+{
+    { 
+        "read", (PyCFunction)IIDBI_lobReaderRead, METH_VARARGS, "Read([size])" 
+    },
+    { 
+        "close", (PyCFunction)IIDBI_lobReaderClose, METH_NOARGS, "Close" 
+    },
+    { NULL, NULL, 0, NULL }
+};
+
+static PyMemberDef IIDBI_lobReaderMembers[] = 
+{
+    {
+        "closed", T_UBYTE, offsetof(IIDBI_LOBREADER, closed), 
+        READONLY,
+        "iidbi LOB reader closed"
+    },
+    {
+        NULL
+    }  /* Sentinel */
+};
+
+static PyTypeObject IIDBI_lobReaderType = 
+{
+    PyObject_HEAD_INIT(NULL)
+    0,                              /*ob_size*/
+    "Ingres DBI LOB reader type",   /*tp_name*/
+    sizeof(IIDBI_LOBREADER),        /*tp_basicsize*/
+    0,                              /*tp_itemsize*/
+    /* methods */
+    (destructor)IIDBI_lobReaderDestructor,  /*tp_dealloc*/
+    (printfunc)0,                   /*tp_print*/
+    (getattrfunc)0,                 /*tp_getattr*/
+    (setattrfunc)0,                 /*tp_setattr*/
+    (cmpfunc)0,                     /*tp_compare*/
+    (reprfunc)0,                    /*tp_repr*/
+    0,                              /* tp_as_number*/
+    0,                              /* tp_as_sequence*/
+    0,                              /* tp_as_mapping*/
+    (hashfunc)0,                    /*tp_hash*/
+    (ternaryfunc)0,                 /*tp_call*/
+    (reprfunc)0,                    /*tp_str*/
+    (getattrofunc)0,                /*tp_getattro*/
+    0,                              /*tp_setattro*/
+    0,                              /*tp_as_buffer*/
+    Py_TPFLAGS_DEFAULT,             /*tp_flags*/
+    "Ingres LOB reader, a file-like object for a LONG column", /* Documentation string */
+    0,                               /* tp_traverse */
+    0,                               /* tp_clear */
+    0,                               /* tp_richcompare */
+    0,                               /* tp_weaklistoffset */
+    (getiterfunc) PyObject_SelfIter, /* tp_iter */
+    (iternextfunc) IIDBI_lobReaderIterNext,/* tp_iternext */
+    IIDBI_lobReaderMethods,          /* tp_methods */
+    IIDBI_lobReaderMembers,          /* tp_members */
+    0,                               /* tp_getset */
+    0,                               /* tp_base */
+    0,                               /* tp_dict */
+    0,                               /* tp_descr_get */
+    0,                               /* tp_descr_set */
+    0,                               /* tp_dictoffset */
+    0,                               /* tp_init */
+    0,                               /* tp_alloc */
+    0                                /* tp_new */
+};
+
+static PyMethodDef IIDBI_asyncExecMethods[] = 
+{
+    { 
+        "done", (PyCFunction)IIDBI_asyncExecDone, METH_NOARGS, "Done" 
+    },
+    { 
+        "wait", (PyCFunction)IIDBI_asyncExecWait, METH_VARARGS, "Wait([timeout])" 
+    },
+    { 
+        "fileno", (PyCFunction)IIDBI_asyncExecFileno, METH_NOARGS, "Fileno" 
+    },
+    { NULL, NULL, 0, NULL }
+};
+
+static PyTypeObject IIDBI_asyncExecType = 
+{
+    PyObject_HEAD_INIT(NULL)
+    0,                              /*ob_size*/
+    "Ingres DBI asynchronous execute type", /*tp_name*/
+    sizeof(IIDBI_ASYNCEXEC),        /*tp_basicsize*/
+    0,                              /*tp_itemsize*/
+    /* methods */
+    (destructor)IIDBI_asyncExecDestructor,  /*tp_dealloc*/
+    (printfunc)0,                   /*tp_print*/
+    (getattrfunc)0,                 /*tp_getattr*/
+    (setattrfunc)0,                 /*tp_setattr*/
+    (cmpfunc)0,                     /*tp_compare*/
+    (reprfunc)0,                    /*tp_repr*/
+    0,                              /* tp_as_number*/
+    0,                              /* tp_as_sequence*/
+    0,                              /* tp_as_mapping*/
+    (hashfunc)0,                    /*tp_hash*/
+    (ternaryfunc)0,                 /*tp_call*/
+    (reprfunc)0,                    /*tp_str*/
+    (getattrofunc)0,                /*tp_getattro*/
+    0,                              /*tp_setattro*/
+    0,                              /*tp_as_buffer*/
+    Py_TPFLAGS_DEFAULT,             /*tp_flags*/
+    "Ingres asynchronous execute, returned by cursor.execute_async()", /* Documentation string */
+    0,                               /* tp_traverse */
+    0,                               /* tp_clear */
+    0,                               /* tp_richcompare */
+    0,                               /* tp_weaklistoffset */
+    0,                               /* tp_iter */
+    0,                               /* tp_iternext */
+    IIDBI_asyncExecMethods,          /* tp_methods */
+    0,                               /* tp_members */
+    0,                               /* tp_getset */
+    0,                               /* tp_base */
+    0,                               /* tp_dict */
+    0,                               /* tp_descr_get */
+    0,                               /* tp_descr_set */
+    0,                               /* tp_dictoffset */
+    0,                               /* tp_init */
+    0,                               /* tp_alloc */
+    0                                /* tp_new */
+};
+
+static PyMethodDef IIDBI_poolMethods[] = 
+{
+    { 
+        "connect", (PyCFunction)IIDBI_poolConnect, METH_VARARGS, "Connect([timeout])" 
+    },
+    { 
+        "close", (PyCFunction)IIDBI_poolClose, METH_NOARGS, "Close" 
+    },
+    { NULL, NULL, 0, NULL }
+};
+
+static PyMemberDef IIDBI_poolMembers[] = 
+{
+    {
+        "closed", T_UBYTE, offsetof(IIDBI_POOL, closed), 
+        READONLY,
+        "iidbi connection pool closed"
+    },
+    {
+        NULL
+    }  /* Sentinel */
+};
+
+static PyGetSetDef IIDBI_poolGetSetters[] = 
+{
+    {
+        "stats",
+        (getter)IIDBI_poolGetStats, (setter)0,
+        "ingresdbi.ConnectionPool.stats",
+        NULL
+    },
+    {
+        NULL
+    }  /* Sentinel */
+};
+
+static PyTypeObject IIDBI_poolType = 
+{
+    PyObject_HEAD_INIT(NULL)
+    0,                              /*ob_size*/
+    "Ingres DBI connection pool type", /*tp_name*/
+    sizeof(IIDBI_POOL),             /*tp_basicsize*/
+    0,                              /*tp_itemsize*/
+    /* methods */
+    (destructor)IIDBI_poolDestructor,  /*tp_dealloc*/
+    (printfunc)0,                   /*tp_print*/
+    (getattrfunc)0,                 /*tp_getattr*/
+    (setattrfunc)0,                 /*tp_setattr*/
+    (cmpfunc)0,                     /*tp_compare*/
+    (reprfunc)0,                    /*tp_repr*/
+    0,                              /* tp_as_number*/
+    0,                              /* tp_as_sequence*/
+    0,                              /* tp_as_mapping*/
+    (hashfunc)0,                    /*tp_hash*/
+    (ternaryfunc)0,                 /*tp_call*/
+    (reprfunc)0,                    /*tp_str*/
+    (getattrofunc)0,                /*tp_getattro*/
+    0,                              /*tp_setattro*/
+    0,                              /*tp_as_buffer*/
+    Py_TPFLAGS_DEFAULT,             /*tp_flags*/
+    "Ingres connection pool, ConnectionPool([minsize, maxsize, idletimeout, validate,] connect() arguments)", /* Documentation string */
+    0,                               /* tp_traverse */
+    0,                               /* tp_clear */
+    0,                               /* tp_richcompare */
+    0,                               /* tp_weaklistoffset */
+    0,                               /* tp_iter */
+    0,                               /* tp_iternext */
+    IIDBI_poolMethods,               /* tp_methods */
+    IIDBI_poolMembers,               /* tp_members */
+    IIDBI_poolGetSetters,            /* tp_getset */
+    0,                               /* tp_base */
+    0,                               /* tp_dict */
+    0,                               /* tp_descr_get */
+    0,                               /* tp_descr_set */
+    0,                               /* tp_dictoffset */
+    0,                               /* tp_init */
+    0,                               /* tp_alloc */
+    (newfunc)IIDBI_poolNew           /* tp_new */
+};
+
+static PySequenceMethods IIDBI_columnBufferSequence = 
+{
+    (lenfunc)IIDBI_columnBufferLength,     /* sq_length */
+    0,                                     /* sq_concat */
+    0,                                     /* sq_repeat */
+    (ssizeargfunc)IIDBI_columnBufferItem,  /* sq_item */
+};
+
+static PyBufferProcs IIDBI_columnBufferProcs = 
+{
+    (readbufferproc)IIDBI_columnBufferRead,     /* bf_getreadbuffer */
+    0,                                          /* bf_getwritebuffer */
+    (segcountproc)IIDBI_columnBufferSegments,   /* bf_getsegcount */
+    (charbufferproc)IIDBI_columnBufferRead,     /* bf_getcharbuffer */
+#ifdef Py_TPFLAGS_HAVE_NEWBUFFER
+    (getbufferproc)IIDBI_columnBufferGet,       /* bf_getbuffer */
+    0,                                          /* bf_releasebuffer */
+#endif
+};
+
+static PyMemberDef IIDBI_columnBufferMembers[] = 
+{
+    {
+        "format", T_STRING, offsetof(IIDBI_COLUMNBUFFER, format), 
+        READONLY,
+        "iidbi column buffer struct format of a value"
+    },
+    {
+        "nulls", T_OBJECT, offsetof(IIDBI_COLUMNBUFFER, nulls), 
+        READONLY,
+        "iidbi column buffer NULL bitmap"
+    },
+    {
+        "nullcount", T_INT, offsetof(IIDBI_COLUMNBUFFER, nullCount), 
+        READONLY,
+        "iidbi column buffer number of NULLs"
+    },
+    {
+        NULL
+    }  /* Sentinel */
+};
+
+static PyTypeObject IIDBI_columnBufferType = 
+{
+    PyObject_HEAD_INIT(NULL)
+    0,                              /*ob_size*/
+    "Ingres DBI column buffer type", /*tp_name*/
+    sizeof(IIDBI_COLUMNBUFFER),     /*tp_basicsize*/
+    0,                              /*tp_itemsize*/
+    /* methods */
+    (destructor)IIDBI_columnBufferDestructor,  /*tp_dealloc*/
+    (printfunc)0,                   /*tp_print*/
+    (getattrfunc)0,                 /*tp_getattr*/
+    (setattrfunc)0,                 /*tp_setattr*/
+    (cmpfunc)0,                     /*tp_compare*/
+    (reprfunc)0,                    /*tp_repr*/
+    0,                              /* tp_as_number*/
+    &IIDBI_columnBufferSequence,    /* tp_as_sequence*/
+    0,                              /* tp_as_mapping*/
+    (hashfunc)0,                    /*tp_hash*/
+    (ternaryfunc)0,                 /*tp_call*/
+    (reprfunc)0,                    /*tp_str*/
+    (getattrofunc)0,                /*tp_getattro*/
+    0,                              /*tp_setattro*/
+    &IIDBI_columnBufferProcs,       /*tp_as_buffer*/
+#ifdef Py_TPFLAGS_HAVE_NEWBUFFER
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_NEWBUFFER, /*tp_flags*/
+#else
+    Py_TPFLAGS_DEFAULT,             /*tp_flags*/
+#endif
+    "Ingres column buffer, the values of a numeric column of a rowset", /* Documentation string */
+    0,                               /* tp_traverse */
+    0,                               /* tp_clear */
+    0,                               /* tp_richcompare */
+    0,                               /* tp_weaklistoffset */
+    0,                               /* tp_iter */
+    0,                               /* tp_iternext */
+    0,                               /* tp_methods */
+    IIDBI_columnBufferMembers,       /* tp_members */
+    0,                               /* tp_getset */
+    0,                               /* tp_base */
+    0,                               /* tp_dict */
+    0,                               /* tp_descr_get */
+    0,                               /* tp_descr_set */
+    0,                               /* tp_dictoffset */
+    0,                               /* tp_init */
+    0,                               /* tp_alloc */
+    0                                /* tp_new */
+};
+
 /*{
 ** Name: IIDBI_binary
 **
@@ -1162,6 +1913,11 @@ errorExit:
 **         Use MAX_PATH as the maximum path length
 **     10-Jul-08 grant.croker@ingres.com
 **         Fix string corruption for server types
+**     16-Oct-2026 (agent)
+**         Added the decimal keyword.
+**     17-Oct-2026 (agent)
+**         Take a reference to the shared environment for the pooled
+**         setting instead of allocating one.
 }*/
 
 static PyObject * IIDBI_connect(PyObject *self, PyObject *args, 
@@ -1187,6 +1943,7 @@ static PyObject * IIDBI_connect(PyObject *self, PyObject *args,
     char *dbms_pwd=NULL;
     char *connectstr=NULL;
     char *pooled=NULL;
+    char *decimal=NULL;
     PyObject *traceObject=NULL;
     int  trace = 0;
     char *traceFile=NULL;
@@ -1203,7 +1960,7 @@ static PyObject * IIDBI_connect(PyObject *self, PyObject *args,
     static char *kwlist[] = 
     {
         "dsn", "database", "vnode", "uid", "pwd", "autocommit", "selectloops",
-        "servertype","driver","rolename","rolepwd", "group", "blankdate", "date1582", "catconnect", "numeric_overflow", "catschemanull", "dbms_pwd", "connectstr", "pooled", "trace", NULL
+        "servertype","driver","rolename","rolepwd", "group", "blankdate", "date1582", "catconnect", "numeric_overflow", "catschemanull", "dbms_pwd", "connectstr", "pooled", "trace", "decimal", NULL
     };
     /* The ODBC driver is restricted to the following server classes */
     static char *servertypes[] =
@@ -1215,13 +1972,13 @@ static PyObject * IIDBI_connect(PyObject *self, PyObject *args,
     int servertypesLen = sizeof(servertypes) / sizeof(servertypes[0]);
     char *tmp_servertype;
 
-    if (!PyArg_ParseTupleAndKeywords(args, keywords, "|ssssssssssssssssssssO", kwlist, 
+    if (!PyArg_ParseTupleAndKeywords(args, keywords, "|ssssssssssssssssssssOs", kwlist, 
         &dsn, &database, &vnode, &username, &password, &autocommit,
         &selectloops, &servertype, &driver, &rolename, &rolepwd, &group,
         &blankdate, &date1582, &catconnect, &numeric_overflow, &catschemanull, 
-        &dbms_pwd, &connectstr, &pooled, &traceObject))
+        &dbms_pwd, &connectstr, &pooled, &traceObject, &decimal))
     {
-        PyErr_SetString(IIDBI_InterfaceError, "usage: connection.connect(dsn=dsnname, database=dbname, uid=username, pwd=password, autocommit=Y|N, selectloops=Y|N, servertype=serverType, driver=server, rolename=rolename, rolepwd=rolepwd, group=group, catconnect=Y | N, numeric_overflow=Y|N, catschmeanull=Y|N, dbms_pwd=dbms_pwd, connectstr=connectionString, pooled=Y|N, [trace=traceLevel]");
+        PyErr_SetString(IIDBI_InterfaceError, "usage: connection.connect(dsn=dsnname, database=dbname, uid=username, pwd=password, autocommit=Y|N, selectloops=Y|N, servertype=serverType, driver=server, rolename=rolename, rolepwd=rolepwd, group=group, catconnect=Y | N, numeric_overflow=Y|N, catschmeanull=Y|N, dbms_pwd=dbms_pwd, connectstr=connectionString, pooled=Y|N, [trace=traceLevel], decimal=decimal|float|int|string");
         goto errorExit;
     }
     if (traceObject)
@@ -1243,7 +2000,17 @@ static PyObject * IIDBI_connect(PyObject *self, PyObject *args,
     if ((conn = IIDBI_connConstructor()) != NULL)
     {
         conn->trace = trace;
-        if (connectstr)
+        if (decimal)
+        {
+            i = IIDBI_decimalModeArg(decimal);
+            if (i < 0)
+            {
+                PyErr_SetString(IIDBI_InterfaceError, "Invalid decimal.\nMust be one of decimal, float, int, string");
+                goto errorExit;
+            }
+            conn->decimalMode = (unsigned char)i;
+        }
+        if (connectstr)
             conn->connectstr = strdup(connectstr);
         else
         {
@@ -1313,7 +2080,7 @@ static PyObject * IIDBI_connect(PyObject *self, PyObject *args,
         }  /* if (connectstr) */
         
         IIDBIpdbc->conn = (void *)conn;
-        if (!IIDBIenv.hdr.handle)
+        if (!IIDBIenv[0].hdr.handle && !IIDBIenv[1].hdr.handle)
         {
 #ifndef WIN32
             /* The Ingres ODBC CLI expects /usr/local/etc/odbcinst.ini to exist */
@@ -1348,19 +2115,13 @@ static PyObject * IIDBI_connect(PyObject *self, PyObject *args,
                 }
             }
 #endif
-            rc = dbi_alloc_env(&IIDBIenv, IIDBIpdbc);
-   
-            if (rc != DBI_SQL_SUCCESS)
-            {
-                result = IIDBI_mapError2exception((PyObject *)self,
-                    &IIDBIpdbc->hdr.err, rc, NULL);
-                goto errorExit;
-            }
-            IIDBIpdbc->env = IIDBIenv.hdr.handle;
         }
-        else
+        rc = IIDBI_envAcquire(IIDBIpdbc);
+        if (rc != DBI_SQL_SUCCESS)
         {
-            IIDBIpdbc->env = IIDBIenv.hdr.handle;
+            result = IIDBI_mapError2exception((PyObject *)conn,
+                &IIDBIpdbc->hdr.err, rc, NULL);
+            goto errorExit;
         }
 
         Py_BEGIN_ALLOW_THREADS
@@ -1368,6 +2129,7 @@ static PyObject * IIDBI_connect(PyObject *self, PyObject *args,
         Py_END_ALLOW_THREADS
         if (rc != DBI_SQL_SUCCESS)
         {
+            IIDBI_envRelease(IIDBIpdbc);
             result = IIDBI_mapError2exception((PyObject *)conn, &IIDBIpdbc->hdr.err, 
                 rc, NULL); 
             goto errorExit;
@@ -1395,6 +2157,138 @@ errorExit:
     return NULL;
 }
 
+/*{
+** Name: IIDBI_envAcquire
+**
+** Description:
+**     Take a reference to the shared ODBC environment for the
+**     connection's pooled setting, allocating it on first use. The
+**     first reference is the module's, dropped by IIDBI_envExit().
+**
+** Inputs:
+**     pdbc - DBI connection handle.
+**
+** Outputs:
+**     pdbc->env - ODBC environment handle.
+**
+** Returns:
+**     DBI_SQL_SUCCESS, or the error from dbi_alloc_env() in pdbc.
+**
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     Called with the GIL held, which serializes IIDBIenv.
+**
+** History:
+**     17-Oct-2026 (agent)
+**         Created.
+}*/
+
+static RETCODE IIDBI_envAcquire(IIDBI_DBC *pdbc)
+{
+    IIDBI_CONNECTION *conn = pdbc->conn;
+    IIDBI_ENV *penv = &IIDBIenv[conn->pooled ? 1 : 0];
+    RETCODE rc;
+
+    if (!penv->hdr.handle)
+    {
+        rc = dbi_alloc_env(penv, pdbc);
+        if (rc != DBI_SQL_SUCCESS)
+        {
+            dbi_free_env(penv);
+            return rc;
+        }
+        penv->refCount = 1;
+    }
+    penv->refCount++;
+    pdbc->env = penv->hdr.handle;
+    return DBI_SQL_SUCCESS;
+}
+
+/*{
+** Name: IIDBI_envRelease
+**
+** Description:
+**     Drop a connection's reference to its ODBC environment. The
+**     connection must be closed.
+**
+** Inputs:
+**     pdbc - DBI connection handle.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None.
+**
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     pdbc->env is cleared. The environment is freed with its last
+**     reference.
+**
+** History:
+**     17-Oct-2026 (agent)
+**         Created.
+}*/
+
+static void IIDBI_envRelease(IIDBI_DBC *pdbc)
+{
+    int i;
+
+    for (i = 0; i < 2 && pdbc->env; i++)
+    {
+        if (pdbc->env == IIDBIenv[i].hdr.handle)
+        {
+            if (--IIDBIenv[i].refCount == 0)
+                dbi_free_env(&IIDBIenv[i]);
+            break;
+        }
+    }
+    pdbc->env = NULL;
+}
+
+/*{
+** Name: IIDBI_envExit
+**
+** Description:
+**     Drop the module's references to the shared ODBC environments at
+**     interpreter exit. Environments of connections still open are
+**     left to the process exit.
+**
+** Inputs:
+**     None.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None.
+**
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     Registered with Py_AtExit(), runs without the Python API.
+**
+** History:
+**     17-Oct-2026 (agent)
+**         Created.
+}*/
+
+static void IIDBI_envExit(void)
+{
+    int i;
+
+    for (i = 0; i < 2; i++)
+    {
+        if (IIDBIenv[i].hdr.handle && --IIDBIenv[i].refCount == 0)
+            dbi_free_env(&IIDBIenv[i]);
+    }
+}
+
 /*{
 ** Name: IIDBI_connConstructor
 **
@@ -1419,6 +2313,12 @@ errorExit:
 ** History:
 **     26-May-06 Ralph.Loen@ingres.com
 **         Created.
+**     16-Oct-2026 (agent)
+**         Initialize asyncPending.
+**     16-Oct-2026 (agent)
+**         Initialize timeout.
+**     17-Oct-2026 (agent)
+**         Initialize the cursor list and pool.
 }*/
 
 static IIDBI_CONNECTION *IIDBI_connConstructor()
@@ -1455,6 +2355,12 @@ static IIDBI_CONNECTION *IIDBI_connConstructor()
         conn->connectstr = NULL;
         conn->trace = 0;
         conn->pooled = FALSE;
+        conn->decimalMode = IIDBI_DECIMAL_DECIMAL;
+        conn->converters = NULL;
+        conn->asyncPending = 0;
+        conn->timeout = 0;
+        conn->cursors = NULL;
+        conn->pool = NULL;
 
         conn->Error = IIDBI_Error;
         Py_INCREF(conn->Error);
@@ -1519,6 +2425,8 @@ static IIDBI_CONNECTION *IIDBI_connConstructor()
 ** History:
 **     26-May-06 Ralph.Loen@ingres.com
 **         Created.
+**     17-Oct-2026 (agent)
+**         Add the cursor to the connection's open cursors.
 }*/
 
 static PyObject *IIDBI_connCursor(IIDBI_CONNECTION *self)
@@ -1543,6 +2451,10 @@ static PyObject *IIDBI_connCursor(IIDBI_CONNECTION *self)
         cursor->connection = self;
         Py_INCREF(cursor->connection);
         cursor->closed = FALSE;
+        cursor->nextCursor = self->cursors;
+        if (self->cursors)
+            self->cursors->prevCursor = cursor;
+        self->cursors = cursor;
         goto exitLabel;
     }
     else
@@ -1591,6 +2503,20 @@ errorExit:
 ** History:
 **     26-May-06 Ralph.Loen@ingres.com
 **         Created.
+**     16-Oct-2026 (agent)
+**         Initialize lobStreaming.
+**     16-Oct-2026 (agent)
+**         Initialize the output converters.
+**     16-Oct-2026 (agent)
+**         Initialize the parameter kind cache.
+**     16-Oct-2026 (agent)
+**         Initialize prefetch.
+**     16-Oct-2026 (agent)
+**         Initialize asyncExec.
+**     16-Oct-2026 (agent)
+**         Initialize timeout.
+**     17-Oct-2026 (agent)
+**         Initialize the connection's cursor list links.
 }*/
 
 static IIDBI_CURSOR *IIDBI_cursorConstructor()
@@ -1608,6 +2534,8 @@ static IIDBI_CURSOR *IIDBI_cursorConstructor()
         cursor->arraysize = 1;
         cursor->IIDBIpstmt = NULL;
         cursor->closed = 0;
+        cursor->iterWarned = FALSE;
+        cursor->nextWarned = FALSE;
         cursor->description = Py_None;
         Py_INCREF(cursor->description);
         cursor->inputSegmentSize = NULL;
@@ -1621,6 +2549,19 @@ static IIDBI_CURSOR *IIDBI_cursorConstructor()
         Py_INCREF(cursor->prepared);
         cursor->prepareRequested = FALSE;
         cursor->szSqlStr = NULL;
+        cursor->lobStreaming = FALSE;
+        cursor->converters = NULL;
+        cursor->convertModes = NULL;
+        cursor->convertCalls = NULL;
+        cursor->convertCount = 0;
+        cursor->paramTypes = NULL;
+        cursor->paramKinds = NULL;
+        cursor->paramKindCount = 0;
+        cursor->prefetch = FALSE;
+        cursor->asyncExec = NULL;
+        cursor->timeout = -1;
+        cursor->prevCursor = NULL;
+        cursor->nextCursor = NULL;
     }
     else
         goto errorExit;
@@ -1996,6 +2937,8 @@ static int IIDBI_cursorSetLastRowId(IIDBI_CURSOR *self, PyObject *value,
 ** History:
 **     26-May-06 Ralph.Loen@ingres.com
 **         Created.
+**     16-Oct-2026 (agent)
+**         Release the output converters.
 }*/
 
 static void IIDBI_cursorDestructor(IIDBI_CURSOR *self)
@@ -2011,6 +2954,8 @@ static void IIDBI_cursorDestructor(IIDBI_CURSOR *self)
     Py_XDECREF(self->messages);
     Py_XDECREF(self->errorhandler);
     Py_XDECREF(self->prepared);
+    Py_XDECREF(self->converters);
+    IIDBI_convertRelease(self);
 
     DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorDestructor }}}1\n", self);
 
@@ -2085,6 +3030,25 @@ static int IIDBI_cursorPrint(IIDBI_CURSOR *self, FILE *fp, int flags)
 ** History:
 **     26-May-06 Ralph.Loen@ingres.com
 **         Created.
+**     16-Oct-2026 (agent)
+**         Register the LOB reader type.
+**     16-Oct-2026 (agent)
+**         Look up the Decimal slots used by IIDBI_decimalFromChar() and
+**         IIDBI_decimalToChar().
+**     16-Oct-2026 (agent)
+**         Look up array.array for cursor.fetchcolumns().
+**     16-Oct-2026 (agent)
+**         Register the column buffer type.
+**     17-Oct-2026 (agent)
+**         Register ConnectionPool.
+**     17-Oct-2026 (agent)
+**         Register IIDBI_envExit() instead of clearing IIDBIenv.
+**     17-Oct-2026 (agent)
+**         Call PyEval_InitThreads() for the worker threads.
+**     17-Oct-2026 (agent)
+**         No longer look up the Decimal slots.
+**     17-Oct-2026 (agent)
+**         Set the allocator of LONG column values.
 }*/
 
 PyMODINIT_FUNC SQL_API initingresdbi(void)
@@ -2098,6 +3062,7 @@ PyMODINIT_FUNC SQL_API initingresdbi(void)
     int datetime = DBI_DATETIME_TYPE;
     int rowid = DBI_ROWID_TYPE;
     PyObject *decimalmod;
+    PyObject *arraymod;
 
     char *version= DBIVERSION;
 
@@ -2105,6 +3070,13 @@ PyMODINIT_FUNC SQL_API initingresdbi(void)
         PyType_Ready(&IIDBI_cursorType) < 0)
         return;
 
+    /*
+    ** The prefetch and execute_async() workers call back into Python
+    ** with PyGILState_Ensure(), which needs the GIL to exist.
+    */
+    PyEval_InitThreads();
+    dbi_lobAllocator(&IIDBI_lobAlloc);
+
     IIDBI_module = Py_InitModule3( "ingresdbi", IIDBI_methods, ingresdbi_doc);
 
     PyModule_AddStringConstant(IIDBI_module, "apilevel", apilevel);
@@ -2134,6 +3106,34 @@ PyMODINIT_FUNC SQL_API initingresdbi(void)
     PyModule_AddObject(IIDBI_module, "cursor", 
          (PyObject *)&IIDBI_cursorType);
 
+    if (PyType_Ready(&IIDBI_lobReaderType) < 0)
+        return;
+
+    Py_INCREF(&IIDBI_lobReaderType);
+    PyModule_AddObject(IIDBI_module, "lobreader", 
+         (PyObject *)&IIDBI_lobReaderType);
+
+    if (PyType_Ready(&IIDBI_columnBufferType) < 0)
+        return;
+
+    Py_INCREF(&IIDBI_columnBufferType);
+    PyModule_AddObject(IIDBI_module, "columnbuffer", 
+         (PyObject *)&IIDBI_columnBufferType);
+
+    if (PyType_Ready(&IIDBI_asyncExecType) < 0)
+        return;
+
+    Py_INCREF(&IIDBI_asyncExecType);
+    PyModule_AddObject(IIDBI_module, "asyncexecute", 
+         (PyObject *)&IIDBI_asyncExecType);
+
+    if (PyType_Ready(&IIDBI_poolType) < 0)
+        return;
+
+    Py_INCREF(&IIDBI_poolType);
+    PyModule_AddObject(IIDBI_module, "ConnectionPool", 
+         (PyObject *)&IIDBI_poolType);
+
     if (!(IIDBI_Error = PyErr_NewException("ingresdbi.Error", 
         PyExc_StandardError, NULL)))
         Py_FatalError("Creation of ingresdbi.Error exception failed");
@@ -2240,7 +3240,17 @@ PyMODINIT_FUNC SQL_API initingresdbi(void)
     if (!decimalType)
         Py_FatalError("Cannot get decimal module attributes");
 
-    IIDBIenv.hdr.handle = NULL;
+    /* without the array module fetchcolumns() returns only lists */
+    arrayType = NULL;
+    arraymod = PyImport_ImportModule("array");
+    if (arraymod)
+    {
+        arrayType = PyObject_GetAttrString(arraymod, "array");
+        Py_DECREF(arraymod);
+    }
+    PyErr_Clear();
+
+    Py_AtExit(IIDBI_envExit);
 }
 
 /*{
@@ -3179,10 +4189,10 @@ static int IIDBI_connSetErrorHandler(IIDBI_CONNECTION *self, PyObject *value,
 }
 
 /*{
-** Name: IIDBI_cursorGetErrorHandler
+** Name: IIDBI_connGetDecimal
 **
 ** Description:
-**     Get cursor.errorhandler exception object.
+**     Get the connection.decimal attribute.
 **
 ** Inputs:
 **     self - connection object.
@@ -3192,7 +4202,7 @@ static int IIDBI_connSetErrorHandler(IIDBI_CONNECTION *self, PyObject *value,
 **     None.
 **
 ** Returns:
-**     New reference.
+**     New reference to "decimal", "float", "int" or "string".
 **
 ** Exceptions:
 **     None.
@@ -3201,76 +4211,75 @@ static int IIDBI_connSetErrorHandler(IIDBI_CONNECTION *self, PyObject *value,
 **     None.
 **
 ** History:
-**     26-May-06 Ralph.Loen@ingres.com
+**     16-Oct-2026 (agent)
 **         Created.
 }*/
 
-static PyObject *IIDBI_cursorGetErrorHandler(IIDBI_CURSOR *self, void 
+static PyObject *IIDBI_connGetDecimal(IIDBI_CONNECTION *self, void 
     *closure) 
 {
-    char *errMsg = "DB-API extension cursor.errorhandler used";
+    char *errMsg = "DB-API extension connection.decimal used";
 
     IIDBI_handleWarning(errMsg, NULL);
-    Py_INCREF(self->errorhandler);
-    return self->errorhandler;
+    return PyString_FromString(decimalModes[self->decimalMode]);
 }
 
 /*{
-** Name: IIDBI_cursorSetErrorHandler
+** Name: IIDBI_connSetDecimal
 **
 ** Description:
-**     Set the error handler object.
+**     Set the connection.decimal attribute, which selects the Python
+**     type DECIMAL columns are returned as by cursors of the
+**     connection: "decimal" (decimal.Decimal, the default), "float",
+**     "int" (int or long for a scale of 0, Decimal otherwise) or
+**     "string".
 **
 ** Inputs:
-**     self - cursor object.
-**     value - reference to error handler object.
+**     self - connection object.
+**     value - mode name.
 **     closure - definition data (unused).
 **
 ** Outputs:
 **     None.
 **
 ** Returns:
-**         
+**     0 on success, -1 on error.
+**
 ** Exceptions:
-**     Value argument must be callable.
+**     Value must name a mode.
 **
 ** Side Effects:
-**     IIDBI_handleError() will return TRUE if this routine is successfully 
-**     called.  This flags cursor and connection objects not to follow the
-**     exception protocol.
+**     None.
 **
 ** History:
-**     26-May-06 Ralph.Loen@ingres.com
+**     16-Oct-2026 (agent)
 **         Created.
 }*/
 
-static int IIDBI_cursorSetErrorHandler(IIDBI_CURSOR *self, PyObject *value, 
+static int IIDBI_connSetDecimal(IIDBI_CONNECTION *self, PyObject *value, 
     void *closure)
 {
-    char *errMsg = "DB-API extension cursor.errorhandler used";
-    PyObject *exception;
+    char *errMsg = "DB-API extension connection.decimal used";
+    int mode = -1;
 
-    IIDBI_handleWarning( errMsg, NULL);
-    if (!PyCallable_Check(value))
+    IIDBI_handleWarning(errMsg, NULL);
+    if (value && PyString_Check(value))
+        mode = IIDBI_decimalModeArg(PyString_AS_STRING(value));
+    if (mode < 0)
     {
-        Py_DECREF(value);  /* Discard current object */
-        errMsg = "cursor.errorhandler attribute must be callable";
-        exception = IIDBI_ProgrammingError;
-        IIDBI_handleError((PyObject *)self, exception, errMsg);
+        errMsg = "connection.decimal must be one of decimal, float, int, string";
+        IIDBI_handleError((PyObject *)self, self->ProgrammingError, errMsg);
         return -1;
     }
-    Py_DECREF(self->errorhandler);  /* Dispose of previous callback */
-    Py_INCREF(value);               /* Add a reference to new callback */
-    self->errorhandler = value;     /* Remember new callback */
-
+    self->decimalMode = (unsigned char)mode;
     return 0;
 }
 
 /*{
-** Name: IIDBI_cursorGetPrepared
+** Name: IIDBI_connGetTimeout
 **
 ** Description:
-**     Get cursor.prepared exception object.
+**     Get the connection.timeout attribute.
 **
 ** Inputs:
 **     self - connection object.
@@ -3280,7 +4289,7 @@ static int IIDBI_cursorSetErrorHandler(IIDBI_CURSOR *self, PyObject *value,
 **     None.
 **
 ** Returns:
-**     New reference.
+**     New reference to the timeout in seconds, 0 for none.
 **
 ** Exceptions:
 **     None.
@@ -3289,221 +4298,179 @@ static int IIDBI_cursorSetErrorHandler(IIDBI_CURSOR *self, PyObject *value,
 **     None.
 **
 ** History:
-**     26-May-06 Ralph.Loen@ingres.com
+**     16-Oct-2026 (agent)
 **         Created.
 }*/
 
-static PyObject *IIDBI_cursorGetPrepared(IIDBI_CURSOR *self, void 
+static PyObject *IIDBI_connGetTimeout(IIDBI_CONNECTION *self, void 
     *closure) 
 {
-    char *errMsg = "DB-API extension cursor.prepared used";
+    char *errMsg = "DB-API extension connection.timeout used";
 
     IIDBI_handleWarning(errMsg, NULL);
-    Py_INCREF(self->prepared);
-    return self->prepared;
+    return PyInt_FromLong(self->timeout);
 }
 
 /*{
-** Name: IIDBI_setPrepared
+** Name: IIDBI_connSetTimeout
 **
 ** Description:
-**     Set the cursor.prepared attribute.
+**     Set the connection.timeout attribute, the query timeout in 
+**     seconds of the connection's cursors that have no timeout of their
+**     own (see IIDBI_cursorSetTimeout()). 0 or None is no timeout.
 **
 ** Inputs:
-**     self - cursor object.
-**     value - an input string: 'y', 'n', 'yes', 'no', 'on', or 'off'.
+**     self - connection object.
+**     value - None or a number of seconds.
 **     closure - definition data (unused).
 **
 ** Outputs:
 **     None.
 **
 ** Returns:
-**     New reference.
+**     0 on success, -1 on error.
 **
 ** Exceptions:
-**     Value must be a string of zero to three characters.  Value must 
-**     evaluate to 'y', 'n', 'yes', 'no', 'on', or 'off'.         
+**     Value must be None or a number of seconds.
 **
 ** Side Effects:
-**     Forces all queries executed via cursor.execute() or cursor.executemany()
-**     to be prepared.
+**     None.
 **
 ** History:
-**     26-May-06 Ralph.Loen@ingres.com
+**     16-Oct-2026 (agent)
 **         Created.
 }*/
 
-static int IIDBI_cursorSetPrepared(IIDBI_CURSOR *self, PyObject *value, 
+static int IIDBI_connSetTimeout(IIDBI_CONNECTION *self, PyObject *value, 
     void *closure)
 {
-    char *errMsg = "DB-API extension cursor.prepared used";
-    PyObject *exception;
-    char *preparedStr;
-    char tmp[4];
-    int i, p, result;
-    
-    IIDBI_handleWarning( errMsg, NULL);
-    if (!PyString_Check(value))
-    {
-        Py_DECREF(value); 
-        errMsg = "cursor.prepared attribute must be a string";
-        exception = IIDBI_ProgrammingError;
-        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-        if (result)
-            return 0;
-        else
-            return -1;
-    }
-    preparedStr = PyString_AsString(value);
-    if (!strlen(preparedStr) || strlen(preparedStr) > 3)
-    {
-        errMsg = "cursor.prepared attribute must specify at 0 - 3 characters";
-        exception = IIDBI_ProgrammingError;
-        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-        if (result)
-            return 0;
-        else
-            return -1;
-    }
-    for (i = 0; i < (int)strlen(preparedStr); i++)
-    {
-        p = toupper(preparedStr[i]);
-        tmp[i] = (char) p;
-    }
-	tmp[i] = '\0';
-    if (!strcmp(tmp, "Y") || !strcmp(tmp, "ON") || !strcmp(tmp, "YES"))
-        self->prepareRequested = TRUE;
-    else if (!strcmp(tmp, "N") || !strcmp(tmp, "OFF") || !strcmp(tmp, "NO"))
-        self->prepareRequested = FALSE;
-    else
+    char *errMsg = "DB-API extension connection.timeout used";
+    long seconds;
+
+    IIDBI_handleWarning(errMsg, NULL);
+    if (IIDBI_timeoutArg(value, &seconds))
     {
-        errMsg = "valid settings for cursor.prepared attribute are: 'on', 'off', 'yes', 'no', 'y', or 'n'";
-        exception = IIDBI_ProgrammingError;
-        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-        if (result)
-            return 0;
-        else
-            return -1;
+        errMsg = "connection.timeout must be None or a number of seconds";
+        IIDBI_handleError((PyObject *)self, self->ProgrammingError, errMsg);
+        return -1;
     }
-    Py_DECREF(self->prepared);
-    Py_INCREF(value);        
-    self->prepared = value; 
-
+    self->timeout = seconds < 0 ? 0 : seconds;
     return 0;
 }
 
 /*{
-** Name: IIDBI_connDestructor
+** Name: IIDBI_connGetConverters
 **
 ** Description:
-**     Destroy an ingresdbi.connection object.
+**     Get the connection.converters dictionary, creating an empty one
+**     on first use.
 **
 ** Inputs:
-**     None.
+**     self - connection object.
+**     closure - definition data (unused).
 **
 ** Outputs:
 **     None.
 **
 ** Returns:
-**     Void.    
+**     New reference.
 **
 ** Exceptions:
-**     None.    
+**     None.
 **
 ** Side Effects:
 **     None.
 **
 ** History:
-**     26-May-06 Ralph.Loen@ingres.com
+**     16-Oct-2026 (agent)
 **         Created.
 }*/
 
-static void IIDBI_connDestructor(IIDBI_CONNECTION *self)
+static PyObject *IIDBI_connGetConverters(IIDBI_CONNECTION *self, void 
+    *closure) 
 {
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_connDestructor {{{1\n", self);
+    char *errMsg = "DB-API extension connection.converters used";
 
-    self->closed = TRUE;
- 
-    IIDBI_connCleanup(self);
-
-    Py_XDECREF(self->messages);
-    Py_XDECREF(self->errorhandler);
-    Py_XDECREF(self->Error);
-    Py_XDECREF(self->Warning);
-    Py_XDECREF(self->InterfaceError);
-    Py_XDECREF(self->DatabaseError);
-    Py_XDECREF(self->DataError);
-    Py_XDECREF(self->OperationalError);
-    Py_XDECREF(self->IntegrityError);
-    Py_XDECREF(self->InternalError);
-    Py_XDECREF(self->ProgrammingError);
-    Py_XDECREF(self->NotSupportedError);
-
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_connDestructor }}}1\n",self);
-
-    self->ob_type->tp_free((PyObject*)self);
-}
+    IIDBI_handleWarning(errMsg, NULL);
+    if (!self->converters)
+    {
+        self->converters = PyDict_New();
+        if (!self->converters)
+            return NULL;
+    }
+    Py_INCREF(self->converters);
+    return self->converters;
+}
 
 /*{
-** Name: IIDBI_connPrint
+** Name: IIDBI_connSetConverters
 **
 ** Description:
-**     Print connection name to standard output.
+**     Set the connection.converters dictionary, the output converters
+**     used by cursors of the connection for columns the cursor's own
+**     converters do not cover. See IIDBI_convertResolve().
 **
 ** Inputs:
 **     self - connection object.
-**     fp - pointer to standard output.
-**     flags - I/O modifiers.
+**     value - dictionary, or None to remove the converters.
+**     closure - definition data (unused).
 **
 ** Outputs:
 **     None.
 **
 ** Returns:
-**         
+**     0 on success, -1 on error.
+**
 ** Exceptions:
-**         
+**     Value must be a dictionary or None.
+**
 ** Side Effects:
-**     None.
+**     Takes effect at the next execute.
 **
 ** History:
-**     26-May-06 Ralph.Loen@ingres.com
+**     16-Oct-2026 (agent)
 **         Created.
 }*/
 
-static int IIDBI_connPrint(IIDBI_CONNECTION *self, FILE *fp, int flags)
+static int IIDBI_connSetConverters(IIDBI_CONNECTION *self, PyObject *value, 
+    void *closure)
 {
-    if (flags & Py_PRINT_RAW) 
+    char *errMsg = "DB-API extension connection.converters used";
+
+    IIDBI_handleWarning(errMsg, NULL);
+    if (value && value != Py_None && !PyDict_Check(value))
     {
-        fprintf(fp, "<ingresdbi.cursor object>");
+        errMsg = "connection.converters must be a dictionary or None";
+        IIDBI_handleError((PyObject *)self, self->ProgrammingError, errMsg);
+        return -1;
     }
-    else 
+    Py_CLEAR(self->converters);
+    if (value && value != Py_None)
     {
-        fprintf(fp, "\"<ingresdbi.cursor object>\"");
+        Py_INCREF(value);
+        self->converters = value;
     }
     return 0;
 }
 
 /*{
-** Name: IIDBI_cursorExecuteMany
+** Name: IIDBI_cursorGetErrorHandler
 **
 ** Description:
-**     Execute queries from an array of input parameters.
+**     Get cursor.errorhandler exception object.
 **
 ** Inputs:
-**     self - cursor object.
-**     args - Evaluates to:
-**            szSqlStr - query to be executed.
-**            paramSet - nested sequence containing input parameters.
+**     self - connection object.
+**     closure - definition data (unused).
 **
 ** Outputs:
 **     None.
 **
 ** Returns:
-**     None.
-**         
+**     New reference.
+**
 ** Exceptions:
-**     Query must be executed successfully.  ParamSet must be a sequence
-**     type.   
+**     None.
 **
 ** Side Effects:
 **     None.
@@ -3513,1677 +4480,9386 @@ static int IIDBI_connPrint(IIDBI_CONNECTION *self, FILE *fp, int flags)
 **         Created.
 }*/
 
-static PyObject *IIDBI_cursorExecuteMany(IIDBI_CURSOR *self, PyObject *args)
+static PyObject *IIDBI_cursorGetErrorHandler(IIDBI_CURSOR *self, void 
+    *closure) 
 {
-    char *szSqlStr = NULL;
-    PyObject *paramSet = NULL, *params = NULL;
-    int paramSetSize = 0;
-    IIDBI_STMT *IIDBIpstmt = NULL;
-    IIDBI_CONNECTION *connection = NULL;
-    IIDBI_DBC *IIDBIpdbc = NULL;
-    RETCODE rc;
-    int j;
-    PyObject *exception;
-    char *errMsg;
-    int result = FALSE;
- 
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorExecuteMany }}}1\n", self);
-
-    if (!PyArg_ParseTuple(args, "s|O", &szSqlStr, &paramSet)) 
-    {
-        exception = IIDBI_InterfaceError; 
-        errMsg = "usage: cursor.execute()";
-        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-        goto errorExit;
-    }  
-
-    IIDBI_clearMessages(self->messages);
-
-    if (self->closed)
-    {
-        exception = IIDBI_InterfaceError; 
-        errMsg = "cursor is already closed";
-        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-        goto errorExit;
-    }  
-    if (!self->IIDBIpstmt)
-    {
-        IIDBIpstmt = (IIDBI_STMT *)calloc(1,sizeof(IIDBI_STMT));
-        self->IIDBIpstmt = IIDBIpstmt;
-    }
-    else
-    {
-        IIDBIpstmt = self->IIDBIpstmt;
-    }
-
-    self->rowcount = -1;
-    Py_XDECREF(self->rownumber);
-    self->rownumber = Py_None;
-    Py_INCREF(self->rownumber);
-    self->rowindex = 0;
-
-    connection = self->connection;
-    if (connection == (IIDBI_CONNECTION *)Py_None)
-    {
-        exception = IIDBI_InternalError; 
-        errMsg = "Invalid connection object";
-        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-        goto errorExit;
-    }
-
-    IIDBIpdbc = connection->IIDBIpdbc;
-
-    if (paramSet)
-    {
-        paramSetSize = PyObject_Length(paramSet);
-        if (paramSetSize <= 0)
-        {
-            exception = IIDBI_InterfaceError, 
-            errMsg = "usage: cursor.executemany() parameter set";
-            result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-            goto errorExit;
-        }  
-        if (!PySequence_Check(paramSet))
-        {
-            exception = IIDBI_InterfaceError; 
-            errMsg ="parameters must be in sequence format";
-            result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-            goto errorExit;
-        }
-        for (j = 0; j < paramSetSize; j++)
-        {
-            params = PySequence_GetItem(paramSet, j); 
-            if (!params)
-            {
-                exception = IIDBI_InternalError;
-                errMsg = "failed to retrieve input parameter sequence";
-                result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-                goto errorExit;
-            }
-            else
-            {
-                rc = IIDBI_sendParameters(self, params);
-                switch (rc)
-                {
-                    case DBI_SQL_SUCCESS:
-                        break;
-                    
-                    case DBI_SQL_SUCCESS_WITH_INFO:
-                        result = 1;
-                        goto errorExit;
-                        break;
-
-                    default:
-                        result = 0;
-                        goto errorExit;
-                        break;
-                 } 
-            }
-         
-            if (self->szSqlStr == NULL)
-            {
-                self->szSqlStr = strdup(szSqlStr);
-                IIDBIpstmt->prepareRequested = self->prepareRequested;
-            }
-            else if (strcmp(szSqlStr, self->szSqlStr) && self->prepareRequested)
-            {
-                IIDBI_handleWarning ( "DB-API query has changed, reverting to direct execution", self->messages ) ;
-                IIDBIpstmt->prepareRequested = FALSE;
-                IIDBIpstmt->prepareCompleted = FALSE;
-            }
-            else
-                IIDBIpstmt->prepareRequested = self->prepareRequested;
-            Py_BEGIN_ALLOW_THREADS
-            rc = dbi_cursorExecute( IIDBIpdbc, IIDBIpstmt, szSqlStr, FALSE );
-            Py_END_ALLOW_THREADS
-            if (rc != DBI_SQL_SUCCESS)
-            {
-                Py_XDECREF(params);
-                result = IIDBI_mapError2exception((PyObject *)self, 
-                    &IIDBIpstmt->hdr.err, rc, szSqlStr);
-                goto errorExit;
-            }
-
-            if (IIDBIpstmt->hasResultSet)
-            {
-                Py_XDECREF(params);
-                exception = IIDBI_InterfaceError;
-                errMsg = "result sets not allowed for executemany method";
-                result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-                goto errorExit;
-            }
-            else
-            {
-                Py_XDECREF(self->description);
-                self->description = Py_None;
-                Py_INCREF(self->description);
-            }
-            dbi_freeData(IIDBIpstmt);   
-            Py_XDECREF(params);
-        } /* for (i = 0; i < paramSetSize; i++) */
-    } /* if (params) */
-    else
-    {
-        Py_XDECREF(params);
-        exception = IIDBI_OperationalError; 
-        errMsg = "cursor.executemany() requires parameters";
-        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-        goto errorExit;
-    }
-
-    self->rowcount = paramSetSize;
-
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorExecuteMany }}}1\n", self);
-    
-    Py_INCREF(Py_None);
-    return(Py_None);
+    char *errMsg = "DB-API extension cursor.errorhandler used";
 
-errorExit:
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorExecuteMany }}}1\n", self);
-    if (self->szSqlStr)
-    {
-        free(self->szSqlStr);
-        self->szSqlStr = NULL;
-    }
-    dbi_freeData(IIDBIpstmt);
-    if (result)
-    {
-        Py_INCREF(Py_None);
-        return Py_None;
-    }
-    return NULL;
+    IIDBI_handleWarning(errMsg, NULL);
+    Py_INCREF(self->errorhandler);
+    return self->errorhandler;
 }
 
 /*{
-** Name: IIDBI_cursorExecute
+** Name: IIDBI_cursorSetErrorHandler
 **
 ** Description:
-**     Execute query.
+**     Set the error handler object.
 **
 ** Inputs:
 **     self - cursor object.
-**     args - Evaluates to:
-**            szSqlStr - query to be executed.
-**            params - optional sequence of input parameters.
+**     value - reference to error handler object.
+**     closure - definition data (unused).
 **
 ** Outputs:
 **     None.
 **
 ** Returns:
-**     None.
 **         
 ** Exceptions:
-**     Cursor must be open.  Query must be executed successfully.  Params 
-**     must be a sequence type.   
+**     Value argument must be callable.
 **
 ** Side Effects:
-**     None.
+**     IIDBI_handleError() will return TRUE if this routine is successfully 
+**     called.  This flags cursor and connection objects not to follow the
+**     exception protocol.
 **
 ** History:
 **     26-May-06 Ralph.Loen@ingres.com
 **         Created.
 }*/
 
-static PyObject *IIDBI_cursorExecute(IIDBI_CURSOR *self, PyObject *args)
+static int IIDBI_cursorSetErrorHandler(IIDBI_CURSOR *self, PyObject *value, 
+    void *closure)
 {
-    char *szSqlStr = NULL;
-    PyObject *params = NULL;
-    IIDBI_STMT *IIDBIpstmt = NULL;
-    IIDBI_CONNECTION *connection = NULL;
-    IIDBI_DBC *IIDBIpdbc = NULL;
-    RETCODE rc;
-    int i;
-    PyObject *temp;
+    char *errMsg = "DB-API extension cursor.errorhandler used";
     PyObject *exception;
-    char *errMsg;
-    int result = FALSE;
-    
-    DBPRINTF(DBI_TRC_ENTRY)("%p: IIDBI_cursorExecute {{{1\n", self);
 
-    if (!PyArg_ParseTuple(args, "s|O", &szSqlStr, &params)) 
+    IIDBI_handleWarning( errMsg, NULL);
+    if (!PyCallable_Check(value))
     {
-        exception = IIDBI_InterfaceError; 
-        errMsg = "usage: cursor.execute()";
-        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-        goto errorExit;
-    }  
+        Py_DECREF(value);  /* Discard current object */
+        errMsg = "cursor.errorhandler attribute must be callable";
+        exception = IIDBI_ProgrammingError;
+        IIDBI_handleError((PyObject *)self, exception, errMsg);
+        return -1;
+    }
+    Py_DECREF(self->errorhandler);  /* Dispose of previous callback */
+    Py_INCREF(value);               /* Add a reference to new callback */
+    self->errorhandler = value;     /* Remember new callback */
 
-    IIDBI_clearMessages(self->messages);
+    return 0;
+}
 
-    if (self->closed)
-    {
-        exception = IIDBI_InterfaceError; 
-        errMsg = "cursor is already closed";
-        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-        goto errorExit;
-    }
-	
-    if (!self->IIDBIpstmt)
-    {
-        IIDBIpstmt = (IIDBI_STMT *)calloc(1,sizeof(IIDBI_STMT));
-        self->IIDBIpstmt = IIDBIpstmt;
-    }
-    else
-    {
-        IIDBIpstmt = self->IIDBIpstmt;
-    }
-
-    connection = self->connection;
-    if (connection == (IIDBI_CONNECTION *)Py_None)
-    {
-        exception = IIDBI_InternalError; 
-        errMsg = "Invalid connection object";
-        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-        goto errorExit;
-    }
-
-    IIDBIpdbc = connection->IIDBIpdbc;
-
-    Py_XDECREF(self->description);
-    self->description = Py_None;
-    Py_INCREF(self->description);
-
-    Py_XDECREF(self->rownumber);
-    self->rownumber = Py_None;
-    Py_INCREF(self->rownumber);
-
-    self->rowcount = -1;
-    self->rowindex = 0;
-
-    IIDBIpstmt->inputSegmentSize = self->inputSegmentSize;
-    IIDBIpstmt->inputSegmentLen = self->inputSegmentLen;
-    IIDBIpstmt->outputSegmentSize = self->outputSegmentSize;
-    IIDBIpstmt->outputColumnIndex = self->outputColumnIndex;
-    if (self->szSqlStr == NULL)
-    {
-        self->szSqlStr = strdup(szSqlStr);
-        IIDBIpstmt->prepareRequested = self->prepareRequested;
-    }
-    else if (strcmp(szSqlStr, self->szSqlStr) && self->prepareRequested)
-    {
-        IIDBI_handleWarning ( "DB-API query has changed, reverting to direct execution", self->messages ) ;
-        IIDBIpstmt->prepareRequested = FALSE;
-        IIDBIpstmt->prepareCompleted = FALSE;
-    }
-    else
-        IIDBIpstmt->prepareRequested = self->prepareRequested;
-
-    if (IIDBI_IsTrue(params))
-    {
-         rc = IIDBI_sendParameters(self, params);
-         switch (rc)
-         {
-             case DBI_SQL_SUCCESS:
-                 break;
-                    
-             case DBI_SQL_SUCCESS_WITH_INFO:
-                 result = 1;
-                 goto errorExit;
-                 break;
-
-             default:
-                 result = 0;
-                 goto errorExit;
-                 break;
-         } 
-    }  /* if (params) */
-    Py_BEGIN_ALLOW_THREADS
-    rc = dbi_cursorExecute( IIDBIpdbc, IIDBIpstmt, szSqlStr, FALSE );
-    Py_END_ALLOW_THREADS
-    if (rc != DBI_SQL_SUCCESS)
-    {
-        result = IIDBI_mapError2exception((PyObject *)self, 
-            &IIDBIpstmt->hdr.err, rc, szSqlStr); 
-        goto errorExit;
-    }
-    self->rowcount = IIDBIpstmt->rowCount;
-
-    if (IIDBIpstmt->hasResultSet)
-    {
-        IIDBI_DESCRIPTOR *descriptor;
-        PyObject *descRow = NULL;
-        int type = -1;
-
-        Py_XDECREF(self->description);
-        self->description = PyList_New(0);
-        rc = dbi_allocDescriptor(IIDBIpstmt, IIDBIpstmt->descCount, 0);
-        if (rc != DBI_SQL_SUCCESS)
-        {
-            exception = IIDBI_OperationalError; 
-            errMsg = "Could not allocate descriptor";
-            result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-            goto errorExit;
-        }
-        Py_BEGIN_ALLOW_THREADS
-        rc = dbi_describeColumns(IIDBIpstmt);
-        Py_END_ALLOW_THREADS
-        if (rc != DBI_SQL_SUCCESS)
-        {
-            exception = IIDBI_OperationalError, 
-            errMsg = "Could not describe columns";
-            result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-            goto errorExit;
-        }
-        if (rc != DBI_SQL_SUCCESS)
-        {
-            exception = IIDBI_OperationalError, 
-            errMsg = "Could not allocate data";
-            result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-            goto errorExit;
-        }
-        for (i = 0; i < IIDBIpstmt->descCount; i++)
-        {
-            descriptor = IIDBIpstmt->descriptor[i];
-            descRow = PyTuple_New(7);
-	    temp = PyString_FromString(descriptor->columnName);
-            rc = PyTuple_SetItem( descRow, 0, temp);
-            type = IIDBI_mapType(descriptor->type);
-            if (type == DBI_UNKNOWN_TYPE)
-            {
-                exception = IIDBI_OperationalError; 
-                errMsg = "Invalid data type";
-                result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-                goto errorExit;
-            }
-
-            temp = PyInt_FromLong((long)type);
-            rc = PyTuple_SetItem( descRow, 1, temp);
-
-	    temp = PyInt_FromLong((long)descriptor->displaySize);
-            rc = PyTuple_SetItem( descRow, 2, temp);
-
-            temp = PyInt_FromLong((long)descriptor->internalSize);
-            rc = PyTuple_SetItem( descRow, 3, temp);
-
-            temp = PyInt_FromLong((long)descriptor->precision);
-            rc = PyTuple_SetItem( descRow, 4, temp);
-
-            temp = PyInt_FromLong((long)descriptor->scale);
-            rc = PyTuple_SetItem( descRow, 5, temp);
-
-            temp = PyInt_FromLong((long)descriptor->nullable);
-            rc = PyTuple_SetItem( descRow, 6, temp);
-
-            rc = PyList_Append( self->description, descRow);
-            Py_XDECREF(descRow);
-        }
-    }
-    else
-    {
-        Py_XDECREF(self->description);
-        self->description = Py_None;
-        Py_INCREF(self->description);
-    }
+/*{
+** Name: IIDBI_cursorGetPrepared
+**
+** Description:
+**     Get cursor.prepared exception object.
+**
+** Inputs:
+**     self - connection object.
+**     closure - definition data (unused).
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     New reference.
+**
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     26-May-06 Ralph.Loen@ingres.com
+**         Created.
+}*/
 
-    DBPRINTF(DBI_TRC_ENTRY)("%p: IIDBI_cursorExecute }}}1\n", self);
-    
-    dbi_freeData(IIDBIpstmt);   
-    Py_INCREF(Py_None);
-    return(Py_None);
+static PyObject *IIDBI_cursorGetPrepared(IIDBI_CURSOR *self, void 
+    *closure) 
+{
+    char *errMsg = "DB-API extension cursor.prepared used";
 
-errorExit:
-    DBPRINTF(DBI_TRC_STAT)("%p: IIDBI_cursorExecute errorExit\n", self);
-    DBPRINTF(DBI_TRC_ENTRY)("%p: IIDBI_cursorExecute }}}1\n", self);
-    if (self->szSqlStr)
-    {
-        free(self->szSqlStr);
-        self->szSqlStr = NULL;
-    }
-    dbi_freeData(IIDBIpstmt);
-    if (result)
-    {
-        Py_INCREF(Py_None);
-        return Py_None;
-    }
-    else
-        return NULL;
+    IIDBI_handleWarning(errMsg, NULL);
+    Py_INCREF(self->prepared);
+    return self->prepared;
 }
 
 /*{
-** Name: IIDBI_cursorCallProc
+** Name: IIDBI_setPrepared
 **
 ** Description:
-**     Execute a stored procedure.
+**     Set the cursor.prepared attribute.
 **
 ** Inputs:
 **     self - cursor object.
-**     args - Evaluates to:
-**            szSqlStr - name of procedure.
-**            params - an optional sequence of input parameters.
+**     value - an input string: 'y', 'n', 'yes', 'no', 'on', or 'off'.
+**     closure - definition data (unused).
 **
 ** Outputs:
-**     BYREF parameters may be modified.
+**     None.
 **
 ** Returns:
-**     None.
+**     New reference.
 **
 ** Exceptions:
-**     The cursor must be open. The ODBC statement handle must be non-null.
-**     The cursor.prepared Query must succeed.  Cursor attribute "prepared"
-**     cannot be set to 'y', 'yes', or 'on".  If the procedure returns
-**     rows, the returned descriptor must be valid and rows must have valid
-**     data.
+**     Value must be a string of zero to three characters.  Value must 
+**     evaluate to 'y', 'n', 'yes', 'no', 'on', or 'off'.         
 **
 ** Side Effects:
-**     None.
+**     Forces all queries executed via cursor.execute() or cursor.executemany()
+**     to be prepared.
 **
 ** History:
 **     26-May-06 Ralph.Loen@ingres.com
 **         Created.
 }*/
 
-static PyObject *IIDBI_cursorCallProc(IIDBI_CURSOR *self, PyObject *args)
+static int IIDBI_cursorSetPrepared(IIDBI_CURSOR *self, PyObject *value, 
+    void *closure)
 {
-    char *szSqlStr = NULL;
-    PyObject *params = NULL;
-    IIDBI_STMT *IIDBIpstmt = NULL;
-    IIDBI_CONNECTION *connection = NULL;
-    IIDBI_DBC *IIDBIpdbc = NULL;
-    RETCODE rc;
-    int i;
-    int parmCount = 0;
-    char szProcStr[1024];
-    char *procFmt="{ call %s (";
-    int j;
-    short int k;
-    char l;
-    long m;
-    PyObject *row = NULL;
-    IIDBI_DESCRIPTOR **parameter = NULL;
-    SQLBIGINT n;
+    char *errMsg = "DB-API extension cursor.prepared used";
     PyObject *exception;
-    char *errMsg;
-    int result = FALSE;
-    
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorCallProc }}}1\n", self);
-
-    if (!PyArg_ParseTuple(args, "s|O", &szSqlStr, &params)) 
-    {
-        exception = IIDBI_InterfaceError; 
-        errMsg = "usage: cursor.callproc()";
-        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-        goto errorExit;
-    }  
-
-    IIDBI_clearMessages(self->messages);
-
-    if (self->closed)
+    char *preparedStr;
+    char tmp[4];
+    int i, p, result;
+    
+    IIDBI_handleWarning( errMsg, NULL);
+    if (!PyString_Check(value))
     {
-        exception = IIDBI_InterfaceError; 
-        errMsg = "cursor is already closed";
+        Py_DECREF(value); 
+        errMsg = "cursor.prepared attribute must be a string";
+        exception = IIDBI_ProgrammingError;
         result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-        goto errorExit;
-    }  
-    if (self->prepareRequested)
+        if (result)
+            return 0;
+        else
+            return -1;
+    }
+    preparedStr = PyString_AsString(value);
+    if (!strlen(preparedStr) || strlen(preparedStr) > 3)
     {
-        exception = IIDBI_ProgrammingError; 
-        errMsg = "prepared attribute of (on, y, yes) not valid for execution of procedures";
+        errMsg = "cursor.prepared attribute must specify at 0 - 3 characters";
+        exception = IIDBI_ProgrammingError;
         result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-        goto errorExit;
-    }  
-    if (!self->IIDBIpstmt)
-    {
-        IIDBIpstmt = (IIDBI_STMT *)calloc(1,sizeof(IIDBI_STMT));
-        self->IIDBIpstmt = IIDBIpstmt;
+        if (result)
+            return 0;
+        else
+            return -1;
     }
-    else
+    for (i = 0; i < (int)strlen(preparedStr); i++)
     {
-        IIDBIpstmt = self->IIDBIpstmt;
+        p = toupper(preparedStr[i]);
+        tmp[i] = (char) p;
     }
-    connection = self->connection;
-    if (connection == (IIDBI_CONNECTION *)Py_None)
+	tmp[i] = '\0';
+    if (!strcmp(tmp, "Y") || !strcmp(tmp, "ON") || !strcmp(tmp, "YES"))
+        self->prepareRequested = TRUE;
+    else if (!strcmp(tmp, "N") || !strcmp(tmp, "OFF") || !strcmp(tmp, "NO"))
+        self->prepareRequested = FALSE;
+    else
     {
-        exception = IIDBI_InternalError; 
-        errMsg = "Invalid connection object";
+        errMsg = "valid settings for cursor.prepared attribute are: 'on', 'off', 'yes', 'no', 'y', or 'n'";
+        exception = IIDBI_ProgrammingError;
         result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-        goto errorExit;
+        if (result)
+            return 0;
+        else
+            return -1;
     }
+    Py_DECREF(self->prepared);
+    Py_INCREF(value);        
+    self->prepared = value; 
 
-    IIDBIpdbc = connection->IIDBIpdbc;
+    return 0;
+}
 
-    sprintf(szProcStr, procFmt, szSqlStr);
-    if (IIDBI_IsTrue(params))
-    {
-        rc = IIDBI_sendParameters(self, params);
-        switch (rc)
-        {
-            case DBI_SQL_SUCCESS:
-                break;
-                    
-            case DBI_SQL_SUCCESS_WITH_INFO:
-                result = 1;
-                goto errorExit;
-                break;
+/*{
+** Name: IIDBI_cursorGetLobStreaming
+**
+** Description:
+**     Get the cursor.lobstreaming attribute.
+**
+** Inputs:
+**     self - cursor object.
+**     closure - definition data (unused).
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     New reference to True or False.
+**
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
 
-            default:
-                result = 0;
-                goto errorExit;
-                break;
-        } 
-        parmCount = IIDBIpstmt->parmCount;
-        for (i = 0; i < parmCount; i++)
-        {
-            if (i == parmCount - 1)
-                strcat(szProcStr,"? ");
-            else
-                strcat(szProcStr," ?,");
-        } 
-       
-        strcat(szProcStr, " ) }");
+static PyObject *IIDBI_cursorGetLobStreaming(IIDBI_CURSOR *self, void 
+    *closure) 
+{
+    char *errMsg = "DB-API extension cursor.lobstreaming used";
 
-        Py_BEGIN_ALLOW_THREADS
-        rc = dbi_cursorExecute( IIDBIpdbc, IIDBIpstmt, szProcStr, TRUE);
-        Py_END_ALLOW_THREADS
-        if (rc != DBI_SQL_SUCCESS)
+    IIDBI_handleWarning(errMsg, NULL);
+    return PyBool_FromLong(self->lobStreaming);
+}
+
+/*{
+** Name: IIDBI_cursorSetLobStreaming
+**
+** Description:
+**     Set the cursor.lobstreaming attribute. When true, fetchone() and
+**     iteration return the last LONG column of a row as a LOB reader
+**     that reads the value from the driver on demand. fetchmany() and
+**     fetchall() always return whole values.
+**
+** Inputs:
+**     self - cursor object.
+**     value - any object, tested for truth.
+**     closure - definition data (unused).
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     0 on success, -1 on error.
+**
+** Exceptions:
+**     Truth test of value must succeed.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static int IIDBI_cursorSetLobStreaming(IIDBI_CURSOR *self, PyObject *value, 
+    void *closure)
+{
+    char *errMsg = "DB-API extension cursor.lobstreaming used";
+    int isTrue;
+
+    IIDBI_handleWarning(errMsg, NULL);
+    isTrue = IIDBI_IsTrue(value);
+    if (isTrue < 0)
+        return -1;
+    self->lobStreaming = isTrue ? TRUE : FALSE;
+    return 0;
+}
+
+/*{
+** Name: IIDBI_cursorGetPrefetch
+**
+** Description:
+**     Get the cursor.prefetch attribute.
+**
+** Inputs:
+**     self - cursor object.
+**     closure - definition data (unused).
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     New reference to True or False.
+**
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static PyObject *IIDBI_cursorGetPrefetch(IIDBI_CURSOR *self, void 
+    *closure) 
+{
+    char *errMsg = "DB-API extension cursor.prefetch used";
+
+    IIDBI_handleWarning(errMsg, NULL);
+    return PyBool_FromLong(self->prefetch);
+}
+
+/*{
+** Name: IIDBI_cursorSetPrefetch
+**
+** Description:
+**     Set the cursor.prefetch attribute. When true, result sets fetched
+**     in rowsets have the next rowset fetched by a worker thread while
+**     the current one is returned. Takes effect from the next execute.
+**
+** Inputs:
+**     self - cursor object.
+**     value - any object, tested for truth.
+**     closure - definition data (unused).
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     0 on success, -1 on error.
+**
+** Exceptions:
+**     Truth test of value must succeed.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static int IIDBI_cursorSetPrefetch(IIDBI_CURSOR *self, PyObject *value, 
+    void *closure)
+{
+    char *errMsg = "DB-API extension cursor.prefetch used";
+    int isTrue;
+
+    IIDBI_handleWarning(errMsg, NULL);
+    isTrue = IIDBI_IsTrue(value);
+    if (isTrue < 0)
+        return -1;
+    self->prefetch = isTrue ? TRUE : FALSE;
+    return 0;
+}
+
+/*{
+** Name: IIDBI_cursorGetTimeout
+**
+** Description:
+**     Get the cursor.timeout attribute.
+**
+** Inputs:
+**     self - cursor object.
+**     closure - definition data (unused).
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     New reference to the timeout in seconds, None when the
+**     connection's timeout applies.
+**
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static PyObject *IIDBI_cursorGetTimeout(IIDBI_CURSOR *self, void 
+    *closure) 
+{
+    char *errMsg = "DB-API extension cursor.timeout used";
+
+    IIDBI_handleWarning(errMsg, NULL);
+    if (self->timeout < 0)
+    {
+        Py_INCREF(Py_None);
+        return Py_None;
+    }
+    return PyInt_FromLong(self->timeout);
+}
+
+/*{
+** Name: IIDBI_cursorSetTimeout
+**
+** Description:
+**     Set the cursor.timeout attribute, the number of seconds a query
+**     executed by the cursor may run before the driver cancels it 
+**     (SQL_ATTR_QUERY_TIMEOUT). 0 is no timeout, None uses
+**     connection.timeout. Fractions of a second are rounded up.
+**
+** Inputs:
+**     self - cursor object.
+**     value - None or a number of seconds.
+**     closure - definition data (unused).
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     0 on success, -1 on error.
+**
+** Exceptions:
+**     Value must be None or a number of seconds.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static int IIDBI_cursorSetTimeout(IIDBI_CURSOR *self, PyObject *value, 
+    void *closure)
+{
+    char *errMsg = "DB-API extension cursor.timeout used";
+    long seconds;
+
+    IIDBI_handleWarning(errMsg, NULL);
+    if (IIDBI_timeoutArg(value, &seconds))
+    {
+        errMsg = "cursor.timeout must be None or a number of seconds";
+        IIDBI_handleError((PyObject *)self, IIDBI_ProgrammingError, errMsg);
+        return -1;
+    }
+    self->timeout = seconds;
+    return 0;
+}
+
+/*{
+** Name: IIDBI_timeoutArg
+**
+** Description:
+**     Convert a timeout attribute value to seconds.
+**
+** Inputs:
+**     value - None or a non-negative number of seconds.
+**
+** Outputs:
+**     seconds - whole seconds, rounded up, -1 for None.
+**
+** Returns:
+**     0 on success, -1 if the value is not valid.
+**
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static int IIDBI_timeoutArg(PyObject *value, long *seconds)
+{
+    double d;
+
+    if (!value)
+        return -1;
+    if (value == Py_None)
+    {
+        *seconds = -1;
+        return 0;
+    }
+    if (!PyInt_Check(value) && !PyLong_Check(value) && 
+        !PyFloat_Check(value))
+        return -1;
+    d = PyFloat_AsDouble(value);
+    if (d == -1.0 && PyErr_Occurred())
+    {
+        PyErr_Clear();
+        return -1;
+    }
+    if (d < 0.0 || d > INT_MAX)
+        return -1;
+    *seconds = (long)d;
+    if (*seconds < d)
+        (*seconds)++;
+    return 0;
+}
+
+/*{
+** Name: IIDBI_cursorGetConverters
+**
+** Description:
+**     Get the cursor.converters dictionary, creating an empty one on
+**     first use.
+**
+** Inputs:
+**     self - cursor object.
+**     closure - definition data (unused).
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     New reference.
+**
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static PyObject *IIDBI_cursorGetConverters(IIDBI_CURSOR *self, void 
+    *closure) 
+{
+    char *errMsg = "DB-API extension cursor.converters used";
+
+    IIDBI_handleWarning(errMsg, NULL);
+    if (!self->converters)
+    {
+        self->converters = PyDict_New();
+        if (!self->converters)
+            return NULL;
+    }
+    Py_INCREF(self->converters);
+    return self->converters;
+}
+
+/*{
+** Name: IIDBI_cursorSetConverters
+**
+** Description:
+**     Set the cursor.converters dictionary. Its entries take precedence
+**     over those of connection.converters, see IIDBI_convertResolve().
+**
+** Inputs:
+**     self - cursor object.
+**     value - dictionary, or None to remove the converters.
+**     closure - definition data (unused).
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     0 on success, -1 on error.
+**
+** Exceptions:
+**     Value must be a dictionary or None.
+**
+** Side Effects:
+**     Takes effect at the next execute.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static int IIDBI_cursorSetConverters(IIDBI_CURSOR *self, PyObject *value, 
+    void *closure)
+{
+    char *errMsg = "DB-API extension cursor.converters used";
+
+    IIDBI_handleWarning(errMsg, NULL);
+    if (value && value != Py_None && !PyDict_Check(value))
+    {
+        errMsg = "cursor.converters must be a dictionary or None";
+        IIDBI_handleError((PyObject *)self, IIDBI_ProgrammingError, errMsg);
+        return -1;
+    }
+    Py_CLEAR(self->converters);
+    if (value && value != Py_None)
+    {
+        Py_INCREF(value);
+        self->converters = value;
+    }
+    return 0;
+}
+
+/*{
+** Name: IIDBI_connDestructor
+**
+** Description:
+**     Destroy an ingresdbi.connection object.
+**
+** Inputs:
+**     None.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     Void.    
+**
+** Exceptions:
+**     None.    
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     26-May-06 Ralph.Loen@ingres.com
+**         Created.
+**     16-Oct-2026 (agent)
+**         Release the output converters.
+**     17-Oct-2026 (agent)
+**         Return a pooled connection to its pool.
+}*/
+
+static void IIDBI_connDestructor(IIDBI_CONNECTION *self)
+{
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_connDestructor {{{1\n", self);
+
+    if (self->pool)
+        IIDBI_poolRelease(self);
+
+    self->closed = TRUE;
+ 
+    IIDBI_connCleanup(self);
+
+    Py_XDECREF(self->messages);
+    Py_XDECREF(self->errorhandler);
+    Py_XDECREF(self->Error);
+    Py_XDECREF(self->Warning);
+    Py_XDECREF(self->InterfaceError);
+    Py_XDECREF(self->DatabaseError);
+    Py_XDECREF(self->DataError);
+    Py_XDECREF(self->OperationalError);
+    Py_XDECREF(self->IntegrityError);
+    Py_XDECREF(self->InternalError);
+    Py_XDECREF(self->ProgrammingError);
+    Py_XDECREF(self->NotSupportedError);
+    Py_XDECREF(self->converters);
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_connDestructor }}}1\n",self);
+
+    self->ob_type->tp_free((PyObject*)self);
+}
+
+/*{
+** Name: IIDBI_connPrint
+**
+** Description:
+**     Print connection name to standard output.
+**
+** Inputs:
+**     self - connection object.
+**     fp - pointer to standard output.
+**     flags - I/O modifiers.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**         
+** Exceptions:
+**         
+** Side Effects:
+**     None.
+**
+** History:
+**     26-May-06 Ralph.Loen@ingres.com
+**         Created.
+}*/
+
+static int IIDBI_connPrint(IIDBI_CONNECTION *self, FILE *fp, int flags)
+{
+    if (flags & Py_PRINT_RAW) 
+    {
+        fprintf(fp, "<ingresdbi.cursor object>");
+    }
+    else 
+    {
+        fprintf(fp, "\"<ingresdbi.cursor object>\"");
+    }
+    return 0;
+}
+
+/*{
+** Name: IIDBI_cursorExecuteMany
+**
+** Description:
+**     Execute queries from an array of input parameters.
+**
+** Inputs:
+**     self - cursor object.
+**     args - Evaluates to:
+**            szSqlStr - query to be executed.
+**            paramSet - nested sequence containing input parameters.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None.
+**         
+** Exceptions:
+**     Query must be executed successfully.  ParamSet must be a sequence
+**     type.   
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     26-May-06 Ralph.Loen@ingres.com
+**         Created.
+**     16-Oct-2026 (agent)
+**         Send the parameter set as column-wise arrays, IIDBI_PARAMSET_SIZE
+**         rows per execute, falling back to one row at a time when the
+**         parameters or the driver do not allow it.
+**     16-Oct-2026 (agent)
+**         Prepare the query once and keep the parameter bindings for the
+**         rows sent one at a time.
+**     16-Oct-2026 (agent)
+**         Keep the query prepared when it changes, the previous one is
+**         kept in the connection's statement cache.
+**     16-Oct-2026 (agent)
+**         Wait for a pending asynchronous execute first.
+**     16-Oct-2026 (agent)
+**         Pass the query timeout on to the statement.
+**     17-Oct-2026 (agent)
+**         Execute the parameter set with IIDBI_cursorExecuteParamSet().
+}*/
+
+static PyObject *IIDBI_cursorExecuteMany(IIDBI_CURSOR *self, PyObject *args)
+{
+    char *szSqlStr = NULL;
+    PyObject *paramSet = NULL;
+    IIDBI_PARAMSET source;
+    int paramSetSize = 0;
+    IIDBI_STMT *IIDBIpstmt = NULL;
+    IIDBI_CONNECTION *connection = NULL;
+    PyObject *exception;
+    char *errMsg;
+    int result = FALSE;
+    int executed;
+ 
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorExecuteMany }}}1\n", self);
+
+    if (self->asyncExec && IIDBI_asyncExecJoin(self, TRUE) < 0)
+        return NULL;
+
+    if (!PyArg_ParseTuple(args, "s|O", &szSqlStr, &paramSet)) 
+    {
+        exception = IIDBI_InterfaceError; 
+        errMsg = "usage: cursor.execute()";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }  
+
+    IIDBI_clearMessages(self->messages);
+
+    if (self->closed)
+    {
+        exception = IIDBI_InterfaceError; 
+        errMsg = "cursor is already closed";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }  
+    if (!self->IIDBIpstmt)
+    {
+        IIDBIpstmt = (IIDBI_STMT *)calloc(1,sizeof(IIDBI_STMT));
+        self->IIDBIpstmt = IIDBIpstmt;
+    }
+    else
+    {
+        IIDBIpstmt = self->IIDBIpstmt;
+    }
+
+    self->rowcount = -1;
+    Py_XDECREF(self->rownumber);
+    self->rownumber = Py_None;
+    Py_INCREF(self->rownumber);
+    self->rowindex = 0;
+
+    connection = self->connection;
+    if (connection == (IIDBI_CONNECTION *)Py_None)
+    {
+        exception = IIDBI_InternalError; 
+        errMsg = "Invalid connection object";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }
+
+    if (paramSet)
+    {
+        paramSetSize = PyObject_Length(paramSet);
+        if (paramSetSize <= 0)
+        {
+            exception = IIDBI_InterfaceError, 
+            errMsg = "usage: cursor.executemany() parameter set";
+            result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+            goto errorExit;
+        }  
+        if (!PySequence_Check(paramSet))
+        {
+            exception = IIDBI_InterfaceError; 
+            errMsg ="parameters must be in sequence format";
+            result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+            goto errorExit;
+        }
+
+        source.sendArray = IIDBI_paramSetSendRows;
+        source.getRow = IIDBI_paramSetGetRow;
+        source.method = "executemany";
+        source.sequence = paramSet;
+        source.rows = PySequence_Fast(paramSet, 
+            "parameters must be in sequence format");
+        if (!source.rows)
+            PyErr_Clear();
+        source.columns = NULL;
+        source.parmCount = 0;
+        executed = IIDBI_cursorExecuteParamSet(self, IIDBIpstmt, szSqlStr, 
+            &source, paramSetSize, &result);
+        Py_XDECREF(source.rows);
+        if (!executed)
+            goto errorExit;
+    } /* if (params) */
+    else
+    {
+        exception = IIDBI_OperationalError; 
+        errMsg = "cursor.executemany() requires parameters";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorExecuteMany }}}1\n", self);
+    
+    Py_INCREF(Py_None);
+    return(Py_None);
+
+errorExit:
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorExecuteMany }}}1\n", self);
+    if (self->szSqlStr)
+    {
+        free(self->szSqlStr);
+        self->szSqlStr = NULL;
+    }
+    if (result)
+    {
+        Py_INCREF(Py_None);
+        return Py_None;
+    }
+    return NULL;
+}
+
+/*{
+** Name: IIDBI_cursorExecuteColumns
+**
+** Description:
+**     Execute a query for each row of a parameter set held column by
+**     column, one sequence or buffer per parameter.  The columns are
+**     sent as parameter arrays without building a sequence per row;
+**     numeric buffers, such as array.array objects and column buffers,
+**     are bound as they are.
+**
+** Inputs:
+**     self - cursor object.
+**     args - Evaluates to:
+**            szSqlStr - query to be executed.
+**            columnSet - sequence of parameter columns, all of the same
+**                        length.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None.
+**         
+** Exceptions:
+**     Query must be executed successfully.  Each column must be a
+**     sequence or a numeric buffer.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+**     16-Oct-2026 (agent)
+**         Wait for a pending asynchronous execute first.
+**     16-Oct-2026 (agent)
+**         Pass the query timeout on to the statement.
+**     17-Oct-2026 (agent)
+**         Execute the parameter set with IIDBI_cursorExecuteParamSet().
+}*/
+
+static PyObject *IIDBI_cursorExecuteColumns(IIDBI_CURSOR *self, 
+    PyObject *args)
+{
+    char *szSqlStr = NULL;
+    PyObject *columnSet = NULL;
+    PyObject *columnSeq = NULL;
+    PyObject *elem;
+    IIDBI_PARAMCOLUMN *columns = NULL;
+    IIDBI_PARAMSET source;
+    Py_ssize_t paramSetSize = -1;
+    Py_ssize_t count;
+    int parmCount = 0;
+    IIDBI_STMT *IIDBIpstmt = NULL;
+    IIDBI_CONNECTION *connection = NULL;
+    int i;
+    PyObject *exception;
+    char *errMsg;
+    int result = FALSE;
+ 
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorExecuteColumns {{{1\n", self);
+
+    if (self->asyncExec && IIDBI_asyncExecJoin(self, TRUE) < 0)
+        return NULL;
+
+    if (!PyArg_ParseTuple(args, "sO", &szSqlStr, &columnSet)) 
+    {
+        exception = IIDBI_InterfaceError; 
+        errMsg = "usage: cursor.executecolumns(query, columns)";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }  
+
+    IIDBI_clearMessages(self->messages);
+
+    if (self->closed)
+    {
+        exception = IIDBI_InterfaceError; 
+        errMsg = "cursor is already closed";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }  
+
+    IIDBI_handleWarning("DB-API extension cursor.executecolumns() used", 
+        self->messages);
+
+    connection = self->connection;
+    if (connection == (IIDBI_CONNECTION *)Py_None)
+    {
+        exception = IIDBI_InternalError; 
+        errMsg = "Invalid connection object";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }
+
+    columnSeq = PySequence_Fast(columnSet, "");
+    if (!columnSeq || !PySequence_Fast_GET_SIZE(columnSeq))
+    {
+        PyErr_Clear();
+        exception = IIDBI_InterfaceError;
+        errMsg = "parameter columns must be in sequence format";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }
+    parmCount = (int)PySequence_Fast_GET_SIZE(columnSeq);
+    columns = calloc(parmCount, sizeof(IIDBI_PARAMCOLUMN));
+    if (!columns)
+    {
+        exception = IIDBI_OperationalError;
+        errMsg = "could not allocate parameter columns";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }
+    for (i = 0; i < parmCount; i++)
+    {
+        elem = PySequence_Fast_GET_ITEM(columnSeq, i);
+        if (!IIDBI_paramColumnInit(&columns[i], elem, &count))
+        {
+            exception = IIDBI_InterfaceError;
+            errMsg = "parameter columns must be sequences or buffers";
+            result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+            goto errorExit;
+        }
+        if (paramSetSize >= 0 && count != paramSetSize)
+        {
+            exception = IIDBI_InterfaceError;
+            errMsg = "parameter columns must be of the same length";
+            result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+            goto errorExit;
+        }
+        paramSetSize = count;
+    }
+    if (paramSetSize <= 0)
+    {
+        exception = IIDBI_InterfaceError;
+        errMsg = "usage: cursor.executecolumns() parameter columns";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }
+
+    if (!self->IIDBIpstmt)
+    {
+        IIDBIpstmt = (IIDBI_STMT *)calloc(1,sizeof(IIDBI_STMT));
+        self->IIDBIpstmt = IIDBIpstmt;
+    }
+    else
+    {
+        IIDBIpstmt = self->IIDBIpstmt;
+    }
+
+    self->rowcount = -1;
+    Py_XDECREF(self->rownumber);
+    self->rownumber = Py_None;
+    Py_INCREF(self->rownumber);
+    self->rowindex = 0;
+
+    source.sendArray = IIDBI_paramSetSendColumns;
+    source.getRow = IIDBI_paramSetColumnRow;
+    source.method = "executecolumns";
+    source.sequence = NULL;
+    source.rows = NULL;
+    source.columns = columns;
+    source.parmCount = parmCount;
+    if (!IIDBI_cursorExecuteParamSet(self, IIDBIpstmt, szSqlStr, &source, 
+        paramSetSize, &result))
+        goto errorExit;
+
+    IIDBI_paramColumnRelease(columns, parmCount);
+    Py_DECREF(columnSeq);
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorExecuteColumns }}}1\n", self);
+    
+    Py_INCREF(Py_None);
+    return(Py_None);
+
+errorExit:
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorExecuteColumns }}}1\n", self);
+    if (columns)
+        IIDBI_paramColumnRelease(columns, parmCount);
+    Py_XDECREF(columnSeq);
+    if (IIDBIpstmt && self->szSqlStr)
+    {
+        free(self->szSqlStr);
+        self->szSqlStr = NULL;
+    }
+    if (result)
+    {
+        Py_INCREF(Py_None);
+        return Py_None;
+    }
+    return NULL;
+}
+
+/*{
+** Name: IIDBI_cursorExecuteParamSet
+**
+** Description:
+**     Execute a query for each row of the parameter set of executemany()
+**     or executecolumns(). The query is prepared once and the parameter
+**     bindings kept between rows. Rows are sent IIDBI_PARAMSET_SIZE at a
+**     time as parameter arrays, and those the parameter set or the
+**     driver do not allow to be sent that way one at a time.
+**
+** Inputs:
+**     self - cursor object.
+**     IIDBIpstmt - statement control block of the cursor.
+**     szSqlStr - query to be executed.
+**     paramSet - rows and the functions sending them.
+**     paramSetSize - number of rows, at least 1.
+**
+** Outputs:
+**     result - as returned by IIDBI_handleError() on failure.
+**
+** Returns:
+**     TRUE if all rows were executed, FALSE otherwise.
+**         
+** Exceptions:
+**     Query must be executed successfully and return no result set.
+**
+** Side Effects:
+**     Sets cursor.rowcount.
+**
+** History:
+**     17-Oct-2026 (agent)
+**         Created from IIDBI_cursorExecuteMany() and
+**         IIDBI_cursorExecuteColumns().
+**     17-Oct-2026 (agent)
+**         Name the failed row, counted across the parameter set, in the
+**         error raised.
+}*/
+
+static int IIDBI_cursorExecuteParamSet(IIDBI_CURSOR *self, 
+    IIDBI_STMT *IIDBIpstmt, char *szSqlStr, IIDBI_PARAMSET *paramSet, 
+    Py_ssize_t paramSetSize, int *result)
+{
+    IIDBI_DBC *IIDBIpdbc = self->connection->IIDBIpdbc;
+    PyObject *params = NULL;
+    Py_ssize_t j;
+    int batchSize;
+    RETCODE rc;
+    char errMsg[64];
+    int prepareForced = FALSE;
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorExecuteParamSet {{{1\n", self);
+
+    *result = FALSE;
+    sprintf(errMsg, "result sets not allowed for %s method", 
+        paramSet->method);
+
+    if (self->szSqlStr == NULL)
+    {
+        self->szSqlStr = strdup(szSqlStr);
+        IIDBIpstmt->prepareRequested = self->prepareRequested;
+    }
+    else if (strcmp(szSqlStr, self->szSqlStr) && self->prepareRequested)
+    {
+        /* the previous query stays prepared in the statement cache */
+        free(self->szSqlStr);
+        self->szSqlStr = strdup(szSqlStr);
+        IIDBIpstmt->prepareRequested = TRUE;
+    }
+    else
+        IIDBIpstmt->prepareRequested = self->prepareRequested;
+    IIDBIpstmt->queryTimeout = IIDBI_QUERY_TIMEOUT(self);
+
+    /*
+    ** Prepare the query once for the whole parameter set and keep the
+    ** parameter bindings between rows, only the bound values change.
+    */
+    if (paramSetSize > 1 && !IIDBIpstmt->prepareRequested)
+    {
+        IIDBIpstmt->prepareRequested = TRUE;
+        IIDBIpstmt->prepareCompleted = FALSE;
+        prepareForced = TRUE;
+    }
+    IIDBIpstmt->keepParameters = TRUE;
+
+    /*
+    ** Send the parameters IIDBI_PARAMSET_SIZE rows at a time as
+    ** column-wise arrays. Rows that cannot be sent that way, and any
+    ** rows left if the driver does not support parameter arrays, are
+    ** sent one at a time below.
+    */
+    j = 0;
+    while (paramSetSize - j > 1)
+    {
+        batchSize = (int)(paramSetSize - j);
+        if (batchSize > IIDBI_PARAMSET_SIZE)
+            batchSize = IIDBI_PARAMSET_SIZE;
+        rc = paramSet->sendArray(paramSet, self, (int)j, batchSize);
+        if (rc == DBI_SQL_NO_DATA)
+            break;
+        if (rc != DBI_SQL_SUCCESS)
+        {
+            *result = (rc == DBI_SQL_SUCCESS_WITH_INFO);
+            goto errorExit;
+        }
+
+        Py_BEGIN_ALLOW_THREADS
+        rc = dbi_cursorExecute( IIDBIpdbc, IIDBIpstmt, szSqlStr, FALSE );
+        Py_END_ALLOW_THREADS
+        if (rc == DBI_SQL_NO_DATA)
+        {
+            /* parameter arrays not supported by the driver */
+            dbi_freeDescriptor(IIDBIpstmt, 1);
+            break;
+        }
+        if (rc != DBI_SQL_SUCCESS)
+        {
+            if (IIDBIpstmt->paramsetError >= 0)
+                IIDBI_paramSetErrorRow(&IIDBIpstmt->hdr.err, 
+                    j + IIDBIpstmt->paramsetError);
+            *result = IIDBI_mapError2exception((PyObject *)self, 
+                &IIDBIpstmt->hdr.err, rc, szSqlStr);
+            dbi_freeDescriptor(IIDBIpstmt, 1);
+            goto errorExit;
+        }
+        if (IIDBIpstmt->hasResultSet)
+        {
+            *result = IIDBI_handleError((PyObject *)self, 
+                IIDBI_InterfaceError, errMsg);
+            goto errorExit;
+        }
+        Py_XDECREF(self->description);
+        self->description = Py_None;
+        Py_INCREF(self->description);
+        j += batchSize;
+    }
+
+    for (; j < paramSetSize; j++)
+    {
+        params = paramSet->getRow(paramSet, self, j, result);
+        if (!params)
+            goto errorExit;
+
+        rc = IIDBI_sendParameters(self, params);
+        if (rc != DBI_SQL_SUCCESS)
+        {
+            *result = (rc == DBI_SQL_SUCCESS_WITH_INFO);
+            goto errorExit;
+        }
+        Py_BEGIN_ALLOW_THREADS
+        rc = dbi_cursorExecute( IIDBIpdbc, IIDBIpstmt, szSqlStr, FALSE );
+        Py_END_ALLOW_THREADS
+        if (rc != DBI_SQL_SUCCESS)
+        {
+            if (rc == DBI_SQL_ERROR)
+                IIDBI_paramSetErrorRow(&IIDBIpstmt->hdr.err, j);
+            *result = IIDBI_mapError2exception((PyObject *)self, 
+                &IIDBIpstmt->hdr.err, rc, szSqlStr);
+            goto errorExit;
+        }
+        if (IIDBIpstmt->hasResultSet)
+        {
+            *result = IIDBI_handleError((PyObject *)self, 
+                IIDBI_InterfaceError, errMsg);
+            goto errorExit;
+        }
+        Py_XDECREF(self->description);
+        self->description = Py_None;
+        Py_INCREF(self->description);
+        Py_DECREF(params);
+        params = NULL;
+    }
+
+    IIDBI_releaseParameters(IIDBIpstmt, prepareForced);
+    self->rowcount = (int)paramSetSize;
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorExecuteParamSet }}}1\n", self);
+    return TRUE;
+
+errorExit:
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorExecuteParamSet }}}1\n", self);
+    Py_XDECREF(params);
+    IIDBI_releaseParameters(IIDBIpstmt, prepareForced);
+    return FALSE;
+}
+
+/*{
+** Name: IIDBI_paramSetErrorRow
+**
+** Description:
+**     Append the row of the parameter set that failed to the message of
+**     the error raised for it. Rows of the same parameter array after
+**     the failed one may have been applied.
+**
+** Inputs:
+**     err - error of the statement.
+**     row - zero based index of the row in the whole parameter set.
+**
+** Outputs:
+**     err - messageText names the row.
+**
+** Returns:
+**     None.
+**         
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     17-Oct-2026 (agent)
+**         Created.
+}*/
+
+static void IIDBI_paramSetErrorRow(IIDBI_ERROR *err, Py_ssize_t row)
+{
+    size_t len = strlen(err->messageText);
+
+    PyOS_snprintf(err->messageText + len, sizeof(err->messageText) - len,
+        " (row %ld of the parameter set)", (long)row);
+}
+
+/*{
+** Name: IIDBI_cursorExecute
+**
+** Description:
+**     Execute query.
+**
+** Inputs:
+**     self - cursor object.
+**     args - Evaluates to:
+**            szSqlStr - query to be executed.
+**            params - optional sequence of input parameters.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None.
+**         
+** Exceptions:
+**     Cursor must be open.  Query must be executed successfully.  Params 
+**     must be a sequence type.   
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     26-May-06 Ralph.Loen@ingres.com
+**         Created.
+**     16-Oct-2026 (agent)
+**         Bind result columns for block fetches, rowset size taken from
+**         cursor.arraysize.
+**     16-Oct-2026 (agent)
+**         Allocate the column buffers here, once per result set. A failed
+**         execute releases the result descriptor.
+**     16-Oct-2026 (agent)
+**         Keep the query prepared when it changes, the previous one is
+**         kept in the connection's statement cache.
+**     16-Oct-2026 (agent)
+**         Resolve the output converters for the result set.
+**     16-Oct-2026 (agent)
+**         Pass cursor.prefetch on to the column binding.
+**     16-Oct-2026 (agent)
+**         Split into IIDBI_cursorExecuteBegin() and IIDBI_cursorExecuteEnd(),
+**         shared with cursor.execute_async().
+}*/
+
+static PyObject *IIDBI_cursorExecute(IIDBI_CURSOR *self, PyObject *args)
+{
+    char *szSqlStr = NULL;
+    PyObject *params = NULL;
+    IIDBI_STMT *IIDBIpstmt = NULL;
+    IIDBI_DBC *IIDBIpdbc = NULL;
+    RETCODE rc;
+    PyObject *exception;
+    char *errMsg;
+    int result = FALSE;
+    
+    DBPRINTF(DBI_TRC_ENTRY)("%p: IIDBI_cursorExecute {{{1\n", self);
+
+    if (!PyArg_ParseTuple(args, "s|O", &szSqlStr, &params)) 
+    {
+        exception = IIDBI_InterfaceError; 
+        errMsg = "usage: cursor.execute()";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        IIDBI_cursorExecuteAbort(self, NULL);
+        goto errorExit;
+    }  
+
+    IIDBIpstmt = IIDBI_cursorExecuteBegin(self, szSqlStr, params, &result);
+    if (!IIDBIpstmt)
+        goto errorExit;
+
+    IIDBIpdbc = self->connection->IIDBIpdbc;
+    Py_BEGIN_ALLOW_THREADS
+    rc = dbi_cursorExecute( IIDBIpdbc, IIDBIpstmt, szSqlStr, FALSE );
+    Py_END_ALLOW_THREADS
+
+    DBPRINTF(DBI_TRC_ENTRY)("%p: IIDBI_cursorExecute }}}1\n", self);
+    return IIDBI_cursorExecuteEnd(self, IIDBIpstmt, rc, szSqlStr);
+
+errorExit:
+    DBPRINTF(DBI_TRC_STAT)("%p: IIDBI_cursorExecute errorExit\n", self);
+    DBPRINTF(DBI_TRC_ENTRY)("%p: IIDBI_cursorExecute }}}1\n", self);
+    if (result)
+    {
+        Py_INCREF(Py_None);
+        return Py_None;
+    }
+    else
+        return NULL;
+}
+
+/*{
+** Name: IIDBI_cursorExecuteBegin
+**
+** Description:
+**     First half of IIDBI_cursorExecute(), up to the execute itself:
+**     resets the cursor for the new query and sends the parameters.
+**     An asynchronous execute still in progress is completed first.
+**
+** Inputs:
+**     self - cursor object.
+**     szSqlStr - query to be executed.
+**     params - sequence of input parameters or NULL.
+**
+** Outputs:
+**     result - on error, TRUE if the error handler dealt with it.
+**
+** Returns:
+**     The statement to execute, NULL on error.
+**
+** Exceptions:
+**     Cursor must be open. Params must be a sequence type.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created from IIDBI_cursorExecute().
+**     16-Oct-2026 (agent)
+**         Pass the query timeout on to the statement.
+}*/
+
+static IIDBI_STMT *IIDBI_cursorExecuteBegin(IIDBI_CURSOR *self, 
+    char *szSqlStr, PyObject *params, int *result)
+{
+    IIDBI_STMT *IIDBIpstmt = NULL;
+    IIDBI_CONNECTION *connection = NULL;
+    RETCODE rc;
+    PyObject *exception;
+    char *errMsg;
+
+    *result = FALSE;
+    if (self->asyncExec && IIDBI_asyncExecJoin(self, TRUE) < 0)
+        return NULL;
+
+    IIDBI_clearMessages(self->messages);
+
+    if (self->closed)
+    {
+        exception = IIDBI_InterfaceError; 
+        errMsg = "cursor is already closed";
+        *result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }
+	
+    if (!self->IIDBIpstmt)
+    {
+        IIDBIpstmt = (IIDBI_STMT *)calloc(1,sizeof(IIDBI_STMT));
+        self->IIDBIpstmt = IIDBIpstmt;
+    }
+    else
+    {
+        IIDBIpstmt = self->IIDBIpstmt;
+    }
+
+    connection = self->connection;
+    if (connection == (IIDBI_CONNECTION *)Py_None)
+    {
+        exception = IIDBI_InternalError; 
+        errMsg = "Invalid connection object";
+        *result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }
+
+    Py_XDECREF(self->description);
+    self->description = Py_None;
+    Py_INCREF(self->description);
+
+    Py_XDECREF(self->rownumber);
+    self->rownumber = Py_None;
+    Py_INCREF(self->rownumber);
+
+    self->rowcount = -1;
+    self->rowindex = 0;
+
+    IIDBIpstmt->inputSegmentSize = self->inputSegmentSize;
+    IIDBIpstmt->inputSegmentLen = self->inputSegmentLen;
+    IIDBIpstmt->outputSegmentSize = self->outputSegmentSize;
+    IIDBIpstmt->outputColumnIndex = self->outputColumnIndex;
+    IIDBIpstmt->queryTimeout = IIDBI_QUERY_TIMEOUT(self);
+    if (self->szSqlStr == NULL)
+    {
+        self->szSqlStr = strdup(szSqlStr);
+        IIDBIpstmt->prepareRequested = self->prepareRequested;
+    }
+    else if (strcmp(szSqlStr, self->szSqlStr) && self->prepareRequested)
+    {
+        /* the previous query stays prepared in the statement cache */
+        free(self->szSqlStr);
+        self->szSqlStr = strdup(szSqlStr);
+        IIDBIpstmt->prepareRequested = TRUE;
+    }
+    else
+        IIDBIpstmt->prepareRequested = self->prepareRequested;
+
+    if (IIDBI_IsTrue(params))
+    {
+         rc = IIDBI_sendParameters(self, params);
+         switch (rc)
+         {
+             case DBI_SQL_SUCCESS:
+                 break;
+                    
+             case DBI_SQL_SUCCESS_WITH_INFO:
+                 *result = 1;
+                 goto errorExit;
+                 break;
+
+             default:
+                 *result = 0;
+                 goto errorExit;
+                 break;
+         } 
+    }  /* if (params) */
+    return IIDBIpstmt;
+
+errorExit:
+    IIDBI_cursorExecuteAbort(self, IIDBIpstmt);
+    return NULL;
+}
+
+/*{
+** Name: IIDBI_cursorExecuteEnd
+**
+** Description:
+**     Second half of IIDBI_cursorExecute(), once dbi_cursorExecute() 
+**     has returned: sets cursor.rowcount and, for a query returning
+**     rows, binds the result columns and builds cursor.description.
+**
+** Inputs:
+**     self - cursor object.
+**     IIDBIpstmt - the executed statement.
+**     rc - dbi_cursorExecute() return code.
+**     szSqlStr - the query, for error messages.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None.
+**         
+** Exceptions:
+**     Query must be executed successfully.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created from IIDBI_cursorExecute().
+}*/
+
+static PyObject *IIDBI_cursorExecuteEnd(IIDBI_CURSOR *self, 
+    IIDBI_STMT *IIDBIpstmt, RETCODE rc, char *szSqlStr)
+{
+    int i;
+    PyObject *temp;
+    PyObject *exception;
+    char *errMsg;
+    int result = FALSE;
+
+    if (rc != DBI_SQL_SUCCESS)
+    {
+        result = IIDBI_mapError2exception((PyObject *)self, 
+            &IIDBIpstmt->hdr.err, rc, szSqlStr); 
+        goto errorExit;
+    }
+    self->rowcount = IIDBIpstmt->rowCount;
+    if (IIDBIpstmt->hasResultSet)
+    {
+        IIDBI_DESCRIPTOR *descriptor;
+        PyObject *descRow = NULL;
+        int type = -1;
+
+        Py_XDECREF(self->description);
+        self->description = PyList_New(0);
+        rc = dbi_allocDescriptor(IIDBIpstmt, IIDBIpstmt->descCount, 0);
+        if (rc != DBI_SQL_SUCCESS)
+        {
+            exception = IIDBI_OperationalError; 
+            errMsg = "Could not allocate descriptor";
+            result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+            goto errorExit;
+        }
+        Py_BEGIN_ALLOW_THREADS
+        rc = dbi_describeColumns(IIDBIpstmt);
+        Py_END_ALLOW_THREADS
+        if (rc != DBI_SQL_SUCCESS)
+        {
+            exception = IIDBI_OperationalError, 
+            errMsg = "Could not describe columns";
+            result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+            goto errorExit;
+        }
+        IIDBIpstmt->arraySize = self->arraysize;
+        IIDBIpstmt->prefetch = self->prefetch;
+        Py_BEGIN_ALLOW_THREADS
+        rc = dbi_bindColumns(IIDBIpstmt);
+        Py_END_ALLOW_THREADS
+        if (rc != DBI_SQL_SUCCESS)
+        {
+            result = IIDBI_mapError2exception((PyObject *)self, 
+                &IIDBIpstmt->hdr.err, rc, szSqlStr); 
+            goto errorExit;
+        }
+        rc = dbi_allocData(IIDBIpstmt);
+        if (rc != DBI_SQL_SUCCESS)
+        {
+            exception = IIDBI_OperationalError; 
+            errMsg = "Could not allocate data";
+            result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+            goto errorExit;
+        }
+        for (i = 0; i < IIDBIpstmt->descCount; i++)
+        {
+            descriptor = IIDBIpstmt->descriptor[i];
+            descRow = PyTuple_New(7);
+	    temp = PyString_FromString(descriptor->columnName);
+            rc = PyTuple_SetItem( descRow, 0, temp);
+            type = IIDBI_mapType(descriptor->type);
+            if (type == DBI_UNKNOWN_TYPE)
+            {
+                exception = IIDBI_OperationalError; 
+                errMsg = "Invalid data type";
+                result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+                goto errorExit;
+            }
+
+            temp = PyInt_FromLong((long)type);
+            rc = PyTuple_SetItem( descRow, 1, temp);
+
+	    temp = PyInt_FromLong((long)descriptor->displaySize);
+            rc = PyTuple_SetItem( descRow, 2, temp);
+
+            temp = PyInt_FromLong((long)descriptor->internalSize);
+            rc = PyTuple_SetItem( descRow, 3, temp);
+
+            temp = PyInt_FromLong((long)descriptor->precision);
+            rc = PyTuple_SetItem( descRow, 4, temp);
+
+            temp = PyInt_FromLong((long)descriptor->scale);
+            rc = PyTuple_SetItem( descRow, 5, temp);
+
+            temp = PyInt_FromLong((long)descriptor->nullable);
+            rc = PyTuple_SetItem( descRow, 6, temp);
+
+            rc = PyList_Append( self->description, descRow);
+            Py_XDECREF(descRow);
+        }
+        if (IIDBI_convertResolve(self, IIDBIpstmt, &errMsg))
+        {
+            exception = IIDBI_ProgrammingError; 
+            result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+            goto errorExit;
+        }
+    }
+    else
+    {
+        Py_XDECREF(self->description);
+        self->description = Py_None;
+        Py_INCREF(self->description);
+        IIDBI_convertRelease(self);
+    }
+
+    Py_INCREF(Py_None);
+    return(Py_None);
+
+errorExit:
+    DBPRINTF(DBI_TRC_STAT)("%p: IIDBI_cursorExecuteEnd errorExit\n", self);
+    IIDBI_cursorExecuteAbort(self, IIDBIpstmt);
+    if (result)
+    {
+        Py_INCREF(Py_None);
+        return Py_None;
+    }
+    else
+        return NULL;
+}
+
+/*{
+** Name: IIDBI_cursorExecuteAbort
+**
+** Description:
+**     Clean up after a failed execute: forget the query and release the
+**     result descriptor.
+**
+** Inputs:
+**     self - cursor object.
+**     IIDBIpstmt - statement or NULL.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None.
+**
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created from IIDBI_cursorExecute().
+}*/
+
+static void IIDBI_cursorExecuteAbort(IIDBI_CURSOR *self, 
+    IIDBI_STMT *IIDBIpstmt)
+{
+    if (self->szSqlStr)
+    {
+        free(self->szSqlStr);
+        self->szSqlStr = NULL;
+    }
+    if (IIDBIpstmt && IIDBIpstmt->descCount)
+        dbi_freeDescriptor(IIDBIpstmt, 0);
+}
+
+/*{
+** Name: IIDBI_cursorExecuteAsync
+**
+** Description:
+**     cursor.execute_async(query[, params]). As cursor.execute(), but
+**     the query runs in a worker thread and an asynchronous execute 
+**     object is returned at once. Its done(), wait([timeout]) and 
+**     fileno() methods tell when the execute is finished; the cursor
+**     is then updated as by cursor.execute() and errors are raised
+**     from the method that found the execute finished.
+**
+**     Any other use of the cursor waits for a pending execute first.
+**
+** Inputs:
+**     self - cursor object.
+**     args - query and optional sequence of parameters.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     Asynchronous execute object.
+**         
+** Exceptions:
+**     Cursor must be open.  Params must be a sequence type.   
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+**     17-Oct-2026 (agent)
+**         The cursor holds the asynchronous execute object while it is
+**         pending, instead of the object holding the cursor.
+}*/
+
+static PyObject *IIDBI_cursorExecuteAsync(IIDBI_CURSOR *self, 
+    PyObject *args)
+{
+    char *szSqlStr = NULL;
+    PyObject *params = NULL;
+    IIDBI_ASYNCEXEC *handle = NULL;
+    IIDBI_STMT *IIDBIpstmt = NULL;
+    PyObject *exception;
+    char *errMsg;
+    int result = FALSE;
+    
+    DBPRINTF(DBI_TRC_ENTRY)("%p: IIDBI_cursorExecuteAsync {{{1\n", self);
+
+    if (!PyArg_ParseTuple(args, "s|O", &szSqlStr, &params)) 
+    {
+        exception = IIDBI_InterfaceError; 
+        errMsg = "usage: cursor.execute_async()";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }  
+
+    IIDBI_handleWarning("DB-API extension cursor.execute_async() used", 
+        NULL);
+
+    handle = PyObject_New(IIDBI_ASYNCEXEC, &IIDBI_asyncExecType);
+    if (!handle)
+        goto errorExit;
+    handle->cursor = NULL;
+    handle->pdbc = NULL;
+    handle->pstmt = NULL;
+    handle->query = strdup(szSqlStr);
+    handle->params = NULL;
+    handle->rc = DBI_SQL_SUCCESS;
+    handle->finished = TRUE;
+    handle->done = PyThread_allocate_lock();
+#ifdef WIN32
+    handle->event = CreateEvent(NULL, TRUE, FALSE, NULL);
+    if (!handle->query || !handle->done || !handle->event)
+#else
+    handle->pipe[0] = handle->pipe[1] = -1;
+    if (!handle->query || !handle->done || pipe(handle->pipe))
+#endif /* WIN32 */
+    {
+        exception = IIDBI_OperationalError; 
+        errMsg = "Could not start the asynchronous execute";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }
+
+    /*
+    ** The values bound may be the parameters' own storage, keep them
+    ** until the execute is finished.
+    */
+    if (IIDBI_IsTrue(params))
+    {
+        handle->params = PySequence_Tuple(params);
+        if (!handle->params)
+            goto errorExit;
+    }
+
+    IIDBIpstmt = IIDBI_cursorExecuteBegin(self, szSqlStr, handle->params, 
+        &result);
+    if (!IIDBIpstmt)
+        goto errorExit;
+
+    /*
+    ** The cursor holds the object until the execute is finished, the
+    ** object only borrows the cursor: dropping either is safe, and a
+    ** cursor being deallocated waits for the worker with the GIL
+    ** released.
+    */
+    handle->cursor = self;
+    handle->pdbc = self->connection->IIDBIpdbc;
+    handle->pstmt = IIDBIpstmt;
+    handle->finished = FALSE;
+    Py_INCREF(handle);
+    self->asyncExec = handle;
+    self->connection->asyncPending++;
+
+    PyThread_acquire_lock(handle->done, WAIT_LOCK);
+    if (PyThread_start_new_thread(IIDBI_asyncExecWorker, handle) == -1)
+    {
+        /* no thread to run it in, execute it now */
+        DBPRINTF(DBI_TRC_STAT)("%p: IIDBI_cursorExecuteAsync no thread\n", 
+            self);
+        Py_BEGIN_ALLOW_THREADS
+        IIDBI_asyncExecWorker(handle);
+        Py_END_ALLOW_THREADS
+    }
+
+    DBPRINTF(DBI_TRC_ENTRY)("%p: IIDBI_cursorExecuteAsync }}}1\n", self);
+    return (PyObject *)handle;
+
+errorExit:
+    DBPRINTF(DBI_TRC_STAT)("%p: IIDBI_cursorExecuteAsync errorExit\n", self);
+    DBPRINTF(DBI_TRC_ENTRY)("%p: IIDBI_cursorExecuteAsync }}}1\n", self);
+    Py_XDECREF(handle);
+    if (result)
+    {
+        Py_INCREF(Py_None);
+        return Py_None;
+    }
+    else
+        return NULL;
+}
+
+/*{
+** Name: IIDBI_asyncExecWorker
+**
+** Description:
+**     Thread running the query of cursor.execute_async(). The result is
+**     left in the asynchronous execute object for 
+**     IIDBI_asyncExecFinish().
+**
+** Inputs:
+**     arg - asynchronous execute object.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None.
+**
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     Runs without the GIL. Signals the pipe, then releases the done
+**     lock.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static void IIDBI_asyncExecWorker(void *arg)
+{
+    IIDBI_ASYNCEXEC *self = (IIDBI_ASYNCEXEC *)arg;
+
+    self->rc = dbi_cursorExecute(self->pdbc, self->pstmt, self->query, 
+        FALSE);
+#ifdef WIN32
+    SetEvent(self->event);
+#else
+    /* never read, the pipe stays readable once signalled */
+    while (write(self->pipe[1], "", 1) < 0 && errno == EINTR)
+        ;
+#endif /* WIN32 */
+    PyThread_release_lock(self->done);
+}
+
+/*{
+** Name: IIDBI_asyncExecFinish
+**
+** Description:
+**     Complete an asynchronous execute once the worker is done: the
+**     cursor is updated as by cursor.execute() and the cursor's 
+**     reference to the object is released. The caller holds the done
+**     lock, which is released; an execute already finished by another
+**     thread is left alone. The caller must hold its own reference to
+**     the object.
+**
+** Inputs:
+**     self - asynchronous execute object.
+**     end - FALSE to leave the cursor as it is, as it is being closed.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None, NULL with the execute's error raised.
+**
+** Exceptions:
+**     Query must be executed successfully.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+**     17-Oct-2026 (agent)
+**         Release the cursor's reference to the object, the object no
+**         longer holds one to the cursor.
+}*/
+
+static PyObject *IIDBI_asyncExecFinish(IIDBI_ASYNCEXEC *self, int end)
+{
+    IIDBI_CURSOR *cursor = self->cursor;
+    PyObject *value;
+
+    PyThread_release_lock(self->done);
+    if (self->finished)
+    {
+        Py_INCREF(Py_None);
+        return Py_None;
+    }
+
+    self->finished = TRUE;
+    cursor->asyncExec = NULL;
+    cursor->connection->asyncPending--;
+    if (end)
+        value = IIDBI_cursorExecuteEnd(cursor, self->pstmt, self->rc, 
+            self->query);
+    else
+    {
+        value = Py_None;
+        Py_INCREF(value);
+    }
+
+    Py_CLEAR(self->params);
+    free(self->query);
+    self->query = NULL;
+    self->cursor = NULL;
+    Py_DECREF(self);
+    return value;
+}
+
+/*{
+** Name: IIDBI_asyncExecJoin
+**
+** Description:
+**     Wait for the pending asynchronous execute of a cursor and finish
+**     it, before the cursor is used again.
+**
+** Inputs:
+**     cursor - cursor object with a pending asynchronous execute.
+**     end - FALSE to leave the cursor as it is, as it is being closed.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     0, -1 with the execute's error raised.
+**
+** Exceptions:
+**     Query must be executed successfully.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static int IIDBI_asyncExecJoin(IIDBI_CURSOR *cursor, int end)
+{
+    IIDBI_ASYNCEXEC *handle = cursor->asyncExec;
+    PyObject *value;
+
+    Py_INCREF(handle);
+    Py_BEGIN_ALLOW_THREADS
+    PyThread_acquire_lock(handle->done, WAIT_LOCK);
+    Py_END_ALLOW_THREADS
+    value = IIDBI_asyncExecFinish(handle, end);
+    Py_DECREF(handle);
+    if (!value)
+        return -1;
+    Py_DECREF(value);
+    return 0;
+}
+
+/*{
+** Name: IIDBI_asyncExecDone
+**
+** Description:
+**     asyncexecute.done(). Tell whether the execute is finished, 
+**     without waiting.
+**
+** Inputs:
+**     self - asynchronous execute object.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     True if finished, False otherwise.
+**
+** Exceptions:
+**     Query must be executed successfully.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static PyObject *IIDBI_asyncExecDone(IIDBI_ASYNCEXEC *self)
+{
+    PyObject *value;
+
+    if (!self->finished)
+    {
+        if (!PyThread_acquire_lock(self->done, NOWAIT_LOCK))
+        {
+            Py_INCREF(Py_False);
+            return Py_False;
+        }
+        value = IIDBI_asyncExecFinish(self, TRUE);
+        if (!value)
+            return NULL;
+        Py_DECREF(value);
+    }
+    Py_INCREF(Py_True);
+    return Py_True;
+}
+
+/*{
+** Name: IIDBI_asyncExecWait
+**
+** Description:
+**     asyncexecute.wait([timeout]). Wait until the execute is finished,
+**     or for at most timeout seconds.
+**
+** Inputs:
+**     self - asynchronous execute object.
+**     args - optional timeout in seconds, None to wait until finished.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     True if finished, False if the timeout expired.
+**
+** Exceptions:
+**     Query must be executed successfully.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static PyObject *IIDBI_asyncExecWait(IIDBI_ASYNCEXEC *self, PyObject *args)
+{
+    PyObject *timeout = Py_None;
+    PyObject *value;
+    double seconds = -1.0;
+    int ready = TRUE;
+#ifndef WIN32
+    struct pollfd fd;
+#endif /* WIN32 */
+
+    if (!PyArg_ParseTuple(args, "|O", &timeout)) 
+        return NULL;
+    if (timeout != Py_None)
+    {
+        seconds = PyFloat_AsDouble(timeout);
+        if (seconds == -1.0 && PyErr_Occurred())
+            return NULL;
+        if (seconds < 0.0)
+            seconds = 0.0;
+    }
+
+    if (!self->finished)
+    {
+        Py_BEGIN_ALLOW_THREADS
+        if (seconds >= 0.0)
+        {
+#ifdef WIN32
+            ready = (WaitForSingleObject(self->event, 
+                (DWORD)(seconds * 1000)) == WAIT_OBJECT_0);
+#else
+            fd.fd = self->pipe[0];
+            fd.events = POLLIN;
+            fd.revents = 0;
+            ready = (poll(&fd, 1, (int)(seconds * 1000)) > 0);
+#endif /* WIN32 */
+        }
+        if (ready)
+            PyThread_acquire_lock(self->done, WAIT_LOCK);
+        Py_END_ALLOW_THREADS
+        if (!ready)
+        {
+            Py_INCREF(Py_False);
+            return Py_False;
+        }
+        value = IIDBI_asyncExecFinish(self, TRUE);
+        if (!value)
+            return NULL;
+        Py_DECREF(value);
+    }
+    Py_INCREF(Py_True);
+    return Py_True;
+}
+
+/*{
+** Name: IIDBI_asyncExecFileno
+**
+** Description:
+**     asyncexecute.fileno(). File descriptor that becomes readable when
+**     the worker is done, for select() or poll(). done() or wait() must
+**     still be called to finish the execute.
+**
+** Inputs:
+**     self - asynchronous execute object.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     File descriptor.
+**
+** Exceptions:
+**     Not supported on Windows.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static PyObject *IIDBI_asyncExecFileno(IIDBI_ASYNCEXEC *self)
+{
+#ifdef WIN32
+    PyErr_SetString(IIDBI_NotSupportedError, 
+        "asyncexecute.fileno() is not supported on Windows");
+    return NULL;
+#else
+    return PyInt_FromLong((long)self->pipe[0]);
+#endif /* WIN32 */
+}
+
+/*{
+** Name: IIDBI_asyncExecDestructor
+**
+** Description:
+**     Deallocate an asynchronous execute object. The cursor holds the
+**     object while the execute is pending, so it is finished by now.
+**
+** Inputs:
+**     self - asynchronous execute object.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None.
+**
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+**     17-Oct-2026 (agent)
+**         No longer waits for a pending execute with the GIL held.
+}*/
+
+static void IIDBI_asyncExecDestructor(IIDBI_ASYNCEXEC *self)
+{
+    if (self->done)
+        PyThread_free_lock(self->done);
+#ifdef WIN32
+    if (self->event)
+        CloseHandle(self->event);
+#else
+    if (self->pipe[0] >= 0)
+        close(self->pipe[0]);
+    if (self->pipe[1] >= 0)
+        close(self->pipe[1]);
+#endif /* WIN32 */
+    Py_XDECREF(self->params);
+    if (self->query)
+        free(self->query);
+    PyObject_Del(self);
+}
+
+/*{
+** Name: IIDBI_poolNew
+**
+** Description:
+**     ingresdbi.ConnectionPool(). Create a connection pool. The
+**     keywords minsize, maxsize, idletimeout and validate configure the
+**     pool, the remaining arguments are those of ingresdbi.connect() and
+**     are used for every connection the pool opens. minsize connections
+**     are opened straight away.
+**
+** Inputs:
+**     type - pool type.
+**     args - connect() arguments.
+**     keywords - pool and connect() keywords.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     Connection pool object.
+**
+** Exceptions:
+**     The pool keywords must be valid. The minsize connections must be
+**     opened.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     17-Oct-2026 (agent)
+**         Created.
+**     17-Oct-2026 (agent)
+**         Report a bad idletimeout or validate keyword as such, instead of
+**         the usage error.
+}*/
+
+static PyObject *IIDBI_poolNew(PyTypeObject *type, PyObject *args, 
+    PyObject *keywords)
+{
+    IIDBI_POOL *pool = NULL;
+    IIDBI_CONNECTION *conn;
+    IIDBI_DBC *pdbc;
+    PyObject *value;
+    long number;
+    int i;
+    static char *poolKeywords[] = 
+    {
+        "minsize", "maxsize", "idletimeout", "validate", NULL
+    };
+
+    DBPRINTF(DBI_TRC_RET)("IIDBI_poolNew {{{1\n");
+
+    IIDBI_handleWarning("DB-API extension ingresdbi.ConnectionPool() used",
+        NULL);
+
+    pool = PyObject_New(IIDBI_POOL, type);
+    if (!pool)
+        goto errorExit;
+    pool->args = args;
+    Py_INCREF(pool->args);
+    pool->keywords = NULL;
+    pool->minSize = 0;
+    pool->maxSize = IIDBI_POOL_MAX_SIZE;
+    pool->idleTimeout = -1;
+    pool->validate = NULL;
+    pool->size = 0;
+    pool->idleCount = 0;
+    pool->idle = NULL;
+    pool->waitHead = NULL;
+    pool->waitTail = NULL;
+    pool->waitCount = 0;
+    pool->closed = FALSE;
+    pool->autocommit = FALSE;
+    pool->decimalMode = IIDBI_DECIMAL_DECIMAL;
+    pool->trace = 0;
+    pool->connects = 0;
+    pool->disconnects = 0;
+    pool->acquires = 0;
+    pool->releases = 0;
+    pool->waits = 0;
+    pool->timeouts = 0;
+    pool->validationFailures = 0;
+
+    /*
+    ** Take the pool's own keywords out of a copy of the keywords, the
+    ** rest is passed to IIDBI_connect().
+    */
+    if (keywords)
+    {
+        pool->keywords = PyDict_Copy(keywords);
+        if (!pool->keywords)
+            goto errorExit;
+    }
+    for (i = 0; pool->keywords && poolKeywords[i]; i++)
+    {
+        value = PyDict_GetItemString(pool->keywords, poolKeywords[i]);
+        if (!value)
+            continue;
+        Py_INCREF(value);
+        PyDict_DelItemString(pool->keywords, poolKeywords[i]);
+        switch (i)
+        {
+        case 0:
+        case 1:
+            number = PyInt_Check(value) || PyLong_Check(value) ?
+                PyInt_AsLong(value) : -1;
+            if (number == -1 && PyErr_Occurred())
+                PyErr_Clear();
+            if (number < (i ? 1 : 0) || number > INT_MAX)
+                number = -1;
+            if (i)
+                pool->maxSize = (int)number;
+            else
+                pool->minSize = (int)number;
+            break;
+
+        case 2:
+            if (IIDBI_timeoutArg(value, &pool->idleTimeout))
+            {
+                PyErr_SetString(IIDBI_InterfaceError, 
+                    "idletimeout must be None or a number of seconds");
+                Py_DECREF(value);
+                goto errorExit;
+            }
+            break;
+
+        case 3:
+            if (PyString_Check(value))
+                pool->validate = strdup(PyString_AS_STRING(value));
+            else if (value != Py_None)
+            {
+                PyErr_SetString(IIDBI_InterfaceError, 
+                    "validate must be None or a query string");
+                Py_DECREF(value);
+                goto errorExit;
+            }
+            break;
+        }
+        Py_DECREF(value);
+    }
+    if (pool->minSize < 0 || pool->maxSize < 1 || 
+        pool->minSize > pool->maxSize)
+    {
+        PyErr_SetString(IIDBI_InterfaceError, "usage: ingresdbi.ConnectionPool(minsize=count, maxsize=count, idletimeout=seconds, validate=query, connect() arguments)");
+        goto errorExit;
+    }
+
+    while (pool->size < pool->minSize)
+    {
+        pool->size++;
+        conn = IIDBI_poolOpen(pool);
+        if (!conn)
+            goto errorExit;
+        pdbc = IIDBI_poolDetach(conn);
+        Py_DECREF(conn);
+        IIDBI_poolHandOff(pool, pdbc);
+    }
+
+    DBPRINTF(DBI_TRC_RET)("IIDBI_poolNew }}}1\n");
+    return (PyObject *)pool;
+
+errorExit:
+    DBPRINTF(DBI_TRC_RET)("IIDBI_poolNew }}}1\n");
+    Py_XDECREF(pool);
+    return NULL;
+}
+
+/*{
+** Name: IIDBI_poolConnect
+**
+** Description:
+**     pool.connect([timeout]). Return a connection object for an idle
+**     connection of the pool, most recently released first, after 
+**     running the validation query on it if the pool has one. A 
+**     connection failing validation is closed and the next one tried.
+**     With no idle connection a new one is opened, unless the pool is
+**     at its maximum size; the caller then waits, first come first
+**     served, for a connection to be released, for at most timeout 
+**     seconds if given.
+**
+**     Closing the connection object returns the connection to the pool.
+**
+** Inputs:
+**     self - connection pool object.
+**     args - optional timeout in seconds.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     Connection object.
+**
+** Exceptions:
+**     Pool must be open. A connection must become available within the
+**     timeout. A new connection must be opened.
+**
+** Side Effects:
+**     Idle connections past the idle timeout are closed.
+**
+** History:
+**     17-Oct-2026 (agent)
+**         Created.
+}*/
+
+static PyObject *IIDBI_poolConnect(IIDBI_POOL *self, PyObject *args)
+{
+    PyObject *timeout = Py_None;
+    double seconds = -1.0;
+    IIDBI_POOLENTRY *entry;
+    IIDBI_POOLWAITER waiter;
+    IIDBI_CONNECTION *conn = NULL;
+    IIDBI_DBC *pdbc;
+    RETCODE rc;
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_poolConnect {{{1\n", self);
+
+    if (!PyArg_ParseTuple(args, "|O", &timeout)) 
+        goto errorExit;
+    if (timeout != Py_None)
+    {
+        seconds = PyFloat_AsDouble(timeout);
+        if (seconds == -1.0 && PyErr_Occurred())
+            goto errorExit;
+        if (seconds < 0.0)
+            seconds = 0.0;
+    }
+
+    for (;;)
+    {
+        if (self->closed)
+        {
+            PyErr_SetString(IIDBI_InterfaceError, 
+                "connection pool is closed");
+            goto errorExit;
+        }
+
+        IIDBI_poolPrune(self, FALSE);
+
+        if (self->idle)
+        {
+            entry = self->idle;
+            self->idle = entry->next;
+            self->idleCount--;
+            pdbc = entry->pdbc;
+            free(entry);
+
+            if (self->validate)
+            {
+                Py_BEGIN_ALLOW_THREADS
+                rc = dbi_connectionValidate(pdbc, self->validate);
+                Py_END_ALLOW_THREADS
+                if (rc != DBI_SQL_SUCCESS)
+                {
+                    self->validationFailures++;
+                    IIDBI_poolDisconnect(self, pdbc);
+                    IIDBI_poolDrop(self);
+                    continue;
+                }
+            }
+            conn = IIDBI_poolWrap(self, pdbc);
+            break;
+        }
+
+        if (self->size < self->maxSize)
+        {
+            self->size++;
+            conn = IIDBI_poolOpen(self);
+            break;
+        }
+
+        if (IIDBI_poolWait(self, &waiter, seconds))
+            goto errorExit;
+        if (!waiter.granted)
+        {
+            self->timeouts++;
+            PyErr_SetString(IIDBI_OperationalError, 
+                "timed out waiting for a pooled connection");
+            goto errorExit;
+        }
+        if (waiter.pdbc)
+        {
+            /* just released by its last user, not validated again */
+            conn = IIDBI_poolWrap(self, waiter.pdbc);
+            break;
+        }
+        if (self->closed)
+        {
+            IIDBI_poolDrop(self);
+            continue;
+        }
+        conn = IIDBI_poolOpen(self);
+        break;
+    }
+    if (!conn)
+        goto errorExit;
+
+    self->acquires++;
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_poolConnect }}}1\n", self);
+    return (PyObject *)conn;
+
+errorExit:
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_poolConnect }}}1\n", self);
+    return NULL;
+}
+
+/*{
+** Name: IIDBI_poolClose
+**
+** Description:
+**     pool.close(). Close the idle connections of the pool. Connections
+**     in use are closed when they are returned. Threads waiting for a
+**     connection are woken and fail.
+**
+** Inputs:
+**     self - connection pool object.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None.
+**
+** Exceptions:
+**     Pool must be open.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     17-Oct-2026 (agent)
+**         Created.
+}*/
+
+static PyObject *IIDBI_poolClose(IIDBI_POOL *self)
+{
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_poolClose {{{1\n", self);
+
+    if (self->closed)
+    {
+        PyErr_SetString(IIDBI_InterfaceError, 
+            "connection pool is already closed");
+        DBPRINTF(DBI_TRC_RET)("%p: IIDBI_poolClose }}}1\n", self);
+        return NULL;
+    }
+
+    self->closed = TRUE;
+
+    /* each waiter is granted a place it gives back, see IIDBI_poolDrop() */
+    while (self->waitHead)
+    {
+        self->size++;
+        IIDBI_poolGrant(self, NULL);
+    }
+    IIDBI_poolPrune(self, TRUE);
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_poolClose }}}1\n", self);
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+/*{
+** Name: IIDBI_poolGetStats
+**
+** Description:
+**     Get the pool.stats attribute, a dictionary of the pool's
+**     configured and current size and of counts since it was created:
+**
+**     minsize, maxsize     - configured size.
+**     size                 - connections open or being opened.
+**     idle, in_use         - of size, connections idle and in use.
+**     waiting              - threads waiting in pool.connect().
+**     connects             - connections opened.
+**     disconnects          - connections closed.
+**     acquires, releases   - connections handed out and returned.
+**     waits, timeouts      - pool.connect() calls that waited, and of
+**                            those the ones that timed out.
+**     validation_failures  - idle connections that failed validation.
+**
+** Inputs:
+**     self - connection pool object.
+**     closure - definition data (unused).
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     New reference to the dictionary.
+**
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     17-Oct-2026 (agent)
+**         Created.
+}*/
+
+static PyObject *IIDBI_poolGetStats(IIDBI_POOL *self, void *closure)
+{
+    return Py_BuildValue("{s:i,s:i,s:i,s:i,s:i,s:i,s:k,s:k,s:k,s:k,s:k,s:k,s:k}",
+        "minsize", self->minSize,
+        "maxsize", self->maxSize,
+        "size", self->size,
+        "idle", self->idleCount,
+        "in_use", self->size - self->idleCount,
+        "waiting", self->waitCount,
+        "connects", self->connects,
+        "disconnects", self->disconnects,
+        "acquires", self->acquires,
+        "releases", self->releases,
+        "waits", self->waits,
+        "timeouts", self->timeouts,
+        "validation_failures", self->validationFailures);
+}
+
+/*{
+** Name: IIDBI_poolRelease
+**
+** Description:
+**     Return the connection of a pooled connection object to its pool.
+**     The object's open cursors are closed and the transaction is
+**     rolled back; a connection that cannot be rolled back is closed
+**     instead of being reused. The object is left closed.
+**
+** Inputs:
+**     conn - connection object taken from a pool.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None.
+**
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     Releases the object's reference to the pool.
+**
+** History:
+**     17-Oct-2026 (agent)
+**         Created.
+}*/
+
+static void IIDBI_poolRelease(IIDBI_CONNECTION *conn)
+{
+    IIDBI_POOL *pool = conn->pool;
+    IIDBI_DBC *pdbc;
+    IIDBI_CURSOR *cursor;
+    RETCODE rc = DBI_SQL_ERROR;
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_poolRelease {{{1\n", conn);
+
+    /*
+    ** Release the cursors' statement handles while the connection is
+    ** still open, the next user of the connection does not see them.
+    */
+    while ((cursor = conn->cursors) != NULL)
+    {
+        cursor->closed = TRUE;
+        IIDBI_cursorCleanup(cursor);
+    }
+
+    pdbc = IIDBI_poolDetach(conn);
+    if (pdbc)
+    {
+        Py_BEGIN_ALLOW_THREADS
+        rc = dbi_connectionRollback(pdbc);
+        Py_END_ALLOW_THREADS
+    }
+
+    pool->releases++;
+    if (rc == DBI_SQL_SUCCESS)
+        IIDBI_poolHandOff(pool, pdbc);
+    else
+    {
+        if (pdbc)
+            IIDBI_poolDisconnect(pool, pdbc);
+        IIDBI_poolDrop(pool);
+    }
+    Py_DECREF(pool);
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_poolRelease }}}1\n", conn);
+}
+
+/*{
+** Name: IIDBI_poolOpen
+**
+** Description:
+**     Open a new connection for a pool, with the pool's connect()
+**     arguments. The caller has counted it in the pool's size.
+**
+** Inputs:
+**     pool - connection pool object.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     Connection object belonging to the pool, NULL on failure.
+**
+** Exceptions:
+**     As ingresdbi.connect().
+**
+** Side Effects:
+**     On failure the connection is taken off the pool's size.
+**
+** History:
+**     17-Oct-2026 (agent)
+**         Created.
+}*/
+
+static IIDBI_CONNECTION *IIDBI_poolOpen(IIDBI_POOL *pool)
+{
+    PyObject *conn;
+
+    conn = IIDBI_connect(NULL, pool->args, pool->keywords);
+    if (conn && !PyObject_TypeCheck(conn, &IIDBI_connectType))
+    {
+        Py_DECREF(conn);
+        conn = NULL;
+        PyErr_SetString(IIDBI_InterfaceError, 
+            "Could not open a pooled connection");
+    }
+    if (!conn)
+    {
+        IIDBI_poolDrop(pool);
+        return NULL;
+    }
+
+    pool->connects++;
+    pool->autocommit = ((IIDBI_CONNECTION *)conn)->autocommit;
+    pool->decimalMode = ((IIDBI_CONNECTION *)conn)->decimalMode;
+    pool->trace = ((IIDBI_CONNECTION *)conn)->trace;
+    ((IIDBI_CONNECTION *)conn)->pool = pool;
+    Py_INCREF(pool);
+    return (IIDBI_CONNECTION *)conn;
+}
+
+/*{
+** Name: IIDBI_poolWrap
+**
+** Description:
+**     Create a connection object for a connection of the pool, with
+**     the settings of the connection object that opened it.
+**
+** Inputs:
+**     pool - connection pool object.
+**     pdbc - DBI connection handle.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     Connection object belonging to the pool, NULL on failure.
+**
+** Exceptions:
+**     The connection object must be constructed.
+**
+** Side Effects:
+**     On failure pdbc is handed back to the pool.
+**
+** History:
+**     17-Oct-2026 (agent)
+**         Created.
+}*/
+
+static IIDBI_CONNECTION *IIDBI_poolWrap(IIDBI_POOL *pool, IIDBI_DBC *pdbc)
+{
+    IIDBI_CONNECTION *conn = IIDBI_connConstructor();
+
+    if (!conn)
+    {
+        IIDBI_poolHandOff(pool, pdbc);
+        PyErr_SetString(IIDBI_Error, "Could not instantiate connection object");
+        return NULL;
+    }
+    conn->IIDBIpdbc = pdbc;
+    pdbc->conn = (void *)conn;
+    conn->autocommit = pool->autocommit;
+    conn->decimalMode = pool->decimalMode;
+    conn->trace = pool->trace;
+    conn->pool = pool;
+    Py_INCREF(pool);
+    return conn;
+}
+
+/*{
+** Name: IIDBI_poolDetach
+**
+** Description:
+**     Take the DBI connection handle from a pooled connection object
+**     and close the object.
+**
+** Inputs:
+**     conn - connection object taken from a pool.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     The DBI connection handle, NULL if the object has none.
+**
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     conn->pool is cleared, the caller takes over its reference.
+**
+** History:
+**     17-Oct-2026 (agent)
+**         Created.
+}*/
+
+static IIDBI_DBC *IIDBI_poolDetach(IIDBI_CONNECTION *conn)
+{
+    IIDBI_DBC *pdbc = conn->IIDBIpdbc;
+
+    conn->IIDBIpdbc = NULL;
+    if (pdbc)
+        pdbc->conn = NULL;
+    conn->pool = NULL;
+    IIDBI_connCleanup(conn);
+    return pdbc;
+}
+
+/*{
+** Name: IIDBI_poolHandOff
+**
+** Description:
+**     Pass a connection that is no longer in use to the first waiting
+**     thread or, with none waiting, keep it idle. Idle connections
+**     past the idle timeout are then closed. The connection is closed
+**     if the pool is.
+**
+** Inputs:
+**     pool - connection pool object.
+**     pdbc - DBI connection handle.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None.
+**
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     17-Oct-2026 (agent)
+**         Created.
+}*/
+
+static void IIDBI_poolHandOff(IIDBI_POOL *pool, IIDBI_DBC *pdbc)
+{
+    IIDBI_POOLENTRY *entry = NULL;
+
+    if (!pool->closed && pool->waitHead)
+    {
+        IIDBI_poolGrant(pool, pdbc);
+        return;
+    }
+    if (!pool->closed)
+        entry = (IIDBI_POOLENTRY *)malloc(sizeof(IIDBI_POOLENTRY));
+    if (!entry)
+    {
+        IIDBI_poolDisconnect(pool, pdbc);
+        IIDBI_poolDrop(pool);
+        return;
+    }
+    entry->pdbc = pdbc;
+    entry->released = time(NULL);
+    entry->next = pool->idle;
+    pool->idle = entry;
+    pool->idleCount++;
+    IIDBI_poolPrune(pool, FALSE);
+}
+
+/*{
+** Name: IIDBI_poolDrop
+**
+** Description:
+**     Take a connection that was closed, or could not be opened, off
+**     the pool's size. The place it leaves is granted to the first
+**     waiting thread, which opens a new connection.
+**
+** Inputs:
+**     pool - connection pool object.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None.
+**
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     17-Oct-2026 (agent)
+**         Created.
+}*/
+
+static void IIDBI_poolDrop(IIDBI_POOL *pool)
+{
+    pool->size--;
+    if (!pool->closed && pool->waitHead && pool->size < pool->maxSize)
+    {
+        pool->size++;
+        IIDBI_poolGrant(pool, NULL);
+    }
+}
+
+/*{
+** Name: IIDBI_poolGrant
+**
+** Description:
+**     Wake the first waiting thread, granting it a connection or a
+**     place to open one.
+**
+** Inputs:
+**     pool - connection pool object with threads waiting.
+**     pdbc - DBI connection handle, NULL to grant a place.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None.
+**
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     17-Oct-2026 (agent)
+**         Created.
+}*/
+
+static void IIDBI_poolGrant(IIDBI_POOL *pool, IIDBI_DBC *pdbc)
+{
+    IIDBI_POOLWAITER *waiter = pool->waitHead;
+
+    pool->waitHead = waiter->next;
+    if (!pool->waitHead)
+        pool->waitTail = NULL;
+    pool->waitCount--;
+
+    waiter->pdbc = pdbc;
+    waiter->granted = TRUE;
+#ifdef WIN32
+    SetEvent(waiter->event);
+#else
+    while (write(waiter->pipe[1], "", 1) < 0 && errno == EINTR)
+        ;
+#endif /* WIN32 */
+}
+
+/*{
+** Name: IIDBI_poolWait
+**
+** Description:
+**     Queue the calling thread behind the threads already waiting for
+**     a connection and wait, with the GIL released, until it is granted
+**     one (see IIDBI_poolGrant()) or the timeout expires.
+**
+** Inputs:
+**     pool - connection pool object.
+**     waiter - waiter to queue.
+**     seconds - timeout, negative to wait indefinitely.
+**
+** Outputs:
+**     waiter - granted and pdbc are set when a connection was granted.
+**
+** Returns:
+**     0 on success, -1 on error.
+**
+** Exceptions:
+**     The waiter's pipe or event must be created.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     17-Oct-2026 (agent)
+**         Created.
+}*/
+
+static int IIDBI_poolWait(IIDBI_POOL *pool, IIDBI_POOLWAITER *waiter,
+    double seconds)
+{
+    IIDBI_POOLWAITER *entry;
+    IIDBI_POOLWAITER *prev = NULL;
+#ifndef WIN32
+    struct pollfd fd;
+#endif /* WIN32 */
+
+    waiter->next = NULL;
+    waiter->pdbc = NULL;
+    waiter->granted = FALSE;
+#ifdef WIN32
+    waiter->event = CreateEvent(NULL, TRUE, FALSE, NULL);
+    if (!waiter->event)
+#else
+    if (pipe(waiter->pipe))
+#endif /* WIN32 */
+    {
+        PyErr_SetString(IIDBI_OperationalError, 
+            "Could not wait for a pooled connection");
+        return -1;
+    }
+
+    if (pool->waitTail)
+        pool->waitTail->next = waiter;
+    else
+        pool->waitHead = waiter;
+    pool->waitTail = waiter;
+    pool->waitCount++;
+    pool->waits++;
+
+    Py_BEGIN_ALLOW_THREADS
+#ifdef WIN32
+    WaitForSingleObject(waiter->event, 
+        seconds < 0.0 ? INFINITE : (DWORD)(seconds * 1000));
+#else
+    fd.fd = waiter->pipe[0];
+    fd.events = POLLIN;
+    fd.revents = 0;
+    while (poll(&fd, 1, seconds < 0.0 ? -1 : (int)(seconds * 1000)) < 0 &&
+        errno == EINTR)
+        ;
+#endif /* WIN32 */
+    Py_END_ALLOW_THREADS
+
+    /* timed out, unless granted while the GIL was being taken back */
+    if (!waiter->granted)
+    {
+        for (entry = pool->waitHead; entry != waiter; entry = entry->next)
+            prev = entry;
+        if (prev)
+            prev->next = waiter->next;
+        else
+            pool->waitHead = waiter->next;
+        if (pool->waitTail == waiter)
+            pool->waitTail = prev;
+        pool->waitCount--;
+    }
+
+#ifdef WIN32
+    CloseHandle(waiter->event);
+#else
+    close(waiter->pipe[0]);
+    close(waiter->pipe[1]);
+#endif /* WIN32 */
+    return 0;
+}
+
+/*{
+** Name: IIDBI_poolPrune
+**
+** Description:
+**     Close the idle connections that have been idle for longer than
+**     the pool's idle timeout, as long as the pool keeps its minimum
+**     size, or all idle connections.
+**
+** Inputs:
+**     pool - connection pool object.
+**     all - close all idle connections.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None.
+**
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     17-Oct-2026 (agent)
+**         Created.
+}*/
+
+static void IIDBI_poolPrune(IIDBI_POOL *pool, int all)
+{
+    IIDBI_POOLENTRY **link = &pool->idle;
+    IIDBI_POOLENTRY *entry;
+    IIDBI_POOLENTRY *expired = NULL;
+    time_t now = time(NULL);
+
+    if (!all && pool->idleTimeout < 0)
+        return;
+
+    while ((entry = *link) != NULL)
+    {
+        if (all || (pool->size > pool->minSize && 
+            difftime(now, entry->released) >= (double)pool->idleTimeout))
+        {
+            *link = entry->next;
+            entry->next = expired;
+            expired = entry;
+            pool->idleCount--;
+            pool->size--;
+        }
+        else
+            link = &entry->next;
+    }
+
+    /* the pool is up to date before the GIL is released to disconnect */
+    while ((entry = expired) != NULL)
+    {
+        expired = entry->next;
+        IIDBI_poolDisconnect(pool, entry->pdbc);
+        free(entry);
+    }
+}
+
+/*{
+** Name: IIDBI_poolDisconnect
+**
+** Description:
+**     Close a connection of the pool and free its DBI connection
+**     handle. The caller updates the pool's size.
+**
+** Inputs:
+**     pool - connection pool object.
+**     pdbc - DBI connection handle.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None.
+**
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     17-Oct-2026 (agent)
+**         Created.
+**     17-Oct-2026 (agent)
+**         Release the shared environment.
+}*/
+
+static void IIDBI_poolDisconnect(IIDBI_POOL *pool, IIDBI_DBC *pdbc)
+{
+    Py_BEGIN_ALLOW_THREADS
+    dbi_connectionClose(pdbc);
+    Py_END_ALLOW_THREADS
+    IIDBI_envRelease(pdbc);
+    free(pdbc);
+    pool->disconnects++;
+}
+
+/*{
+** Name: IIDBI_poolDestructor
+**
+** Description:
+**     Connection pool destructor. The pool outlives the connection
+**     objects taken from it, only idle connections are left to close.
+**
+** Inputs:
+**     self - connection pool object.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None.
+**
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     17-Oct-2026 (agent)
+**         Created.
+}*/
+
+static void IIDBI_poolDestructor(IIDBI_POOL *self)
+{
+    IIDBI_poolPrune(self, TRUE);
+    if (self->validate)
+        free(self->validate);
+    Py_XDECREF(self->args);
+    Py_XDECREF(self->keywords);
+    PyObject_Del(self);
+}
+
+/*{
+** Name: IIDBI_cursorCallProc
+**
+** Description:
+**     Execute a stored procedure.
+**
+** Inputs:
+**     self - cursor object.
+**     args - Evaluates to:
+**            szSqlStr - name of procedure.
+**            params - an optional sequence of input parameters.
+**
+** Outputs:
+**     BYREF parameters may be modified.
+**
+** Returns:
+**     None.
+**
+** Exceptions:
+**     The cursor must be open. The ODBC statement handle must be non-null.
+**     The cursor.prepared Query must succeed.  Cursor attribute "prepared"
+**     cannot be set to 'y', 'yes', or 'on".  If the procedure returns
+**     rows, the returned descriptor must be valid and rows must have valid
+**     data.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     26-May-06 Ralph.Loen@ingres.com
+**         Created.
+**     16-Oct-2026 (agent)
+**         Bind result columns for block fetches, as IIDBI_cursorExecute().
+**     16-Oct-2026 (agent)
+**         Allocate the column buffers once per result set.
+**     16-Oct-2026 (agent)
+**         Resolve the output converters for the result set.
+**     16-Oct-2026 (agent)
+**         Pass cursor.prefetch on to the column binding.
+**     16-Oct-2026 (agent)
+**         Wait for a pending asynchronous execute first.
+**     16-Oct-2026 (agent)
+**         Pass the query timeout on to the statement.
+**     17-Oct-2026 (agent)
+**         Read TINYINT values as signed, as they are bound.
+}*/
+
+static PyObject *IIDBI_cursorCallProc(IIDBI_CURSOR *self, PyObject *args)
+{
+    char *szSqlStr = NULL;
+    PyObject *params = NULL;
+    IIDBI_STMT *IIDBIpstmt = NULL;
+    IIDBI_CONNECTION *connection = NULL;
+    IIDBI_DBC *IIDBIpdbc = NULL;
+    RETCODE rc;
+    int i;
+    int parmCount = 0;
+    char szProcStr[1024];
+    char *procFmt="{ call %s (";
+    int j;
+    short int k;
+    char l;
+    long m;
+    PyObject *row = NULL;
+    IIDBI_DESCRIPTOR **parameter = NULL;
+    SQLBIGINT n;
+    PyObject *exception;
+    char *errMsg;
+    int result = FALSE;
+    
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorCallProc }}}1\n", self);
+
+    if (self->asyncExec && IIDBI_asyncExecJoin(self, TRUE) < 0)
+        return NULL;
+
+    if (!PyArg_ParseTuple(args, "s|O", &szSqlStr, &params)) 
+    {
+        exception = IIDBI_InterfaceError; 
+        errMsg = "usage: cursor.callproc()";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }  
+
+    IIDBI_clearMessages(self->messages);
+
+    if (self->closed)
+    {
+        exception = IIDBI_InterfaceError; 
+        errMsg = "cursor is already closed";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }  
+    if (self->prepareRequested)
+    {
+        exception = IIDBI_ProgrammingError; 
+        errMsg = "prepared attribute of (on, y, yes) not valid for execution of procedures";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }  
+    if (!self->IIDBIpstmt)
+    {
+        IIDBIpstmt = (IIDBI_STMT *)calloc(1,sizeof(IIDBI_STMT));
+        self->IIDBIpstmt = IIDBIpstmt;
+    }
+    else
+    {
+        IIDBIpstmt = self->IIDBIpstmt;
+    }
+    connection = self->connection;
+    if (connection == (IIDBI_CONNECTION *)Py_None)
+    {
+        exception = IIDBI_InternalError; 
+        errMsg = "Invalid connection object";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }
+
+    IIDBIpdbc = connection->IIDBIpdbc;
+    IIDBIpstmt->queryTimeout = IIDBI_QUERY_TIMEOUT(self);
+
+    sprintf(szProcStr, procFmt, szSqlStr);
+    if (IIDBI_IsTrue(params))
+    {
+        rc = IIDBI_sendParameters(self, params);
+        switch (rc)
+        {
+            case DBI_SQL_SUCCESS:
+                break;
+                    
+            case DBI_SQL_SUCCESS_WITH_INFO:
+                result = 1;
+                goto errorExit;
+                break;
+
+            default:
+                result = 0;
+                goto errorExit;
+                break;
+        } 
+        parmCount = IIDBIpstmt->parmCount;
+        for (i = 0; i < parmCount; i++)
+        {
+            if (i == parmCount - 1)
+                strcat(szProcStr,"? ");
+            else
+                strcat(szProcStr," ?,");
+        } 
+       
+        strcat(szProcStr, " ) }");
+
+        Py_BEGIN_ALLOW_THREADS
+        rc = dbi_cursorExecute( IIDBIpdbc, IIDBIpstmt, szProcStr, TRUE);
+        Py_END_ALLOW_THREADS
+        if (rc != DBI_SQL_SUCCESS)
+        {
+            result = IIDBI_mapError2exception((PyObject*)self, &IIDBIpstmt->hdr.err, rc, 
+                szProcStr); 
+            goto errorExit;
+        }
+
+        /*
+        ** Return (possibly modified) parameters back to the caller.   
+        */
+        row = PyTuple_New(IIDBIpstmt->parmCount);
+
+        parameter = IIDBIpstmt->parameter;
+        for (i = 0; i < parmCount; i++)
+        {
+            if (parameter[i]->isNull)
+            {
+                Py_INCREF(Py_None);
+                PyTuple_SetItem(row, i, Py_None);
+            }
+            else
+            {
+                switch (parameter[i]->type)
+                {
+                case SQL_BIGINT:
+                    n = *(ODBCINT64 *)parameter[i]->data;
+                    PyTuple_SetItem(row, i, PyLong_FromLongLong(n));
+                    break;
+        
+                case SQL_INTEGER:
+                    j = *(SQLINTEGER *)parameter[i]->data;
+                    m = (long)j;
+                    PyTuple_SetItem(row, i, PyInt_FromLong(m));
+                    break;
+        
+                 case SQL_SMALLINT:
+                    k = *(SQLSMALLINT *)parameter[i]->data;
+                    m = (long)k;
+                    PyTuple_SetItem(row, i, PyInt_FromLong(m));
+                    break;
+        
+                case SQL_TINYINT:
+                    l = *(SQLSCHAR *)parameter[i]->data;
+                    m = (long)l;
+                    PyTuple_SetItem(row, i, PyInt_FromLong(m));
+                    break;
+          
+                case SQL_FLOAT:
+                case SQL_REAL:
+                case SQL_DOUBLE:
+                    PyTuple_SetItem(row, i,
+                            PyFloat_FromDouble(*(double *)parameter[i]->data));
+                    break;
+        
+                case SQL_LONGVARCHAR:
+                case SQL_LONGVARBINARY:
+                    PyTuple_SetItem(row, i, (PyObject *)
+                            PyString_FromStringAndSize( parameter[i]->data, 
+                                                        parameter[i]->precision));
+                    break;
+        
+                case SQL_WCHAR:
+                case SQL_WVARCHAR:
+                case SQL_WLONGVARCHAR:
+                    PyTuple_SetItem(row, i, (PyObject *)
+                            PyUnicode_Decode((const char *)parameter[i]->data, 
+                            (int)wcslen(parameter[i]->data)*sizeof(SQLWCHAR),
+                            "utf_16","strict")); /* dbproc FIXME */
+                    break;
+        
+                default:
+                    PyTuple_SetItem(row, i, 
+                            PyString_FromString(parameter[i]->data)); /* dbproc FIXME use PyString_FromStringAndSize */
+                    break;
+                }
+            }
+        } /* for (i = 0; i < parmCount; i++) */
+    }  /* if (params) */
+    else
+    {
+        strcat(szProcStr, " ) }");
+
+        Py_BEGIN_ALLOW_THREADS
+        rc = dbi_cursorExecute( IIDBIpdbc, IIDBIpstmt, szProcStr, TRUE);
+        Py_END_ALLOW_THREADS
+        if (rc != DBI_SQL_SUCCESS)
+        {
+            result = IIDBI_mapError2exception((PyObject*)self, &IIDBIpstmt->hdr.err, 
+                rc, szProcStr);
+            goto errorExit;
+        }
+    }
+    self->rowcount = IIDBIpstmt->rowCount;
+
+    if (IIDBIpstmt->hasResultSet)
+    {
+        IIDBI_DESCRIPTOR *descriptor;
+        PyObject *descRow = NULL;
+        int type = -1;
+
+        self->description = PyList_New(0);
+        rc = dbi_allocDescriptor(IIDBIpstmt, IIDBIpstmt->descCount, 0);
+        if (rc != DBI_SQL_SUCCESS)
+        {
+            exception = IIDBI_OperationalError; 
+            errMsg = "Could not allocate descriptor";
+            result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+            goto errorExit;
+        }
+        Py_BEGIN_ALLOW_THREADS
+        rc = dbi_describeColumns(IIDBIpstmt);
+        Py_END_ALLOW_THREADS
+        if (rc != DBI_SQL_SUCCESS)
+        {
+            exception = IIDBI_OperationalError;
+            errMsg = "Could not describe columns";
+            result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+            goto errorExit;
+        }
+        IIDBIpstmt->arraySize = self->arraysize;
+        IIDBIpstmt->prefetch = self->prefetch;
+        Py_BEGIN_ALLOW_THREADS
+        rc = dbi_bindColumns(IIDBIpstmt);
+        Py_END_ALLOW_THREADS
+        if (rc != DBI_SQL_SUCCESS)
+        {
+            result = IIDBI_mapError2exception((PyObject*)self, 
+                &IIDBIpstmt->hdr.err, rc, szProcStr);
+            goto errorExit;
+        }
+        rc = dbi_allocData(IIDBIpstmt);
+        if (rc != DBI_SQL_SUCCESS)
+        {
+            exception = IIDBI_OperationalError;
+            errMsg = "Could not allocate data";
+            result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+            goto errorExit;
+        }
+        for (i = 0; i < IIDBIpstmt->descCount; i++)
+        {
+            descriptor = IIDBIpstmt->descriptor[i];
+            descRow = PyTuple_New(7);
+
+            rc = PyTuple_SetItem( descRow, 0, 
+                PyString_FromString(descriptor->columnName));
+            type = IIDBI_mapType(descriptor->type);
+            if (type == DBI_UNKNOWN_TYPE)
+            {
+                exception = IIDBI_OperationalError; 
+                errMsg = "Invalid data type";
+                result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+                goto errorExit;
+            }
+            rc = PyTuple_SetItem( descRow, 1, PyInt_FromLong((long)type));
+            rc = PyTuple_SetItem( descRow, 2, Py_None); Py_INCREF(Py_None);
+            rc = PyTuple_SetItem( descRow, 3, Py_None); Py_INCREF(Py_None);
+            rc = PyTuple_SetItem( descRow, 4, Py_None); Py_INCREF(Py_None);
+            rc = PyTuple_SetItem( descRow, 5, Py_None); Py_INCREF(Py_None);
+            rc = PyTuple_SetItem( descRow, 6, 
+                PyInt_FromLong((long)descriptor->nullable));
+
+            rc = PyList_Append( self->description, descRow);
+            Py_XDECREF(descRow);
+        }
+        if (IIDBI_convertResolve(self, IIDBIpstmt, &errMsg))
+        {
+            exception = IIDBI_ProgrammingError;
+            result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+            goto errorExit;
+        }
+    }
+    else
+    {
+        self->description = Py_None;
+        Py_INCREF(self->description);
+        IIDBI_convertRelease(self);
+    }
+
+    if (!parmCount)
+    {
+        Py_INCREF(Py_None);
+        row = Py_None;
+    }
+    else
+        dbi_freeDescriptor(IIDBIpstmt, 1);
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorCallProc }}}1\n", self);
+    return row;
+
+errorExit:
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorCallProc }}}1\n", self);
+    if (IIDBIpstmt && IIDBIpstmt->descCount)
+        dbi_freeDescriptor(IIDBIpstmt, 0);
+    if (result)
+    {
+        Py_INCREF(Py_None);
+        return Py_None;
+    }
+    return NULL;
+
+}
+
+/*{
+** Name: IIDBI_cursorFetch
+**
+** Description:
+**     Fetch one row from the DBMS.
+**
+** Inputs:
+**     self - cursor object.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     A tuple containing the data.
+**     
+** Exceptions:
+**     The cursor must be open. The ODBC statement handle must be non-null.
+**     The cursor object must have a valid descriptor and descriptor count.
+**     The fetch must succeed.
+**         
+** Side Effects:
+**     cursor->rowcount is incremented.
+**
+** History:
+**     26-May-06 Ralph.Loen@ingres.com
+**         Created.
+**     09-Dec-10 Grant.Croker@ingres.com
+**         Trac Ticket 161 - Provide a more descriptive error message when a
+**         fetch is performed against non-SELECT query.
+**     16-Oct-2026 (agent)
+**         No longer allocates and frees the column buffers for every row,
+**         they are owned by the result descriptor.
+**     16-Oct-2026 (agent)
+**         Validation and tuple construction moved to IIDBI_cursorFetchCheck()
+**         and IIDBI_cursorBuildRow(). The GIL is only released when the
+**         driver has to be called.
+**     16-Oct-2026 (agent)
+**         Pass cursor.lobstreaming on to the fetch.
+}*/
+
+static PyObject *IIDBI_cursorFetch(IIDBI_CURSOR *self)
+{
+    IIDBI_STMT *IIDBIpstmt = NULL;
+    RETCODE rc;
+    PyObject *row = NULL;
+    int result = FALSE;
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorFetch {{{1\n", self);
+
+    IIDBIpstmt = IIDBI_cursorFetchCheck(self, &result);
+    if (!IIDBIpstmt)
+        goto errorExit;
+
+    IIDBIpstmt->lobStreaming = self->lobStreaming;
+    if (dbi_rowsetPending(IIDBIpstmt))
+        rc = dbi_cursorFetchone(IIDBIpstmt);
+    else
+    {
+        Py_BEGIN_ALLOW_THREADS
+        rc = dbi_cursorFetchone(IIDBIpstmt);
+        Py_END_ALLOW_THREADS
+    }
+    if (rc == DBI_SQL_NO_DATA)
+    {
+        row = Py_None;
+        Py_INCREF(row);
+
+        goto exitLabel;
+    }
+    else if (rc != DBI_SQL_SUCCESS)
+    {
+        self->rowcount = -1;
+        dbi_freeDescriptor(IIDBIpstmt, 0);
+        result = IIDBI_mapError2exception((PyObject *)self, &IIDBIpstmt->hdr.err, 
+            rc, NULL); 
+        goto errorExit;
+    }
+
+    self->rowcount = IIDBIpstmt->rowCount;
+    row = IIDBI_cursorBuildRow(self, IIDBIpstmt, &result);
+    if (!row)
+        goto errorExit;
+    self->rowindex++;
+
+exitLabel:
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorFetch }}}1\n", self);
+
+    Py_XDECREF(self->rownumber);
+    self->rownumber = PyInt_FromLong(self->rowindex);
+    return row;
+
+errorExit:
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorFetch }}}1\n", self);
+    Py_XDECREF(self->rownumber);
+    self->rownumber = Py_None;
+    Py_INCREF(self->rownumber);
+    self->rowindex = 0;
+    if (result)
+    {
+        Py_INCREF(Py_None);
+        return Py_None;
+    }
+    return NULL;
+}
+
+/*{
+** Name: IIDBI_cursorFetchCheck
+**
+** Description:
+**     Validate that a cursor can be fetched from. Done once per call of
+**     fetchone(), fetchmany() or fetchall() rather than once per row.
+**
+** Inputs:
+**     self - cursor object.
+**
+** Outputs:
+**     result - TRUE if an error handler dealt with the error.
+**
+** Returns:
+**     The DBI statement handle, or NULL with the error raised.
+**     
+** Exceptions:
+**     The connection and cursor must be open. The ODBC statement handle
+**     must be non-null. The cursor object must have a valid descriptor
+**     and descriptor count.
+**         
+** Side Effects:
+**     The cursor is closed if its connection has been closed.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created from IIDBI_cursorFetch().
+**     16-Oct-2026 (agent)
+**         Wait for a pending asynchronous execute first.
+}*/
+
+static IIDBI_STMT *IIDBI_cursorFetchCheck(IIDBI_CURSOR *self, int *result)
+{
+    IIDBI_CONNECTION *connection;
+    PyObject *exception;
+    char *errMsg;
+
+    if (self->asyncExec && IIDBI_asyncExecJoin(self, TRUE) < 0)
+        return NULL;
+
+    connection = self->connection;
+    /* Py_INCREF(connection); we don't intend to use this and we have the GIL so no need to increment */
+    if (connection == (IIDBI_CONNECTION *)Py_None)
+    {
+        exception = IIDBI_InternalError; 
+        errMsg = "Invalid connection object";
+        goto errorExit;
+    }
+    else
+    {
+        if (connection->closed && !self->closed)
+        {
+            IIDBI_cursorClose(self); /* FIXME check return and exceptions...*/
+        }
+    }
+
+    if (self->closed)
+    {
+        exception = IIDBI_InterfaceError; 
+        errMsg = "cursor is already closed";
+        goto errorExit;
+    }
+    if (!self->IIDBIpstmt)
+    {
+        self->rowcount = -1;
+        exception = IIDBI_InternalError;
+        errMsg = "Invalid DBI statement handle";
+        goto errorExit;
+    }
+
+    if (!self->IIDBIpstmt->descCount)
+    {
+        self->rowcount = -1;
+        exception = IIDBI_DataError;
+        errMsg = "No results are available";
+        goto errorExit;
+    }
+    
+    if (!self->IIDBIpstmt->descriptor)
+    {
+        self->rowcount = -1;
+        exception = IIDBI_InterfaceError;
+        errMsg = "Missing tuple descriptor";
+        goto errorExit;
+    }
+    return self->IIDBIpstmt;
+
+errorExit:
+    *result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+    return NULL;
+}
+
+/*{
+** Name: IIDBI_cursorBindRowset
+**
+** Description:
+**     Bind the result columns for block fetches of at least
+**     IIDBI_ITER_ROWSET rows, if they are not bound that way and no row
+**     has been fetched yet. The rows are then fetched a rowset per
+**     driver call, with the GIL released once per rowset. A result set
+**     with LONG columns, or one the driver will not fetch in rowsets,
+**     is still fetched a row at a time.
+**
+** Inputs:
+**     self - cursor object.
+**     IIDBIpstmt - statement control block of the cursor.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None.
+**     
+** Exceptions:
+**     None, a failed binding only leaves single row fetches.
+**         
+** Side Effects:
+**     None.
+**
+** History:
+**     17-Oct-2026 (agent)
+**         Created from IIDBI_cursorIterator().
+}*/
+
+static void IIDBI_cursorBindRowset(IIDBI_CURSOR *self, IIDBI_STMT *IIDBIpstmt)
+{
+    RETCODE rc;
+
+    if (IIDBIpstmt->rowsetBound || self->rowindex || 
+        !IIDBIpstmt->descCount || !IIDBIpstmt->descriptor)
+        return;
+
+    IIDBIpstmt->arraySize = self->arraysize > IIDBI_ITER_ROWSET ?
+        self->arraysize : IIDBI_ITER_ROWSET;
+    IIDBIpstmt->prefetch = self->prefetch;
+    Py_BEGIN_ALLOW_THREADS
+    rc = dbi_bindColumns(IIDBIpstmt);
+    Py_END_ALLOW_THREADS
+    if (rc != DBI_SQL_SUCCESS)
+    {
+        /* not fatal, rows are fetched one at a time */
+        DBPRINTF(DBI_TRC_STAT)("%p: IIDBI_cursorBindRowset bind failed %d\n",
+            self, rc);
+    }
+}
+
+/*{
+** Name: IIDBI_cursorBuildRow
+**
+** Description:
+**     Convert the current row held in the column descriptors into a
+**     Python tuple.
+**
+** Inputs:
+**     self - cursor object.
+**     IIDBIpstmt - statement holding the fetched row.
+**
+** Outputs:
+**     result - TRUE if an error handler dealt with the error.
+**
+** Returns:
+**     A tuple containing the data, or NULL on error.
+**     
+** Exceptions:
+**     Conversion of the column data must succeed.
+**         
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created from IIDBI_cursorFetch().
+**     16-Oct-2026 (agent)
+**         Return a LOB reader for a streamed column.
+**     16-Oct-2026 (agent)
+**         Take LONG VARCHAR and LONG BYTE values read into a string
+**         without copying them.
+**     16-Oct-2026 (agent)
+**         Convert DECIMAL columns with IIDBI_decimalFromChar() as set by
+**         connection.decimal.
+**     16-Oct-2026 (agent)
+**         Apply the output converters resolved for the columns.
+**     16-Oct-2026 (agent)
+**         Columns are converted by IIDBI_cursorBuildValue().
+}*/
+
+static PyObject *IIDBI_cursorBuildRow(IIDBI_CURSOR *self, 
+    IIDBI_STMT *IIDBIpstmt, int *result)
+{
+    int i;
+    PyObject *row = NULL;
+    PyObject *value;
+    int decimalMode = IIDBI_DECIMAL_DECIMAL;
+
+    if (self->connection != (IIDBI_CONNECTION *)Py_None)
+        decimalMode = self->connection->decimalMode;
+    row = PyTuple_New(IIDBIpstmt->descCount);
+    if (!row)
+        return NULL;
+
+    for (i = 0; i < IIDBIpstmt->descCount; i++)
+    {
+        value = IIDBI_cursorBuildValue(self, IIDBIpstmt, i, decimalMode, 
+            result);
+        if (!value)
+        {
+            Py_DECREF(row);
+            return NULL;
+        }
+        PyTuple_SET_ITEM(row, i, value);
+    }
+    return row;
+}
+
+/*{
+** Name: IIDBI_cursorBuildValue
+**
+** Description:
+**     Convert one column of the current row held in the column
+**     descriptors into a Python object.
+**
+** Inputs:
+**     self - cursor object.
+**     IIDBIpstmt - statement holding the fetched row.
+**     i - column index, from 0.
+**     decimalMode - IIDBI_DECIMAL_xxx mode of DECIMAL columns.
+**
+** Outputs:
+**     result - TRUE if an error handler dealt with the error.
+**
+** Returns:
+**     New reference, or NULL on error.
+**     
+** Exceptions:
+**     Conversion of the column data must succeed.
+**         
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created from IIDBI_cursorBuildRow().
+**     17-Oct-2026 (agent)
+**         Read TINYINT values as signed, as they are bound.
+}*/
+
+static PyObject *IIDBI_cursorBuildValue(IIDBI_CURSOR *self, 
+    IIDBI_STMT *IIDBIpstmt, int i, int decimalMode, int *result)
+{
+    SQLINTEGER j;
+    SQLSMALLINT k;
+    SQLSCHAR l;
+    long m;
+    SQLBIGINT n;
+    PyObject *value;
+    IIDBI_DESCRIPTOR *descriptor = IIDBIpstmt->descriptor[i];
+    SQL_TIMESTAMP_STRUCT *ts = NULL;
+    PyObject *exception;
+    char *errMsg;
+
+    if (descriptor->isNull)
+    {
+        Py_INCREF(Py_None);
+        return Py_None;
+    }
+
+    if ((unsigned int)i + 1 == IIDBIpstmt->lobColumn)
+        return IIDBI_lobReaderNew(self, IIDBIpstmt, descriptor);
+
+    if (self->convertModes && i < self->convertCount && 
+        self->convertModes[i] != IIDBI_CONVERT_DEFAULT)
+        return IIDBI_convertColumn(descriptor, self->convertModes[i],
+            self->convertCalls ? PyTuple_GET_ITEM(self->convertCalls, i) : 
+            NULL);
+
+    switch (descriptor->type)
+    {
+    case SQL_BIGINT:
+        n = *(ODBCINT64 *)descriptor->data;
+        value = PyLong_FromLongLong(n);
+        break;
+
+    case SQL_INTEGER:
+        j = *(SQLINTEGER *)descriptor->data;
+        m = (long)j;
+        value = PyInt_FromLong(m);
+        break;
+
+    case SQL_SMALLINT:
+        k = *(SQLSMALLINT *)descriptor->data;
+        m = (long)k;
+        value = PyInt_FromLong(m);
+        break;
+
+    case SQL_TINYINT:
+        l = *(SQLSCHAR *)descriptor->data;
+        m = (long)l;
+        value = PyInt_FromLong(m);
+        break;
+  
+    case SQL_FLOAT:
+    case SQL_REAL:
+    case SQL_DOUBLE:
+        value = PyFloat_FromDouble(*(double *)descriptor->data);
+        break;
+
+    case SQL_TYPE_TIME:
+    case SQL_TYPE_TIMESTAMP:
+    case SQL_TYPE_DATE:
+    case SQL_DATE:
+    case SQL_TIME:
+    case SQL_TIMESTAMP:
+        ts = (SQL_TIMESTAMP_STRUCT *)descriptor->data;
+        value = (PyObject *)PyDateTime_FromDateAndTime( ts->year,
+            ts->month, ts->day, ts->hour, ts->minute, ts->second,
+            ts->fraction);
+        break;
+
+    case SQL_LONGVARCHAR:
+    case SQL_LONGVARBINARY:
+        if (descriptor->lobObject)
+        {
+            /*
+            ** The value was read straight into a string, take it
+            ** and trim any unused room.
+            */
+            value = descriptor->lobObject;
+            descriptor->lobObject = NULL;
+            if (PyString_GET_SIZE(value) != descriptor->precision)
+                _PyString_Resize(&value, descriptor->precision);
+        }
+        else
+            value = PyString_FromStringAndSize( descriptor->data, 
+                descriptor->precision);
+        break;
+
+    case SQL_WCHAR:
+    case SQL_WVARCHAR:
+    case SQL_WLONGVARCHAR:
+        value = PyUnicode_FromWideChar( 
+            (const wchar_t *)descriptor->data, 
+            (Py_ssize_t) descriptor->orInd/sizeof(SQLWCHAR));
+        if (!value)
+        {
+            DBPRINTF(DBI_TRC_RET)("PyTuple_SetItem(....PyUnicode_FromWideChar.. failed\n");
+            /*
+            ** TODO consider logging stack back trace to log 
+            ** (or include in exception text), this way we know 
+            ** why the Python call failed? Maybe put this logic
+            ** in IIDBI_handleError().
+            ** Requires stderr redirect, may need to tack GIL lock too.
+            ** 
+            ** See http://groups.google.com/group/comp.lang.python/msg/5c3b92953cbef32b?hl=en&dmode=source
+            ** See http://effbot.org/pyfaq/how-do-i-catch-the-output-from-pyerr-print-or-anything-that-prints-to-stdout-stderr.htm
+            */
+            exception = IIDBI_InterfaceError;
+            errMsg = "Conversion of result column from SQLWCHAR into PyUnicode failed.";
+            *result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+            return NULL;
+        }
+        break;
+
+    case SQL_DECIMAL:
+        value = IIDBI_decimalFromChar(descriptor->data, decimalMode);
+        break;
+
+    default:
+        DBPRINTF(DBI_TRC_STAT)("IIDBI_cursorFetch defaulting col %d type descriptor->type %d\n", i, descriptor->type);
+        value = PyString_FromStringAndSize(descriptor->data,
+            (Py_ssize_t) descriptor->orInd);
+        break;
+    }
+    return value;
+}
+
+/*{
+** Name: IIDBI_lobReaderNew
+**
+** Description:
+**     Create a LOB reader for the streamed column of the current row.
+**     The reader takes over the first segment read at fetch time.
+**
+** Inputs:
+**     cursor - cursor object.
+**     IIDBIpstmt - statement positioned on the row.
+**     desc - descriptor of the streamed column.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     New reference to the LOB reader, or NULL on error.
+**
+** Exceptions:
+**     Memory allocation must succeed.
+**
+** Side Effects:
+**     desc->data is handed over to the reader.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static PyObject *IIDBI_lobReaderNew(IIDBI_CURSOR *cursor, 
+    IIDBI_STMT *IIDBIpstmt, IIDBI_DESCRIPTOR *desc)
+{
+    IIDBI_LOBREADER *reader;
+
+    reader = PyObject_New(IIDBI_LOBREADER, &IIDBI_lobReaderType);
+    if (!reader)
+        return NULL;
+
+    Py_INCREF(cursor);
+    reader->cursor = cursor;
+    reader->pstmt = IIDBIpstmt;
+    reader->generation = IIDBIpstmt->rowGeneration;
+    reader->column = IIDBIpstmt->lobColumn;
+    reader->cType = dbi_lobCType(desc->type);
+    reader->head = desc->data;
+    reader->headLen = desc->precision;
+    reader->headPos = 0;
+    reader->more = IIDBIpstmt->lobPending;
+    reader->closed = FALSE;
+    desc->data = NULL;
+
+    return (PyObject *)reader;
+}
+
+/*{
+** Name: IIDBI_lobReaderCheck
+**
+** Description:
+**     Validate that the rest of a LOB can still be read from the
+**     driver, i.e. the cursor is still positioned on the reader's row.
+**
+** Inputs:
+**     self - LOB reader object.
+**
+** Outputs:
+**     result - TRUE if an error handler dealt with the error.
+**
+** Returns:
+**     TRUE if the driver can be read from, FALSE with the error raised.
+**
+** Exceptions:
+**     The cursor and its connection must be open and the cursor must
+**     not have fetched another row or executed another query.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+**     16-Oct-2026 (agent)
+**         Wait for a pending asynchronous execute first.
+}*/
+
+static int IIDBI_lobReaderCheck(IIDBI_LOBREADER *self, int *result)
+{
+    IIDBI_CURSOR *cursor = self->cursor;
+
+    if (cursor->asyncExec && IIDBI_asyncExecJoin(cursor, TRUE) < 0)
+        return FALSE;
+
+    if (cursor->closed || 
+        cursor->connection == (IIDBI_CONNECTION *)Py_None ||
+        cursor->connection->closed ||
+        cursor->IIDBIpstmt != self->pstmt ||
+        self->pstmt->rowGeneration != self->generation)
+    {
+        *result = IIDBI_handleError((PyObject *)cursor, IIDBI_InterfaceError,
+            "LOB reader is no longer valid, the cursor has left its row");
+        return FALSE;
+    }
+    return TRUE;
+}
+
+/*{
+** Name: IIDBI_lobReaderGet
+**
+** Description:
+**     Read up to size characters (bytes for LONG VARCHAR and LONG BYTE)
+**     from a LOB reader, the first segment read at fetch time first.
+**     The driver is called with the GIL released.
+**
+** Inputs:
+**     self - LOB reader object.
+**     size - largest amount to read, negative to read to the end.
+**
+** Outputs:
+**     result - TRUE if an error handler dealt with the error.
+**
+** Returns:
+**     A string (unicode for LONG NVARCHAR), empty at the end of the
+**     value, or NULL on error.
+**
+** Exceptions:
+**     The reader must be open and valid, see IIDBI_lobReaderCheck().
+**     The read must succeed.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static PyObject *IIDBI_lobReaderGet(IIDBI_LOBREADER *self, long size, 
+    int *result)
+{
+    PyObject *value = NULL;
+    Py_ssize_t unit = self->cType == SQL_C_WCHAR ? sizeof(SQLWCHAR) : 1;
+    Py_ssize_t want = size < 0 ? -1 : (Py_ssize_t)size * unit;
+    Py_ssize_t got = 0, alloc = 0, need;
+    SQLLEN chunk, len;
+    unsigned char more;
+    char *buf = NULL, *newBuf;
+    RETCODE rc;
+
+    if (self->closed)
+    {
+        *result = IIDBI_handleError((PyObject *)self->cursor, 
+            IIDBI_InterfaceError, "LOB reader is closed");
+        return NULL;
+    }
+
+    while (want < 0 || got < want)
+    {
+        if (self->headPos < self->headLen)
+            chunk = self->headLen - self->headPos;
+        else if (self->more)
+            chunk = IIDBI_LOB_READ_SIZE;
+        else
+            break;
+        if (want >= 0 && chunk > want - got)
+            chunk = want - got;
+
+        need = got + chunk + sizeof(SQLWCHAR);
+        if (need > alloc)
+        {
+            alloc = alloc * 2 > need ? alloc * 2 : need;
+            newBuf = realloc(buf, alloc);
+            if (!newBuf)
+            {
+                PyErr_NoMemory();
+                goto errorExit;
+            }
+            buf = newBuf;
+        }
+
+        if (self->headPos < self->headLen)
+        {
+            memcpy(buf + got, self->head + self->headPos, chunk);
+            self->headPos += chunk;
+            got += chunk;
+            continue;
+        }
+
+        if (!IIDBI_lobReaderCheck(self, result))
+            goto errorExit;
+        Py_BEGIN_ALLOW_THREADS
+        rc = dbi_cursorGetSegment(self->pstmt, self->column, self->cType,
+            buf + got, chunk, &len, &more, NULL);
+        Py_END_ALLOW_THREADS
+        if (rc == DBI_SQL_NO_DATA)
+        {
+            self->more = FALSE;
+            break;
+        }
+        if (rc != DBI_SQL_SUCCESS)
+        {
+            *result = IIDBI_mapError2exception((PyObject *)self->cursor, 
+                &self->pstmt->hdr.err, rc, NULL);
+            goto errorExit;
+        }
+        if (len > 0)
+            got += len;
+        self->more = more;
+    }
+
+    if (self->cType == SQL_C_WCHAR)
+        value = PyUnicode_FromWideChar((const wchar_t *)buf, 
+            got / sizeof(SQLWCHAR));
+    else
+        value = PyString_FromStringAndSize(buf, got);
+
+errorExit:
+    if (buf)
+        free(buf);
+    return value;
+}
+
+/*{
+** Name: IIDBI_lobReaderRead
+**
+** Description:
+**     lobreader.read([size]), as for file objects.
+**
+** Inputs:
+**     self - LOB reader object.
+**     args - optional size, the whole remaining value if omitted or
+**            negative.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     The data read, an empty string at the end of the value.
+**
+** Exceptions:
+**     See IIDBI_lobReaderGet().
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static PyObject *IIDBI_lobReaderRead(IIDBI_LOBREADER *self, PyObject *args)
+{
+    long size = -1;
+    PyObject *value;
+    int result = FALSE;
+
+    if (!PyArg_ParseTuple(args, "|l", &size)) 
+        return NULL;
+
+    value = IIDBI_lobReaderGet(self, size, &result);
+    if (!value && result)
+    {
+        Py_INCREF(Py_None);
+        return Py_None;
+    }
+    return value;
+}
+
+/*{
+** Name: IIDBI_lobReaderClose
+**
+** Description:
+**     lobreader.close(). Data not read yet is discarded when the cursor
+**     moves to the next row.
+**
+** Inputs:
+**     self - LOB reader object.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None.
+**
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static PyObject *IIDBI_lobReaderClose(IIDBI_LOBREADER *self)
+{
+    self->closed = TRUE;
+    if (self->head)
+        free(self->head);
+    self->head = NULL;
+    self->headLen = self->headPos = 0;
+    self->more = FALSE;
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+/*{
+** Name: IIDBI_lobReaderIterNext
+**
+** Description:
+**     Iterator support, returns the value in IIDBI_LOB_READ_SIZE pieces.
+**
+** Inputs:
+**     self - LOB reader object.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     The next piece, or NULL at the end of the value.
+**
+** Exceptions:
+**     See IIDBI_lobReaderGet().
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static PyObject *IIDBI_lobReaderIterNext(IIDBI_LOBREADER *self)
+{
+    PyObject *value;
+    Py_ssize_t size = IIDBI_LOB_READ_SIZE;
+    int result = FALSE;
+
+    if (self->cType == SQL_C_WCHAR)
+        size /= sizeof(SQLWCHAR);
+    value = IIDBI_lobReaderGet(self, (long)size, &result);
+    if (value && !PyObject_Length(value))
+    {
+        Py_DECREF(value);
+        value = NULL;
+    }
+    return value;
+}
+
+/*{
+** Name: IIDBI_lobReaderDestructor
+**
+** Description:
+**     Deallocate a LOB reader.
+**
+** Inputs:
+**     self - LOB reader object.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None.
+**
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     The reference to the cursor is released.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static void IIDBI_lobReaderDestructor(IIDBI_LOBREADER *self)
+{
+    if (self->head)
+        free(self->head);
+    Py_XDECREF(self->cursor);
+    PyObject_Del(self);
+}
+
+/*{
+** Name: IIDBI_columnBufferFormat
+**
+** Description:
+**     Format of the values of a column that cursor.fetchbuffers() returns
+**     as a column buffer, as bound by dbi_bindColumns().
+**
+** Inputs:
+**     type - ODBC SQL type of the column.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     struct module format, NULL if the column is returned as a list.
+**
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static char *IIDBI_columnBufferFormat(int type)
+{
+    switch (type)
+    {
+    case SQL_INTEGER:
+        return sizeof(SQLINTEGER) == sizeof(int) ? "i" : "l";
+
+    case SQL_BIGINT:
+        return "q";
+
+    case SQL_SMALLINT:
+        return "h";
+
+    case SQL_TINYINT:
+        return "b";
+
+    case SQL_FLOAT:
+    case SQL_REAL:
+    case SQL_DOUBLE:
+        return "d";
+
+    default:
+        return NULL;
+    }
+}
+
+/*{
+** Name: IIDBI_columnBufferNew
+**
+** Description:
+**     Create a column buffer over a column's rowset buffer, handed over
+**     by dbi_rowsetDetach(). The NULL bitmap is built from the column's
+**     length/indicator array and the values of NULL rows are zeroed.
+**
+** Inputs:
+**     descriptor - bound column.
+**     data - rowset buffer of the column, owned by the column buffer
+**            even if it cannot be created.
+**     start - first row of the rowset returned.
+**     count - number of rows returned.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     New reference, NULL on error.
+**
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static PyObject *IIDBI_columnBufferNew(IIDBI_DESCRIPTOR *descriptor, 
+    char *data, int start, int count)
+{
+    IIDBI_COLUMNBUFFER *buffer;
+    unsigned char *bits;
+    int row;
+
+    buffer = PyObject_New(IIDBI_COLUMNBUFFER, &IIDBI_columnBufferType);
+    if (!buffer)
+    {
+        free(data);
+        return NULL;
+    }
+    buffer->data = data;
+    buffer->itemSize = descriptor->bindSize;
+    buffer->offset = start * buffer->itemSize;
+    buffer->count = count;
+    buffer->format = IIDBI_columnBufferFormat(descriptor->type);
+    buffer->nullCount = 0;
+    buffer->nulls = PyString_FromStringAndSize(NULL, (count + 7) / 8);
+    if (!buffer->nulls)
+    {
+        Py_DECREF(buffer);
+        return NULL;
+    }
+
+    bits = (unsigned char *)PyString_AS_STRING(buffer->nulls);
+    memset(bits, 0, (count + 7) / 8);
+    for (row = 0; row < count; row++)
+    {
+        if (descriptor->rowsetInd[start + row] != SQL_NULL_DATA)
+            continue;
+        bits[row / 8] |= (unsigned char)(1 << (row % 8));
+        memset(data + buffer->offset + row * buffer->itemSize, 0, 
+            buffer->itemSize);
+        buffer->nullCount++;
+    }
+    return (PyObject *)buffer;
+}
+
+/*{
+** Name: IIDBI_columnBufferDestructor
+**
+** Description:
+**     Destroy a column buffer.
+**
+** Inputs:
+**     self - column buffer object.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     void.
+**
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     Frees the rowset buffer.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static void IIDBI_columnBufferDestructor(IIDBI_COLUMNBUFFER *self)
+{
+    if (self->data)
+        free(self->data);
+    Py_XDECREF(self->nulls);
+    PyObject_Del(self);
+}
+
+/*{
+** Name: IIDBI_columnBufferLength
+**
+** Description:
+**     len() of a column buffer, the number of rows.
+**
+** Inputs:
+**     self - column buffer object.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     Number of rows.
+**
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static Py_ssize_t IIDBI_columnBufferLength(IIDBI_COLUMNBUFFER *self)
+{
+    return self->count;
+}
+
+/*{
+** Name: IIDBI_columnBufferItem
+**
+** Description:
+**     Value of a row of a column buffer.
+**
+** Inputs:
+**     self - column buffer object.
+**     i - row, from 0.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     New reference to an int, long or float, None for NULL.
+**
+** Exceptions:
+**     IndexError.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static PyObject *IIDBI_columnBufferItem(IIDBI_COLUMNBUFFER *self, 
+    Py_ssize_t i)
+{
+    char *value;
+
+    if (i < 0 || i >= self->count)
+    {
+        PyErr_SetString(PyExc_IndexError, "column buffer index out of range");
+        return NULL;
+    }
+    if (PyString_AS_STRING(self->nulls)[i / 8] & (1 << (i % 8)))
+    {
+        Py_INCREF(Py_None);
+        return Py_None;
+    }
+
+    value = self->data + self->offset + i * self->itemSize;
+    switch (self->format[0])
+    {
+    case 'q':
+        return PyLong_FromLongLong((PY_LONG_LONG)*(ODBCINT64 *)value);
+
+    case 'h':
+        return PyInt_FromLong((long)*(SQLSMALLINT *)value);
+
+    case 'b':
+        return PyInt_FromLong((long)*(signed char *)value);
+
+    case 'd':
+        return PyFloat_FromDouble(*(double *)value);
+
+    default:
+        return PyInt_FromLong((long)*(SQLINTEGER *)value);
+    }
+}
+
+/*{
+** Name: IIDBI_columnBufferRead
+**
+** Description:
+**     Old style buffer interface, read and character buffer of a column
+**     buffer.
+**
+** Inputs:
+**     self - column buffer object.
+**     segment - segment number, only 0 exists.
+**
+** Outputs:
+**     ptr - start of the values.
+**
+** Returns:
+**     Length in bytes, -1 on error.
+**
+** Exceptions:
+**     SystemError for a segment other than 0.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static Py_ssize_t IIDBI_columnBufferRead(IIDBI_COLUMNBUFFER *self, 
+    Py_ssize_t segment, void **ptr)
+{
+    if (segment)
+    {
+        PyErr_SetString(PyExc_SystemError, 
+            "accessing non-existent column buffer segment");
+        return -1;
+    }
+    *ptr = self->data + self->offset;
+    return self->count * self->itemSize;
+}
+
+/*{
+** Name: IIDBI_columnBufferSegments
+**
+** Description:
+**     Old style buffer interface, number of segments of a column buffer.
+**
+** Inputs:
+**     self - column buffer object.
+**
+** Outputs:
+**     lenp - length in bytes, if not NULL.
+**
+** Returns:
+**     1
+**
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static Py_ssize_t IIDBI_columnBufferSegments(IIDBI_COLUMNBUFFER *self, 
+    Py_ssize_t *lenp)
+{
+    if (lenp)
+        *lenp = self->count * self->itemSize;
+    return 1;
+}
+
+#ifdef Py_TPFLAGS_HAVE_NEWBUFFER
+/*{
+** Name: IIDBI_columnBufferGet
+**
+** Description:
+**     New style buffer interface of a column buffer: a read-only, one
+**     dimensional array of count values of the column buffer's format.
+**
+** Inputs:
+**     self - column buffer object.
+**     flags - PyBUF_xxx request.
+**
+** Outputs:
+**     view - buffer description.
+**
+** Returns:
+**     0 on success, -1 on error.
+**
+** Exceptions:
+**     BufferError if a writable buffer is requested.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static int IIDBI_columnBufferGet(IIDBI_COLUMNBUFFER *self, Py_buffer *view,
+    int flags)
+{
+    if (PyBuffer_FillInfo(view, (PyObject *)self, self->data + self->offset,
+        self->count * self->itemSize, 1, flags))
+        return -1;
+    view->itemsize = self->itemSize;
+    if (flags & PyBUF_FORMAT)
+        view->format = self->format;
+    if ((flags & PyBUF_ND) == PyBUF_ND)
+        view->shape = &self->count;
+    return 0;
+}
+#endif
+
+/*{
+** Name: IIDBI_cursorFetchRows
+**
+** Description:
+**     Fetch up to maxRows rows into a list. The cursor is validated once,
+**     the GIL is only released when the driver has to be called, and the
+**     rownumber attribute is updated once at the end. If no row has been
+**     fetched yet the columns are bound for block fetches, so the driver
+**     is called once per rowset; only result sets that cannot be fetched
+**     in rowsets, such as those with LONG columns, take one call and one
+**     GIL release per row.
+**
+** Inputs:
+**     self - cursor object.
+**     maxRows - maximum number of rows, -1 for all remaining rows.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     A list of tuples.
+**     
+** Exceptions:
+**     The cursor must be open. The ODBC statement handle must be non-null.
+**     The cursor object must have a valid descriptor and descriptor count.
+**     The fetch must succeed.
+**         
+** Side Effects:
+**     cursor->rowcount and cursor->rownumber are updated.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+**     16-Oct-2026 (agent)
+**         Never stream LONG columns.
+**     17-Oct-2026 (agent)
+**         Fetch in rowsets when nothing has been fetched yet, instead of
+**         releasing the GIL for each row of an unbound result set.
+}*/
+
+static PyObject *IIDBI_cursorFetchRows(IIDBI_CURSOR *self, long maxRows)
+{
+    IIDBI_STMT *IIDBIpstmt = NULL;
+    RETCODE rc = DBI_SQL_SUCCESS;
+    PyObject *list = NULL;
+    PyObject *row = NULL;
+    Py_ssize_t presize = 0;
+    Py_ssize_t count = 0;
+    int result = FALSE;
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorFetchRows %ld {{{1\n", self, maxRows);
+
+    IIDBIpstmt = IIDBI_cursorFetchCheck(self, &result);
+    if (!IIDBIpstmt)
+        goto errorExit;
+
+    /* rows are kept, a LOB reader would not outlive the next row */
+    IIDBIpstmt->lobStreaming = FALSE;
+    if (maxRows != 1)
+        IIDBI_cursorBindRowset(self, IIDBIpstmt);
+    if (maxRows > 0)
+        presize = maxRows < IIDBI_MAX_PRESIZE ? maxRows : IIDBI_MAX_PRESIZE;
+    list = PyList_New(presize);
+    if (!list)
+        goto errorExit;
+
+    while (maxRows < 0 || count < maxRows)
+    {
+        if (dbi_rowsetPending(IIDBIpstmt))
+            rc = dbi_cursorFetchone(IIDBIpstmt);
+        else
+        {
+            Py_BEGIN_ALLOW_THREADS
+            rc = dbi_cursorFetchone(IIDBIpstmt);
+            Py_END_ALLOW_THREADS
+        }
+        if (rc != DBI_SQL_SUCCESS)
+            break;
+
+        row = IIDBI_cursorBuildRow(self, IIDBIpstmt, &result);
+        if (!row)
+            goto errorExit;
+        if (count < presize)
+            PyList_SET_ITEM(list, count, row);
+        else
+        {
+            if (PyList_Append(list, row))
+            {
+                Py_DECREF(row);
+                goto errorExit;
+            }
+            Py_DECREF(row);
+        }
+        count++;
+        self->rowindex++;
+    }
+
+    if (rc != DBI_SQL_SUCCESS && rc != DBI_SQL_NO_DATA)
+    {
+        dbi_freeDescriptor(IIDBIpstmt, 0);
+        result = IIDBI_mapError2exception((PyObject *)self, 
+            &IIDBIpstmt->hdr.err, rc, NULL); 
+        goto errorExit;
+    }
+    if (count < presize && PyList_SetSlice(list, count, presize, NULL))
+        goto errorExit;
+
+    self->rowcount = IIDBIpstmt->rowCount;
+    Py_XDECREF(self->rownumber);
+    self->rownumber = PyInt_FromLong(self->rowindex);
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorFetchRows (success) %d }}}1\n", 
+        self, self->rowcount);
+    return list;
+
+errorExit:
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorFetchRows (err) }}}1\n", self);
+    Py_XDECREF(list); /* unfilled slots are NULL, which list_dealloc allows */
+    self->rowcount = -1;
+    Py_XDECREF(self->rownumber);
+    self->rownumber = Py_None;
+    Py_INCREF(self->rownumber);
+    self->rowindex = 0;
+    if (result)
+    {
+        Py_INCREF(Py_None);
+        return Py_None;
+    }
+    return NULL;
+}
+
+/*{
+** Name: IIDBI_cursorFetchColumns
+**
+** Description:
+**     Fetch up to rows rows and return them column by column: a list
+**     holding one sequence per result column. Integer and float columns
+**     are collected as C values and returned as array.array objects
+**     ('l' and 'd'), so no object is created per value; a numeric column
+**     holding a NULL, a column with an output converter and all other
+**     columns are returned as lists. As by IIDBI_cursorFetchRows(), the
+**     rows are fetched in rowsets where possible.
+**
+** Inputs:
+**     self - cursor object.
+**     args - optional number of rows, cursor.arraysize by default, a
+**            negative number for all remaining rows.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     A list of array.array and list objects.
+**     
+** Exceptions:
+**     The cursor must be open. The ODBC statement handle must be non-null.
+**     The cursor object must have a valid descriptor and descriptor count.
+**     The fetch must succeed.
+**         
+** Side Effects:
+**     cursor->rowcount and cursor->rownumber are updated.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created from IIDBI_cursorFetchRows().
+**     17-Oct-2026 (agent)
+**         Fetch in rowsets when nothing has been fetched yet.
+}*/
+
+static PyObject *IIDBI_cursorFetchColumns(IIDBI_CURSOR *self, PyObject *args)
+{
+    IIDBI_STMT *IIDBIpstmt = NULL;
+    IIDBI_FETCHCOLUMN *columns = NULL;
+    IIDBI_FETCHCOLUMN *column;
+    IIDBI_DESCRIPTOR *descriptor;
+    RETCODE rc = DBI_SQL_SUCCESS;
+    PyObject *list = NULL;
+    PyObject *value;
+    long maxRows = self->arraysize;
+    long count = 0;
+    Py_ssize_t presize = IIDBI_FETCHCOLUMN_SIZE;
+    int decimalMode = IIDBI_DECIMAL_DECIMAL;
+    int descCount = 0;
+    int result = FALSE;
+    int i;
+    PyObject *exception;
+    char *errMsg;
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorFetchColumns {{{1\n", self);
+    IIDBI_handleWarning("DB-API extension cursor.fetchcolumns() used", 
+        NULL);
+
+    if (!PyArg_ParseTuple(args, "|l", &maxRows)) 
+    {
+        exception = IIDBI_InterfaceError; 
+        errMsg = "usage: cursor.fetchcolumns([rows])";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }  
+
+    IIDBIpstmt = IIDBI_cursorFetchCheck(self, &result);
+    if (!IIDBIpstmt)
+        goto errorExit;
+
+    /* values are kept, a LOB reader would not outlive the next row */
+    IIDBIpstmt->lobStreaming = FALSE;
+    if (maxRows != 1)
+        IIDBI_cursorBindRowset(self, IIDBIpstmt);
+    if (self->connection != (IIDBI_CONNECTION *)Py_None)
+        decimalMode = self->connection->decimalMode;
+    if (maxRows >= 0 && maxRows < presize)
+        presize = maxRows ? maxRows : 1;
+
+    descCount = IIDBIpstmt->descCount;
+    columns = (IIDBI_FETCHCOLUMN *)calloc(descCount, 
+        sizeof(IIDBI_FETCHCOLUMN));
+    if (!columns)
+    {
+        PyErr_NoMemory();
+        goto errorExit;
+    }
+    for (i = 0; i < descCount; i++)
+    {
+        column = &columns[i];
+        switch (IIDBIpstmt->descriptor[i]->type)
+        {
+        case SQL_BIGINT:
+            if (sizeof(long) >= sizeof(ODBCINT64))
+                column->typecode = 'l';
+            break;
+
+        case SQL_INTEGER:
+        case SQL_SMALLINT:
+        case SQL_TINYINT:
+            column->typecode = 'l';
+            break;
+
+        case SQL_FLOAT:
+        case SQL_REAL:
+        case SQL_DOUBLE:
+            column->typecode = 'd';
+            break;
+        }
+        if (!arrayType || (self->convertModes && i < self->convertCount &&
+            self->convertModes[i] != IIDBI_CONVERT_DEFAULT))
+            column->typecode = 0;
+
+        if (column->typecode)
+        {
+            column->size = presize;
+            column->data = malloc(presize * (column->typecode == 'd' ? 
+                sizeof(double) : sizeof(long)));
+            if (!column->data)
+            {
+                PyErr_NoMemory();
+                goto errorExit;
+            }
+        }
+        else
+        {
+            column->list = PyList_New(0);
+            if (!column->list)
+                goto errorExit;
+        }
+    }
+
+    while (maxRows < 0 || count < maxRows)
+    {
+        if (dbi_rowsetPending(IIDBIpstmt))
+            rc = dbi_cursorFetchone(IIDBIpstmt);
+        else
+        {
+            Py_BEGIN_ALLOW_THREADS
+            rc = dbi_cursorFetchone(IIDBIpstmt);
+            Py_END_ALLOW_THREADS
+        }
+        if (rc != DBI_SQL_SUCCESS)
+            break;
+
+        for (i = 0; i < descCount; i++)
+        {
+            column = &columns[i];
+            descriptor = IIDBIpstmt->descriptor[i];
+            if (column->typecode && descriptor->isNull && 
+                IIDBI_fetchColumnList(column))
+                goto errorExit;
+            if (column->typecode)
+            {
+                if (IIDBI_fetchColumnPut(column, descriptor))
+                    goto errorExit;
+                continue;
+            }
+            value = IIDBI_cursorBuildValue(self, IIDBIpstmt, i, decimalMode,
+                &result);
+            if (!value)
+                goto errorExit;
+            if (PyList_Append(column->list, value))
+            {
+                Py_DECREF(value);
+                goto errorExit;
+            }
+            Py_DECREF(value);
+        }
+        count++;
+        self->rowindex++;
+    }
+
+    if (rc != DBI_SQL_SUCCESS && rc != DBI_SQL_NO_DATA)
+    {
+        dbi_freeDescriptor(IIDBIpstmt, 0);
+        result = IIDBI_mapError2exception((PyObject *)self, 
+            &IIDBIpstmt->hdr.err, rc, NULL); 
+        goto errorExit;
+    }
+
+    list = PyList_New(descCount);
+    if (!list)
+        goto errorExit;
+    for (i = 0; i < descCount; i++)
+    {
+        value = IIDBI_fetchColumnResult(&columns[i]);
+        if (!value)
+            goto errorExit;
+        PyList_SET_ITEM(list, i, value);
+    }
+    IIDBI_fetchColumnFree(columns, descCount);
+
+    self->rowcount = IIDBIpstmt->rowCount;
+    Py_XDECREF(self->rownumber);
+    self->rownumber = PyInt_FromLong(self->rowindex);
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorFetchColumns (success) %d }}}1\n", 
+        self, self->rowcount);
+    return list;
+
+errorExit:
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorFetchColumns (err) }}}1\n", self);
+    Py_XDECREF(list); /* unfilled slots are NULL, which list_dealloc allows */
+    if (columns)
+        IIDBI_fetchColumnFree(columns, descCount);
+    self->rowcount = -1;
+    Py_XDECREF(self->rownumber);
+    self->rownumber = Py_None;
+    Py_INCREF(self->rownumber);
+    self->rowindex = 0;
+    if (result)
+    {
+        Py_INCREF(Py_None);
+        return Py_None;
+    }
+    return NULL;
+}
+
+/*{
+** Name: IIDBI_cursorFetchBuffers
+**
+** Description:
+**     Return the rest of the current rowset, or the next rowset, column
+**     by column. Integer and float columns are returned as column buffer
+**     objects that take over the memory the driver fetched them into, so
+**     they are exported through the buffer protocol without copying or
+**     creating an object per value. Other columns, and columns with an
+**     output converter, are returned as lists.
+**
+**     The result columns are bound for block fetches if no row has been
+**     fetched yet, as by IIDBI_cursorIterator().
+**
+** Inputs:
+**     self - cursor object.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     A list of column buffer and list objects, None when no rows are
+**     left.
+**     
+** Exceptions:
+**     The cursor must be open. The ODBC statement handle must be non-null.
+**     The cursor object must have a valid descriptor and descriptor count.
+**     The result set must be fetched in rowsets, which is not possible
+**     with LONG columns. The fetch must succeed.
+**         
+** Side Effects:
+**     cursor->rowcount and cursor->rownumber are updated.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+**     16-Oct-2026 (agent)
+**         Pass cursor.prefetch on to the column binding.
+**     17-Oct-2026 (agent)
+**         Bind the columns with IIDBI_cursorBindRowset().
+}*/
+
+static PyObject *IIDBI_cursorFetchBuffers(IIDBI_CURSOR *self)
+{
+    IIDBI_STMT *IIDBIpstmt = NULL;
+    IIDBI_DESCRIPTOR *descriptor;
+    RETCODE rc = DBI_SQL_SUCCESS;
+    PyObject *list = NULL;
+    PyObject *column;
+    PyObject *value;
+    void *data;
+    int decimalMode = IIDBI_DECIMAL_DECIMAL;
+    int start, count;
+    int result = FALSE;
+    int i, row;
+    PyObject *exception;
+    char *errMsg;
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorFetchBuffers {{{1\n", self);
+    IIDBI_handleWarning("DB-API extension cursor.fetchbuffers() used", 
+        NULL);
+
+    IIDBIpstmt = IIDBI_cursorFetchCheck(self, &result);
+    if (!IIDBIpstmt)
+        goto errorExit;
+
+    IIDBI_cursorBindRowset(self, IIDBIpstmt);
+    if (!IIDBIpstmt->rowsetBound)
+    {
+        exception = IIDBI_NotSupportedError;
+        errMsg = "cursor.fetchbuffers() needs a result set fetched in rowsets, without LONG columns";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }
+
+    if (dbi_rowsetPending(IIDBIpstmt))
+        start = IIDBIpstmt->rowsetIndex;
+    else
+    {
+        Py_BEGIN_ALLOW_THREADS
+        rc = dbi_cursorFetchone(IIDBIpstmt);
+        Py_END_ALLOW_THREADS
+        if (rc == DBI_SQL_NO_DATA)
+        {
+            self->rowcount = IIDBIpstmt->rowCount;
+            DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorFetchBuffers (no data) }}}1\n", 
+                self);
+            Py_INCREF(Py_None);
+            return Py_None;
+        }
+        if (rc != DBI_SQL_SUCCESS)
+        {
+            dbi_freeDescriptor(IIDBIpstmt, 0);
+            result = IIDBI_mapError2exception((PyObject *)self, 
+                &IIDBIpstmt->hdr.err, rc, NULL); 
+            goto errorExit;
+        }
+        start = IIDBIpstmt->rowsetIndex - 1;
+    }
+    count = (int)IIDBIpstmt->rowsFetched - start;
+
+    if (self->connection != (IIDBI_CONNECTION *)Py_None)
+        decimalMode = self->connection->decimalMode;
+    list = PyList_New(IIDBIpstmt->descCount);
+    if (!list)
+        goto errorExit;
+
+    for (i = 0; i < IIDBIpstmt->descCount; i++)
+    {
+        descriptor = IIDBIpstmt->descriptor[i];
+        if (IIDBI_columnBufferFormat(descriptor->type) && 
+            !(self->convertModes && i < self->convertCount &&
+            self->convertModes[i] != IIDBI_CONVERT_DEFAULT))
+        {
+            rc = dbi_rowsetDetach(IIDBIpstmt, i, &data);
+            if (rc != DBI_SQL_SUCCESS)
+            {
+                result = IIDBI_mapError2exception((PyObject *)self, 
+                    &IIDBIpstmt->hdr.err, rc, NULL); 
+                goto errorExit;
+            }
+            column = IIDBI_columnBufferNew(descriptor, (char *)data, start,
+                count);
+            if (!column)
+                goto errorExit;
+            PyList_SET_ITEM(list, i, column);
+            continue;
+        }
+
+        column = PyList_New(count);
+        if (!column)
+            goto errorExit;
+        PyList_SET_ITEM(list, i, column);
+        for (row = 0; row < count; row++)
+        {
+            dbi_rowsetCopy(IIDBIpstmt, start + row, i);
+            value = IIDBI_cursorBuildValue(self, IIDBIpstmt, i, decimalMode,
+                &result);
+            if (!value)
+                goto errorExit;
+            PyList_SET_ITEM(column, row, value);
+        }
+    }
+    dbi_rowsetConsume(IIDBIpstmt);
+    self->rowindex += count;
+
+    self->rowcount = IIDBIpstmt->rowCount;
+    Py_XDECREF(self->rownumber);
+    self->rownumber = PyInt_FromLong(self->rowindex);
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorFetchBuffers (success) %d }}}1\n", 
+        self, count);
+    return list;
+
+errorExit:
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorFetchBuffers (err) }}}1\n", self);
+    Py_XDECREF(list); /* unfilled slots are NULL, which list_dealloc allows */
+    self->rowcount = -1;
+    Py_XDECREF(self->rownumber);
+    self->rownumber = Py_None;
+    Py_INCREF(self->rownumber);
+    self->rowindex = 0;
+    if (result)
+    {
+        Py_INCREF(Py_None);
+        return Py_None;
+    }
+    return NULL;
+}
+
+/*{
+** Name: IIDBI_cursorNextSet
+**
+** Description:
+**     Returns the next result set from a multi-result set stored procedure.
+**
+** Inputs:
+**    self - cursor object.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     NULL.
+**
+** Exceptions:
+**     Always returns "not supported" exception.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     26-May-06 Ralph.Loen@ingres.com
+**         Created.
+}*/
+
+static PyObject *IIDBI_cursorNextSet(IIDBI_CURSOR *self)
+{
+    char *errMsg;
+    PyObject *exception;
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorNextSet {{{1\n", self);
+    IIDBI_handleWarning ( "DB-API extension cursor.nextset() used", 
+        NULL ) ;
+    errMsg = "cursor.nextset() is not supported in Ingres";
+    exception = IIDBI_NotSupportedError;
+    IIDBI_handleError((PyObject *)self, exception, errMsg);
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorNextSet }}}1\n", self);
+    return(NULL);
+}
+
+/*{
+** Name: IIDBI_cursorScroll
+**
+** Description:
+**     Scroll a cursor according to the input direction and value. 
+**
+** Inputs:
+**    self - cursor object.
+**    args - evaluates to value (number of rows) and optional mode 
+**           ('relative' or 'absolute')
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     NULL.
+**
+** Exceptions:
+**     Always returns "not supported" exception.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     26-May-06 Ralph.Loen@ingres.com
+**         Created.
+}*/
+
+static PyObject *IIDBI_cursorScroll(IIDBI_CURSOR *self, PyObject *args)
+{
+    char *errMsg;
+    PyObject *exception;
+    int result = FALSE;
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorScroll {{{1\n", self);
+
+    IIDBI_handleWarning ( "DB-API extension cursor.scroll() used", 
+        NULL ) ;
+    errMsg = "Not yet supported natively in Ingres";
+    exception = IIDBI_NotSupportedError;
+    result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorScroll }}}1\n", self);
+    if (result)
+    {
+        Py_INCREF(Py_None);
+        return Py_None;
+    }
+    else
+        return NULL;
+}
+
+/*{
+** Name: IIDBI_cursorSetInputSizes
+**
+** Description:
+**    Determines the segment size for sending blob parameters.
+**
+** Inputs:
+**     self - cursor object.
+**     args - evaluates to a sequence of input segment sizes for each
+**            input parameter.  Applies only to the underlying segment size
+**            for blob columns.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**         
+** Exceptions:
+**         
+** Side Effects:
+**     Determines segment size in SQLPutData() in the ODBC layer.
+**
+** History:
+**     26-May-06 Ralph.Loen@ingres.com
+**         Created.
+}*/
+
+static PyObject *IIDBI_cursorSetInputSizes(IIDBI_CURSOR *self, PyObject *args)
+{
+    int len = 0;
+    int i;
+    PyObject *obj = NULL;
+    PyObject *item = NULL;
+    PyObject *exception;
+    char *errMsg;
+    int result = FALSE;
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorSetInputSizes {{{1\n", self);
+
+    if (!PyArg_ParseTuple(args, "O", &obj)) 
+    {
+        exception = IIDBI_InterfaceError;
+        errMsg = "invalid argruments for cursor.setinputsizes";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }
+    if (!PySequence_Check(obj) )
+    {
+        exception = IIDBI_InterfaceError;
+        errMsg = "argument to cursor.setinputsizes must be a sequence type";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }
+
+    len = PySequence_Length( obj );
+
+    self->inputSegmentSize = malloc(len*sizeof(int));
+    self->inputSegmentLen = len;
+    
+    for (i = 0; i < len; i++)
+    {
+        item = PySequence_GetItem(obj, i);
+        if (item != Py_None)
+        {
+            self->inputSegmentSize[i] = PyInt_AsLong(item);
+            if (self->inputSegmentSize[i] < 0)
+            {  
+                exception = IIDBI_InterfaceError;
+                errMsg = "argument has invalid type";
+                result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+                goto errorExit;
+            }
+        }
+		else
+            self->inputSegmentSize[i] = 0;
+        Py_DECREF(item);
+    }
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorSetInputSizes }}}1\n", self);
+    Py_INCREF(Py_None);
+    return(Py_None);
+
+errorExit:
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorSetInputSizes }}}1\n", self);
+    if (result)
+    {
+        Py_INCREF(Py_None);
+        return Py_None;
+    }
+
+    return NULL;
+}
+
+/*{
+** Name: IIDBI_cursorSetOutputSize
+**
+** Description:
+**    Determines the segment size for fetching blob data.
+**
+** Inputs:
+**     self - cursor object.
+**     args - evaluates to output segment size, with optional index into
+**            the blob column.
+**
+** Outputs:
+**     args must evaluate to at least one, or at most two, integers.
+**
+** Returns:
+**     None.
+**         
+** Exceptions:
+**         
+** Side Effects:
+**     Determines segment size in SQLGetData() in the ODBC layer.
+**
+** History:
+**     26-May-06 Ralph.Loen@ingres.com
+**         Created.
+}*/
+
+
+static PyObject *IIDBI_cursorSetOutputSize(IIDBI_CURSOR *self, PyObject *args)
+{
+    int size = 0;
+    int column = 0;
+    PyObject *exception;
+    char *errMsg;
+    int result = FALSE;
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorSetOutputSize {{{1\n", self);
+
+    if (!PyArg_ParseTuple(args, "i|i", &size, &column)) 
+    {
+        exception = IIDBI_InterfaceError;
+        errMsg = "invalid argruments for cursor.setoutputsize";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }
+
+    self->outputSegmentSize = size;
+    self->outputColumnIndex = column;
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorSetOutputSize }}}1\n", self);
+
+    Py_INCREF(Py_None);
+    return(Py_None);
+
+errorExit:
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorSetOutputSize }}}1\n", self);
+
+    if (result)
+    {
+        Py_INCREF(Py_None);
+        return Py_None;
+    }
+    return NULL;
+}
+
+/*{
+** Name: IIDBI_fetchMany
+**
+** Description:
+**     Fetch a pre-determined number of rows.
+**
+** Inputs:
+**     self - cursor object.
+**     args - evaluates to the number of rows.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     A list of rows up to the specified maximum.
+**    
+** Exceptions:
+**     Args must evaluate to an integer.  The cursor must be open. The 
+**     ODBC statement handle must be non-null.  The cursor object must have 
+**     a valid descriptor and descriptor count.  The fetch must succeed.
+**         
+** Side Effects:
+**     None.
+**
+** History:
+**     26-May-06 Ralph.Loen@ingres.com
+**         Created.
+**     16-Oct-2026 (agent)
+**         Rows are fetched by IIDBI_cursorFetchRows().
+}*/
+
+static PyObject *IIDBI_cursorFetchMany(IIDBI_CURSOR *self, PyObject *args)
+{
+    PyObject *list = NULL;
+    int arraySize = 0;
+    int resultSetSize = 0;
+    PyObject *exception;
+    char *errMsg;
+    int result = FALSE;
+ 
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorFetchMany {{{1\n", self);
+
+    if (self->closed)
+    {
+        exception = IIDBI_InterfaceError; 
+        errMsg = "cursor is already closed";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }
+    if (!self->IIDBIpstmt)
+    {
+        exception = IIDBI_InternalError;
+        errMsg = "Invalid DBI statement handle";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }
+
+    if (self->arraysize < 0)
+    {
+        exception = IIDBI_InterfaceError; 
+        errMsg = "cursor.arraysize attribute must not be a negative value";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }
+
+    if (!PyArg_ParseTuple(args, "|i", &resultSetSize)) 
+    {
+        exception = IIDBI_InterfaceError; 
+        errMsg = "usage: cursor.fetchmany([rows])";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }  
+
+    if (resultSetSize < 0)
+    {
+        exception = IIDBI_InterfaceError; 
+        errMsg = "cursor.fetchmany() argument must not be a negative value";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }
+    if (PyObject_Length(args) == 1)
+        arraySize = resultSetSize;
+    else
+        arraySize = self->arraysize;
+
+    list = IIDBI_cursorFetchRows(self, arraySize);
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorFetchMany }}}1\n", self);
+    return list;
+
+errorExit:
+    self->rowcount = -1;
+        Py_XDECREF(self->rownumber);
+    self->rownumber = Py_None;
+        Py_INCREF(self->rownumber);
+    self->rowindex = 0;
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorFetchMany }}}1\n", self);
+    if (result)
+    {
+        Py_INCREF(Py_None);
+        return Py_None;
+    }
+    return NULL;
+}
+
+/*{
+** Name: IIDBI_cursorFetchAll
+**
+** Description:
+**     Fetches all rows in the target table(s).
+**
+** Inputs:
+**     None.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     A list of tuples containing all available rows.
+**     
+** Exceptions:
+**     Args must evaluate to an integer.  The cursor must be open. The 
+**     ODBC statement handle must be non-null.  The cursor object must have 
+**     a valid descriptor and descriptor count.  The fetch must succeed.
+**         
+** Side Effects:
+**     None.
+**
+** History:
+**     26-May-06 Ralph.Loen@ingres.com
+**         Created.
+**     16-Oct-2026 (agent)
+**         Rows are fetched by IIDBI_cursorFetchRows().
+}*/
+
+static PyObject *IIDBI_cursorFetchAll(IIDBI_CURSOR *self)
+{
+    PyObject *list = NULL;
+    PyObject *exception;
+    char *errMsg;
+    int result = FALSE;
+ 
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorFetchAll {{{1\n", self);
+
+    if (self->closed)
+    {
+        exception = IIDBI_InterfaceError; 
+        errMsg = "cursor is already closed";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }
+
+    if (!self->IIDBIpstmt)
+    {
+        exception = IIDBI_InternalError;
+        errMsg = "Invalid DBI statement handle";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }
+
+    list = IIDBI_cursorFetchRows(self, -1);
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorFetchAll (success) %d }}}1\n", self,          self->rowcount);
+    return list;
+
+errorExit:
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorFetchAll (err) %d }}}1\n", self,
+        self->rowcount);
+    self->rowcount = -1;
+    Py_XDECREF(self->rownumber);
+    self->rownumber = Py_None;
+    Py_INCREF(self->rownumber);
+    self->rowindex = 0;
+    if (result)
+    {
+        Py_INCREF(Py_None);
+        return Py_None;
+    }
+    return NULL;
+}
+
+/*{
+** Name: IIDBI_connCommit
+**
+** Description:
+**     Commit a transaction.
+**
+** Inputs:
+**     self - connection object.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None.
+**         
+** Exceptions:
+**     ODBC connection handle must be valid.  Connection object must be open.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     26-May-06 Ralph.Loen@ingres.com
+**         Created.
+}*/
+
+static PyObject *IIDBI_connCommit(IIDBI_CONNECTION *self)
+{
+    RETCODE rc;
+    IIDBI_DBC *IIDBIpdbc = self->IIDBIpdbc;
+    PyObject *exception;
+    char *errMsg;
+    int result = FALSE;
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_connCommit {{{1\n", self);
+    if (self->closed)
+    {
+        exception = self->Error;
+        errMsg = "connection is closed";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }
+    if (!self->IIDBIpdbc)
+    {
+        exception = self->InterfaceError;
+        errMsg = "Invalid DBI connection handle";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    rc = dbi_connectionCommit(self->IIDBIpdbc);
+    Py_END_ALLOW_THREADS
+    if (rc != DBI_SQL_SUCCESS)
+    {
+        result = IIDBI_mapError2exception((PyObject *)self,&IIDBIpdbc->hdr.err, 
+            rc, NULL);
+        goto errorExit;
+    }
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_connCommit }}}1\n", self);
+    Py_INCREF(Py_None);
+    return Py_None;
+
+errorExit:
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_connCommit }}}1\n", self);
+    if (result)
+    {
+        Py_INCREF(Py_None);
+        return Py_None;
+    }
+    return NULL;
+}
+
+/*{
+** Name: IIDBI_connRollback
+**
+** Description:
+**     Roll back a transaction.
+**
+** Inputs:
+**     self - connection object.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None.
+**         
+** Exceptions:
+**     ODBC connection handle must be valid.  Connection object must be open.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     26-May-06 Ralph.Loen@ingres.com
+**         Created.
+}*/
+
+static PyObject *IIDBI_connRollback(IIDBI_CONNECTION *self)
+{
+    RETCODE rc;
+    IIDBI_DBC *IIDBIpdbc = self->IIDBIpdbc;
+    PyObject *exception;
+    char *errMsg; 
+    int result = FALSE;
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_connRollback {{{1\n", self);
+
+    if (self->closed)
+    {
+        exception = self->Error; 
+        errMsg = "connection is closed";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }
+    if (!self->IIDBIpdbc)
+    {
+        exception = self->InterfaceError;
+        errMsg = "Invalid DBI connection handle";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    rc = dbi_connectionRollback(self->IIDBIpdbc);
+    Py_END_ALLOW_THREADS
+    if (rc != DBI_SQL_SUCCESS)
+    {
+        result = IIDBI_mapError2exception((PyObject *)self, &IIDBIpdbc->hdr.err, 
+            rc, NULL);
+        goto errorExit;
+    }
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_connRollback }}}1\n", self);
+    Py_INCREF(Py_None);
+    return Py_None;
+
+errorExit:
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_connRollback }}}1\n", self);
+    if (result)
+    {
+        Py_INCREF(Py_None);
+        return Py_None;
+    }
+    return NULL;
+}
+
+/*{
+** Name: IIDBI_mapError2Exception
+**
+** Description:
+**     Convert an ODBC error to an ingresdbi exception object.
+**
+** Inputs:
+**     self - connection or cursor object.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None.
+**         
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     26-May-06 Ralph.Loen@ingres.com
+**         Created.
+**     16-Oct-2026 (agent)
+**         Leave an exception raised by a parameter stream in place.
+**     17-Oct-2026 (agent)
+**         Only leave the Python exception of a failed parameter stream in
+**         place, other pending exceptions no longer change the mapping.
+}*/
+
+
+int IIDBI_mapError2exception(PyObject *self, IIDBI_ERROR *err, RETCODE rc, 
+    char *queryText)
+{
+    PyObject *errObj;
+    PyObject *exceptObj;
+    PyObject *errTuple;
+    IIDBI_CONNECTION *conn = NULL;
+    IIDBI_CURSOR *cursor = NULL;
+    int result = FALSE;
+
+    /*
+    ** A LOB parameter stream that failed raised the Python error that
+    ** caused this one, let it propagate.
+    */
+    if (err->streamFailed)
+    {
+        err->streamFailed = FALSE;
+        if (PyErr_Occurred())
+            return FALSE;
+    }
+
+    if (self && PyObject_TypeCheck(self, &IIDBI_connectType))
+        conn = (IIDBI_CONNECTION *)self;
+    else
+        cursor = (IIDBI_CURSOR *)self;
+
+    switch (rc)
+    {
+    case DBI_SQL_SUCCESS_WITH_INFO:
+        exceptObj = conn ? conn->Warning : IIDBI_Warning;
+        break;
+
+    case DBI_INTERNAL_ERROR:
+        exceptObj = conn ? conn->OperationalError : 
+            IIDBI_OperationalError;
+        break;
+
+    case DBI_SQL_ERROR:
+        if (!strcmp(err->sqlState, "23501"))
+            exceptObj = conn ? conn->IntegrityError :
+               IIDBI_IntegrityError;
+        else
+            exceptObj = conn ? conn->DataError : IIDBI_DataError;
+        break;
+
+    default:
+        exceptObj = conn ? conn->InternalError : IIDBI_InternalError;
+        break;
+    }
+    if (conn && conn->errorhandler != Py_None)
+    {
+         result = IIDBI_handleError(self, exceptObj, err->messageText);
+         goto handler_exit;
+    }
+    else if (cursor && cursor->errorhandler != Py_None)
+    {
+         result = IIDBI_handleError(self, exceptObj, err->messageText);
+         goto handler_exit;
+    }
+
+    errObj = Py_BuildValue("iissz", rc, err->native, err->sqlState,  
+        err->messageText, queryText);
+
+    errTuple = Py_BuildValue("OO", exceptObj, errObj);
+
+    PyList_Append( conn ? conn->messages : cursor->messages, errTuple);
+    Py_DECREF(errTuple);
+
+    PyErr_SetObject(exceptObj, errObj);
+
+    return FALSE;
+
+handler_exit:
+    return result;
+}
+
+/*{
+** Name: IIDBI_connClose
+**
+** Description:
+**      Mark a connection object as closed and deallocate connection data.
+**
+** Inputs:
+**     self - connection object.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None.
+**
+** Exceptions:
+**     Connection object must be open.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     26-May-06 Ralph.Loen@ingres.com
+**         Created.
+**     16-Oct-2026 (agent)
+**         Refuse to close while an asynchronous execute is in progress.
+**     17-Oct-2026 (agent)
+**         Return a pooled connection to its pool.
+}*/
+
+static PyObject *IIDBI_connClose(IIDBI_CONNECTION *self) 
+{
+    PyObject *exception;
+    char *errMsg;
+    int result = FALSE;
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_connClose {{{1\n", self);
+
+    if (self->closed)
+    {
+        exception = self->Error;
+        errMsg = "connection is already closed";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }
+
+    if (self->asyncPending)
+    {
+        exception = self->InterfaceError;
+        errMsg = "asynchronous execute in progress";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }
+
+    if (self->pool)
+        IIDBI_poolRelease(self);
+    else
+    {
+        self->closed = TRUE;
+        IIDBI_connCleanup(self);
+    }
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_connClose }}}1\n", self);
+    Py_INCREF(Py_None);
+    return Py_None;
+
+errorExit:
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_connClose }}}1\n", self);
+    if (result)
+    {
+        Py_INCREF(Py_None);
+        return Py_None;
+    }
+    else
+        return NULL;
+}
+
+/*{
+** Name: IIDBI_cursorCancel
+**
+** Description:
+**     cursor.cancel(). Cancel the query the cursor is executing, from
+**     another thread while cursor.execute() is blocked in the driver,
+**     or while cursor.execute_async() is pending. The execute fails
+**     as cancelled. Nothing is done if no query is executing.
+**
+** Inputs:
+**     self - cursor object.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None.
+**         
+** Exceptions:
+**     Cursor must be open. The driver must accept the cancel.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static PyObject *IIDBI_cursorCancel(IIDBI_CURSOR *self) 
+{
+    RETCODE rc;
+    PyObject *exception;
+    char *errMsg;
+    int result = FALSE;
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorCancel {{{1\n", self);
+
+    IIDBI_handleWarning("DB-API extension cursor.cancel() used", NULL);
+
+    if (self->closed)
+    {
+        exception = IIDBI_InterfaceError;
+        errMsg = "cursor is already closed";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }
+
+    /*
+    ** The GIL is kept, so the statement cannot be released by a close()
+    ** in another thread while it is being cancelled.
+    */
+    if (self->IIDBIpstmt)
+    {
+        rc = dbi_cursorCancel(self->IIDBIpstmt);
+        if (rc != DBI_SQL_SUCCESS)
+        {
+            exception = IIDBI_OperationalError;
+            errMsg = "Could not cancel the query";
+            result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+            goto errorExit;
+        }
+    }
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorCancel }}}1\n", self);
+    Py_INCREF(Py_None);
+    return Py_None;
+
+errorExit:
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorCancel }}}1\n", self);
+    if (result)
+    {
+        Py_INCREF(Py_None);
+        return Py_None;
+    }
+    return NULL;
+}
+
+/*{
+** Name: IIDBI_cursorClose
+**
+** Description:
+**     Close a DBI cursor object.
+**
+** Inputs:
+**     self - cursor object.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None.
+**         
+** Exceptions:
+**     Cursor object must be open.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     26-May-06 Ralph.Loen@ingres.com
+**         Created.
+}*/
+
+static PyObject *IIDBI_cursorClose(IIDBI_CURSOR *self) 
+{
+    PyObject *exception;
+    char *errMsg;
+    int result = FALSE;
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorClose {{{1\n", self);
+
+    if (self->closed)
+    {
+        exception = IIDBI_InterfaceError;
+        errMsg = "cursor is already closed";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }
+   
+    self->closed = TRUE;
+
+    if (IIDBI_cursorCleanup(self) != DBI_SQL_SUCCESS)
+    {
+        exception = IIDBI_InternalError;
+        errMsg = "Error releasing cursor resources";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorClose }}}1\n", self);
+    Py_INCREF(Py_None);
+    return Py_None;
+
+errorExit:
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorClose }}}1\n", self);
+    if (result)
+    {
+        Py_INCREF(Py_None);
+        return Py_None;
+    }
+    return NULL;
+}
+
+/*{
+** Name: IIDBI_cursorCleanup
+**
+** Description:
+**     Deallocate internal cursor resources and mark closed.
+**
+** Inputs:
+**     self - cursor object.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     DBI_SQL_SUCCESS;
+**
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     26-May-06 Ralph.Loen@ingres.com
+**         Created.
+**     16-Oct-2026 (agent)
+**         Free the prepared query text.
+**     16-Oct-2026 (agent)
+**         Release the resolved output converters.
+**     16-Oct-2026 (agent)
+**         Release the parameter kind cache.
+**     16-Oct-2026 (agent)
+**         Free the parameter arena.
+**     16-Oct-2026 (agent)
+**         Wait for a pending asynchronous execute before the statement is
+**         released.
+**     17-Oct-2026 (agent)
+**         Remove the cursor from the connection's open cursors.
+**     17-Oct-2026 (agent)
+**         Free the parameter arena even when releasing the descriptors failed.
+}*/
+
+int IIDBI_cursorCleanup(IIDBI_CURSOR *self)
+{
+    IIDBI_CONNECTION *connection = self->connection;
+    int rc = DBI_SQL_SUCCESS;
+    IIDBI_STMT *IIDBIpstmt = NULL;
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorCleanup }}}1\n", self);
+
+    IIDBIpstmt = self->IIDBIpstmt;
+
+    self->closed = 1;
+
+    if (connection->cursors == self)
+        connection->cursors = self->nextCursor;
+    if (self->prevCursor)
+        self->prevCursor->nextCursor = self->nextCursor;
+    if (self->nextCursor)
+        self->nextCursor->prevCursor = self->prevCursor;
+    self->prevCursor = NULL;
+    self->nextCursor = NULL;
+
+    /* the statement is released below, wait for the worker using it */
+    if (self->asyncExec)
+        IIDBI_asyncExecJoin(self, FALSE);
+
+    if (!IIDBIpstmt)
+        goto exitLabel;
+
+    if (!connection->closed)
+    {
+        Py_BEGIN_ALLOW_THREADS
+        rc = dbi_cursorClose(self->IIDBIpstmt);
+        Py_END_ALLOW_THREADS
+        if (rc != DBI_SQL_SUCCESS)
+            goto exitLabel;
+    }
+    if (IIDBIpstmt->descCount)
+    {
+        rc = dbi_freeDescriptor(IIDBIpstmt, 0);
+        if (rc != DBI_SQL_SUCCESS)
+            goto exitLabel;
+    }
+
+    if (IIDBIpstmt->parmCount)
+    {
+        rc = dbi_freeDescriptor(IIDBIpstmt, 1);
+        if (rc != DBI_SQL_SUCCESS)
+            goto exitLabel;
+    }
+
+exitLabel:
+
+    if (self->szSqlStr)
+    {
+         free(self->szSqlStr);
+         self->szSqlStr = NULL;
+    }
+
+    IIDBI_clearMessages(self->messages);
+    if (IIDBIpstmt && IIDBIpstmt->preparedText)
+        free(IIDBIpstmt->preparedText);
+    if (IIDBIpstmt)
+        dbi_paramArenaFree(IIDBIpstmt);
+    if (IIDBIpstmt)
+	free(IIDBIpstmt);
+    self->IIDBIpstmt = NULL;
+
+    self->rowcount = -1;
+    Py_XDECREF(self->rownumber);
+    self->rownumber = Py_None;
+    Py_INCREF(self->rownumber);
+    self->rowindex = 0;
+
+    if (self->inputSegmentSize)
+        free(self->inputSegmentSize);
+    self->inputSegmentSize = NULL;
+    self->inputSegmentLen = 0;
+    IIDBI_convertRelease(self);
+    IIDBI_paramKindRelease(self);
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorCleanup {{{1\n", self);
+    return rc;
+}
+
+/*{
+** Name: IIDBI_mapType
+**
+** Description:
+**     Map an ODBC data type to one of the five ingresdbi module attribute
+**     type codes: NUMBER, BINARY, STRING, UNICODE, or DATETIME.
+**
+** Inputs:
+**     ODBC SQL type.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     DBI_NUMBER_TYPE
+**     DBI_BINARY_TYPE
+**     DBI_STRING_TYPE
+**     DBI_UNICODE_TYPE
+**     DBI_DATETIME_TYPE
+**
+** Exceptions:
+**     None.      
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     26-May-06 Ralph.Loen@ingres.com
+**         Created.
+}*/
+
+int IIDBI_mapType(int type)
+{
+    int retType = DBI_UNKNOWN_TYPE;
+
+    switch (type)
+    {
+    case SQL_CHAR:
+    case SQL_VARCHAR:
+    case SQL_NUMERIC:
+       retType = DBI_STRING_TYPE;
+       break;
+
+    case SQL_WCHAR:
+    case SQL_WVARCHAR:
+    case SQL_WLONGVARCHAR:
+       retType = DBI_UNICODE_TYPE;
+       break;
+    case SQL_FLOAT:
+    case SQL_REAL:
+    case SQL_DOUBLE:
+    case SQL_BIGINT:
+    case SQL_SMALLINT:
+    case SQL_TINYINT:
+    case SQL_INTEGER:
+    case SQL_DECIMAL:
+        retType = DBI_NUMBER_TYPE;
+        break;
+
+    case SQL_TYPE_TIMESTAMP:
+    case SQL_TYPE_DATE:
+    case SQL_TYPE_TIME:
+        retType = DBI_DATETIME_TYPE;
+        break;
+
+    case SQL_BIT:
+#ifdef SQL_BIT_VARYING 
+    case SQL_BIT_VARYING:
+#endif
+    case SQL_LONGVARBINARY:
+    case SQL_LONGVARCHAR:
+    case SQL_BINARY:
+    case SQL_VARBINARY:
+        retType = DBI_BINARY_TYPE;
+        break;
+
+    default:
+        retType = DBI_UNKNOWN_TYPE;
+        break;
+    }
+    return retType;
+}
+
+/*{
+** Name: IIDBI_cursorIterator
+**
+** Description:
+**     Iterator method for cursor object.
+**
+** Inputs:
+**     self - cursor object.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     New reference to cursor object.
+**         
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     If no row has been fetched yet the result columns are bound so that
+**     the iteration is served from a rowset of at least IIDBI_ITER_ROWSET
+**     rows.
+**
+** History:
+**     26-May-06 Ralph.Loen@ingres.com
+**         Created.
+**     16-Oct-2026 (agent)
+**         Warn only once per cursor. Bind the result columns for block
+**         fetches before the first row is fetched.
+**     16-Oct-2026 (agent)
+**         Pass cursor.prefetch on to the column binding.
+**     16-Oct-2026 (agent)
+**         Wait for a pending asynchronous execute first.
+**     17-Oct-2026 (agent)
+**         Bind the columns with IIDBI_cursorBindRowset().
+}*/
+
+static PyObject *IIDBI_cursorIterator(IIDBI_CURSOR *self) 
+{
+    IIDBI_STMT *IIDBIpstmt = self->IIDBIpstmt;
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorIterator {{{1\n", self);
+    if (!self->iterWarned)
+    {
+        IIDBI_handleWarning ( "DB-API extension cursor.__iter__() used",
+            NULL ) ;
+        self->iterWarned = TRUE;
+    }
+
+    if (self->asyncExec && IIDBI_asyncExecJoin(self, TRUE) < 0)
+        return NULL;
+
+    if (!self->closed && IIDBIpstmt)
+        IIDBI_cursorBindRowset(self, IIDBIpstmt);
+
+    Py_INCREF(self); 
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorIterator }}}1\n", self);
+    return ((PyObject *)self);
+}
+
+/*{
+** Name: IIDBI_cursorIterNext
+**
+** Description:
+**     Iterator method for cursor object.  Returns a row from a
+**     previously executed select query. Rows already held in the
+**     current rowset are returned without going through 
+**     IIDBI_cursorFetch().
+**
+** Inputs:
+**     self - cursor object. 
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**    row - a row of data from the DBMS.
+**
+** Exceptions:
+**    Raises PyExc_StopIteration when EOD is reached.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     26-May-06 Ralph.Loen@ingres.com
+**         Created.
+**     16-Oct-2026 (agent)
+**         Warn only once per cursor. Added the rowset fast path.
+**     16-Oct-2026 (agent)
+**         Wait for a pending asynchronous execute first.
+}*/
+
+static PyObject *IIDBI_cursorIterNext(IIDBI_CURSOR *self)
+{
+    IIDBI_STMT *IIDBIpstmt = self->IIDBIpstmt;
+    PyObject *row = NULL;
+    PyObject *exception;
+    char *errMsg;
+    int result = FALSE;
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorIterNext {{{1\n", self);
+    if (!self->nextWarned)
+    {
+        IIDBI_handleWarning ( "DB-API extension cursor.next() used",
+            NULL ) ;
+        self->nextWarned = TRUE;
+    }
+
+    if (self->asyncExec && IIDBI_asyncExecJoin(self, TRUE) < 0)
+        return NULL;
+
+    if (!self->closed && IIDBIpstmt && IIDBIpstmt->descriptor &&
+        self->connection != (IIDBI_CONNECTION *)Py_None &&
+        !self->connection->closed && dbi_rowsetPending(IIDBIpstmt))
+    {
+        /* served from memory, cannot fail */
+        dbi_cursorFetchone(IIDBIpstmt);
+        row = IIDBI_cursorBuildRow(self, IIDBIpstmt, &result);
+        if (!row)
+            goto errorExit;
+        self->rowcount = IIDBIpstmt->rowCount;
+        self->rowindex++;
+        Py_XDECREF(self->rownumber);
+        self->rownumber = PyInt_FromLong(self->rowindex);
+        DBPRINTF(DBI_TRC_RET)("%p: IIDBI_iterNext }}}1\n", self);
+        return (row);
+    }
+
+    row = IIDBI_cursorFetch(self);
+    if (row == NULL)
+    {
+        exception = IIDBI_DatabaseError;
+        errMsg = "Error fetching rows";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }
+    if (row == Py_None)
+    {
+	Py_XDECREF(row);
+        PyErr_SetString(PyExc_StopIteration, "EOD");
+        goto errorExit;
+    }    
+ 
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_iterNext }}}1\n", self);
+    
+    return (row);
+
+errorExit:
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_iterNext }}}1\n", self);
+    if (result)
+    {
+        Py_INCREF(Py_None);
+        return Py_None;
+    }
+    return NULL;
+}
+
+/*{
+** Name: IIDBI_handleError
+**
+** Description:
+**      Raise an error if self->errorhandler is NULL.  If self->errorhandler
+**      is non-NULL, execute the errorhandler routine and return.  Populate
+**      self->messages with error information.
+**
+** Inputs:
+**     self - connection or cursor object.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     TRUE if self->errorhandler is non-NULL, FALSE otherwise.
+**
+** Exceptions:
+**     None.    
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     26-May-06 Ralph.Loen@ingres.com
+**         Created.
+}*/
+
+int IIDBI_handleError(PyObject *self, PyObject *exception, char *errMsg)
+{
+    PyObject  *errTuple;
+    IIDBI_CONNECTION *conn = NULL;
+    IIDBI_CURSOR *cursor = NULL;
+    PyObject *calledObj = NULL;
+    PyObject *args = NULL; 
+  
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_handleError {{{1\n", self);
+
+    if (self && PyObject_TypeCheck(self, &IIDBI_connectType))
+        conn = (IIDBI_CONNECTION *)self;
+    else
+        cursor = (IIDBI_CURSOR *)self;
+     
+    errTuple = Py_BuildValue("Os", exception, errMsg);
+    if (conn)
+       PyList_Append( conn->messages, errTuple);
+    else
+       PyList_Append( cursor->messages, errTuple);
+    Py_XDECREF(errTuple);
+
+    if (conn && conn->errorhandler != Py_None)
+    {
+        args = Py_BuildValue("OOOs",self, Py_None, exception, errMsg);
+        if (args)
+        {
+            calledObj = PyEval_CallObject(conn->errorhandler, args);
+            Py_XDECREF(args);
+            if (calledObj)
+            {               
+                Py_XDECREF(calledObj);
+                goto handler_exit;
+            }
+            else
+            {
+                exception = IIDBI_ProgrammingError;
+                errMsg = "Usage: connection.errorhandler(connection, cursor, exception, errMsg)";
+            }
+        }
+        else
+        {
+            exception = IIDBI_InternalError;
+            errMsg = "Could not build internal arguments from connection.errorhandler()";
+        }
+    }
+    else if (cursor && cursor->errorhandler != Py_None)
+    {
+        args = Py_BuildValue("OOOs",cursor->connection, 
+            cursor, exception, errMsg);
+        if (args)
+        {
+            calledObj = PyEval_CallObject(cursor->errorhandler, args);
+            Py_XDECREF(args);
+            if (calledObj)
+            {
+                 Py_XDECREF(calledObj);
+                 goto handler_exit;
+            }
+            else
+            {
+                exception = IIDBI_ProgrammingError;
+                errMsg = "Usage: cursor.errorhandler(connection, cursor, exception, errMsg)";
+            }
+        }
+        else
+        {
+            exception = IIDBI_InternalError;
+            errMsg = "Could not build internal arguments from cursor.errorhandler()";
+        }
+    }
+    if (calledObj != Py_None) 
+    {
+        DBPRINTF(DBI_TRC_STAT)("%p: IIDBI_handleError ERROR: %s\n", self, errMsg);
+
+        PyErr_SetString(exception, errMsg);
+
+        DBPRINTF(DBI_TRC_RET)("%p: IIDBI_handleError }}}1\n", self);
+        return FALSE;
+    }
+
+handler_exit:
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_handleError }}}1\n", self);
+    return TRUE;
+}
+
+/*{
+** Name: IIDBI_handleWarning
+**
+** Description:
+**     Raise a warning exception and optionally populate self->messages with
+**     warning information.
+**
+** Inputs:
+**     self - connection or cursor object.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     Void.    
+**
+** Exceptions:
+**     None.    
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     26-May-06 Ralph.Loen@ingres.com
+**         Created.
+}*/
+
+void IIDBI_handleWarning(char *errMsg, PyObject *messages)
+{
+    PyObject  *errTuple;
+
+    DBPRINTF(DBI_TRC_RET)("IIDBI_handleWarning {{{1\n");
+
+    PyErr_Warn( PyExc_Warning, errMsg ) ;
+
+    if (messages)
+    {
+        errTuple = Py_BuildValue("Os",PyExc_Warning, errMsg);
+        PyList_Append( messages, errTuple);
+        Py_DECREF(errTuple);
+    }
+
+    DBPRINTF(DBI_TRC_RET)("IIDBI_handleWarning }}}1\n");
+}
+
+/*{
+** Name: IIDBI_clearMessages
+**
+** Description:
+**     Clear the message queue.
+**
+** Inputs:
+**     messages - a list of cursor or connection error and warning messages.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     Void.    
+**
+** Exceptions:
+**     None.    
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     26-May-06 Ralph.Loen@ingres.com
+**         Created.
+}*/
+
+void IIDBI_clearMessages(PyObject *messages)
+{
+    int count;
+
+    DBPRINTF(DBI_TRC_RET)("IIDBI_clearMessages {{{1\n");
+
+    count = PyList_Size(messages);
+
+    if (count)
+        PySequence_DelSlice(messages, 0, count);
+
+    DBPRINTF(DBI_TRC_RET)("IIDBI_clearMessages }}}1\n");
+}
+
+/*{
+** Name: IIDBI_checkBoolean
+**
+** Description:
+**     Evaluate argument and return TRUE or FALSE.  
+**
+** Inputs:
+**     arg - argument string.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     TRUE if first character is "y" or string evaluates to "ON".
+**     FALSE otherwise.
+**
+** Exceptions:
+**     None.     
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     26-May-06 Ralph.Loen@ingres.com
+**         Created.
+}*/
+
+int checkBooleanArg(char *arg)
+{
+    int i;
+    int result;
+
+    for (i = 0; i < (int)strlen(arg); i++)
+    {
+        result = toupper(arg[i]);
+        arg[i] = result;
+    }
+    if (!strcmp(arg, "ON") || arg[0] == 'Y')
+        return TRUE;
+    else
+        return FALSE;
+}
+
+/*{
+** Name: IIDBI_connCleanup
+**
+** Description:
+**     Deallocate connection object resources and mark closed.
+**
+** Inputs:
+**     self - connection object.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**    Void.     
+**
+** Exceptions:
+**    None.     
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     26-May-06 Ralph.Loen@ingres.com
+**         Created.
+**     17-Oct-2026 (agent)
+**         Release the shared environment.
+}*/
+
+void IIDBI_connCleanup(IIDBI_CONNECTION * self)
+{
+    IIDBI_DBC *IIDBIpdbc = self->IIDBIpdbc;
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_connCleanup {{{1\n", self);
+
+    self->closed = TRUE;
+
+    if (self->IIDBIpdbc) 
+    {
+        Py_BEGIN_ALLOW_THREADS
+        dbi_connectionRollback(IIDBIpdbc);
+        Py_END_ALLOW_THREADS
+
+        Py_BEGIN_ALLOW_THREADS
+        dbi_connectionClose(IIDBIpdbc);
+        Py_END_ALLOW_THREADS
+    }
+
+    if (self->dsn)
+    {
+        free(self->dsn);
+        self->dsn = NULL;
+    }
+    if (self->uid)
+    {
+        free(self->uid);
+        self->uid = NULL;
+    }
+    if (self->pwd)
+    {	   
+        free(self->pwd);
+	self->pwd = NULL;
+    }
+
+    if (self->database)
+    {
+        free(self->database);
+	self->database=NULL;
+    }
+
+    if (self->vnode)
+    {	    
+        free(self->vnode);
+	self->vnode = NULL;
+    }
+    if (self->servertype)
+    {
+        free(self->servertype);
+	self->servertype = NULL;
+    }
+
+    if (self->driver)
+    {
+        free(self->driver);
+	self->driver = NULL;
+    }
+ 
+    if (self->group)
+    {
+        free(self->group);
+        self->group = NULL;
+    }
+  
+    if (self->dbms_pwd)
+    {
+        free(self->dbms_pwd);
+	self->dbms_pwd = NULL;
+    }
+  
+    if (self->rolename)
+    {
+        free(self->rolename);
+	self->rolename = NULL;
+    }
+  
+    if (self->rolepwd)
+    {
+        free(self->rolepwd);
+	self->rolepwd = NULL;
+    }
+  
+    if (self->connectstr)
+    {
+        free(self->connectstr);
+	self->connectstr = NULL;
+    }
+    
+    IIDBI_clearMessages(self->messages);
+
+    self->trace = 0;
+
+    if (self->IIDBIpdbc)
+    {
+        IIDBI_envRelease(self->IIDBIpdbc);
+        free(self->IIDBIpdbc);
+        self->IIDBIpdbc = NULL;
+    }
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_connCleanup }}}1\n", self);
+}
+
+/*{
+** Name: IIDBI_sendParameters
+**
+** Description:
+**     Prepare input parameters for execution.
+**
+** Inputs:
+**     self - cursor object. 
+**     params - sequence of parameter data.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None.         
+**
+** Exceptions:
+**     Params must be in sequence format with a size greater than zero. 
+**     A parameter descriptor must be successfully allocated.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     26-May-06 Ralph.Loen@ingres.com
+**         Created.
+**     16-Oct-2026 (agent)
+**         When IIDBIpstmt->keepParameters is set, reuse the descriptors
+**         and buffers of the previous row; a parameter is only rebound
+**         when its type changes or its buffer has to grow.
+**     16-Oct-2026 (agent)
+**         Accept file-like objects and iterators as LONG BYTE parameters.
+**     16-Oct-2026 (agent)
+**         Format Decimal parameters with IIDBI_decimalToChar(). Release
+**         the string str() returns for the others.
+**     16-Oct-2026 (agent)
+**         Dispatch on the parameter kind cached for each position by
+**         IIDBI_paramKindCache(), the type checks only run when the type
+**         at a position changes.
+**     16-Oct-2026 (agent)
+**         Keep int, long, float, datetime, date, time and Decimal values
+**         in the descriptor's arena slot rather than allocating them.
+**         Copy unicode values without the reference PyUnicode_FromObject()
+**         leaked.
+**     16-Oct-2026 (agent)
+**         Bind a unicode value's own storage when Py_UNICODE is as wide
+**         as SQLWCHAR, else transcode it into the statement's wide
+**         buffer rather than a buffer that was never freed.
+}*/
+
+int IIDBI_sendParameters(IIDBI_CURSOR *self, PyObject *params)
+{
+    PyObject *exception;
+    char *errMsg;
+    int result=0;
+    int rc=0;
+    int parmCount;
+    int i;
+    int len;
+    PyObject *elem = NULL;
+    IIDBI_DESCRIPTOR **parameter=NULL;
+    SQL_TIME_STRUCT *tm=NULL;
+    SQL_DATE_STRUCT *date=NULL;
+    SQL_TIMESTAMP_STRUCT *ts=NULL;
+    SQLWCHAR *unicodeStr=NULL;
+    Py_ssize_t tmplength=0;
+    Py_ssize_t wideUsed=0;
+    IIDBI_STMT *IIDBIpstmt = self->IIDBIpstmt;
+    void *data;
+    unsigned char keep;
+    int kind;
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_sendParameters {{{1\n", self);
+    if (!PySequence_Check(params))
+    {
+        exception = IIDBI_InterfaceError; 
+        errMsg = "parameters must be in sequence format";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }
+    parmCount = PySequence_Size( params );
+    if (parmCount == -1)
+    {
+        Py_XDECREF(params);
+        exception = IIDBI_InternalError; 
+        errMsg = "could not determine parameter count";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }
+
+    if (!parmCount)
+    {
+        Py_XDECREF(params);
+        exception = IIDBI_OperationalError; 
+        errMsg = "cursor.execute() specified parameters, but the parameter count is zero";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }
+
+    /*
+    ** executemany() keeps the descriptors from the previous row, only the
+    ** values are rewritten.
+    */
+    keep = IIDBIpstmt->keepParameters && IIDBIpstmt->parameter &&
+        IIDBIpstmt->parmCount == parmCount && IIDBIpstmt->paramsetSize <= 1;
+    if (!keep && IIDBIpstmt->keepParameters && IIDBIpstmt->parmCount)
+        dbi_freeDescriptor(IIDBIpstmt, 1);
+
+    IIDBIpstmt->parmCount = parmCount;
+
+    if (keep)
+        rc = DBI_SQL_SUCCESS;
+    else
+        rc = dbi_allocDescriptor(IIDBIpstmt, parmCount, 1);
+    if (rc != DBI_SQL_SUCCESS)
+    {
+        Py_XDECREF(params);
+        exception = IIDBI_OperationalError;
+        errMsg = "could not allocate descriptor";
+        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        goto errorExit;
+    }
+
+    parameter = IIDBIpstmt->parameter;
+    for (i = 0; i < parmCount; i++)
+    {
+        elem = PySequence_GetItem(params, i);
+        if (!elem)
+        {
+            Py_XDECREF(params);
+            exception = IIDBI_InternalError;
+            errMsg = "failed to retrieve input parameter sequence";
+            result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+            goto errorExit;
+        }
+
+        /*
+        ** Positions keep the kind of the last value's type, so rows of
+        ** the same types skip the type checks.
+        */
+        if (elem == Py_None)
+            kind = IIDBI_PARAM_NONE;
+        else if (i < self->paramKindCount && 
+            (PyObject *)Py_TYPE(elem) == self->paramTypes[i])
+            kind = self->paramKinds[i];
+        else
+        {
+            kind = IIDBI_paramKind(elem);
+            if (kind != IIDBI_PARAM_UNKNOWN && kind != IIDBI_PARAM_STREAM)
+                IIDBI_paramKindCache(self, i, parmCount, elem, kind);
+        }
+
+        if (kind == IIDBI_PARAM_INT) 
+        {
+            if (parameter[i]->type != SQL_INTEGER)
+                dbi_resetParameter(parameter[i]);
+            parameter[i]->data = parameter[i]->slot;
+            *(int *)parameter[i]->data = PyInt_AsLong(elem);
+            parameter[i]->type = SQL_INTEGER;
+            parameter[i]->cType = SQL_C_LONG;
+            parameter[i]->precision = sizeof(int);
+            parameter[i]->scale = 0;
+            parameter[i]->orInd = 0;
+            parameter[i]->isNull = 0;
+        }
+        else if (kind == IIDBI_PARAM_LONG) 
+        {
+            if (parameter[i]->type != SQL_BIGINT)
+                dbi_resetParameter(parameter[i]);
+            parameter[i]->data = parameter[i]->slot;
+            *(ODBCINT64 *)parameter[i]->data = PyLong_AsLongLong(elem);
+            parameter[i]->type = SQL_BIGINT;
+            parameter[i]->cType = SQL_C_SBIGINT;
+            parameter[i]->precision = 0;
+            parameter[i]->scale = 0;
+            parameter[i]->orInd = 0;
+            parameter[i]->isNull = 0;
+        }
+        else if (kind == IIDBI_PARAM_FLOAT) 
+        {
+            if (parameter[i]->type != SQL_DOUBLE)
+                dbi_resetParameter(parameter[i]);
+            parameter[i]->data = parameter[i]->slot;
+            *(double *)parameter[i]->data = PyFloat_AsDouble(elem);
+            parameter[i]->type = SQL_DOUBLE;
+            parameter[i]->cType = SQL_C_DOUBLE;
+            parameter[i]->precision = 8;
+            parameter[i]->scale = 0;
+            parameter[i]->orInd = 0;
+            parameter[i]->isNull = 0;
+        }
+        else if (kind == IIDBI_PARAM_STRING) 
+        {
+            if (parameter[i]->type != SQL_VARCHAR)
+                dbi_resetParameter(parameter[i]);
+            if (IIDBIpstmt->keepParameters)
+            {
+                /*
+                ** Copy into a buffer owned by the descriptor so the 
+                ** binding outlives the row. The column size is the
+                ** buffer size, it is only rebound when the buffer grows.
+                */
+                len = (int)PyString_GET_SIZE(elem);
+                if (!parameter[i]->rowsetData || len >= parameter[i]->bindSize)
+                {
+                    dbi_resetParameter(parameter[i]);
+                    parameter[i]->bindSize = len + 1;
+                    parameter[i]->rowsetData = malloc(len + 1);
+                    if (!parameter[i]->rowsetData)
+                    {
+                        exception = IIDBI_InterfaceError;
+                        errMsg = "Unable to allocate parameter buffer";
+                        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+                        goto errorExit;
+                    }
+                    parameter[i]->precision = len ? len : 1;
+                }
+                memcpy(parameter[i]->rowsetData, PyString_AS_STRING(elem), 
+                    len + 1);
+                parameter[i]->data = parameter[i]->rowsetData;
+            }
+            else
+            {
+                parameter[i]->data = PyString_AsString(elem);
+                parameter[i]->precision = 
+                    (int)strlen((char *)parameter[i]->data);
+            }
+            parameter[i]->type = SQL_VARCHAR;
+            parameter[i]->cType = SQL_C_CHAR;
+            parameter[i]->scale = 0;
+            parameter[i]->orInd = PyString_Size(elem);
+            parameter[i]->isNull = 0;
+        }
+        else if (kind == IIDBI_PARAM_UNICODE) 
+        {
+            Py_ssize_t tmpUniStrLen=0;
+            if (parameter[i]->type != SQL_WVARCHAR)
+                dbi_resetParameter(parameter[i]);
+            tmpUniStrLen = PyUnicode_GET_SIZE(elem);
+            parameter[i]->type = SQL_WVARCHAR;
+            parameter[i]->cType = SQL_C_WCHAR;
+            parameter[i]->scale = 0;
+            parameter[i]->isNull = 0;
+
+            if (IIDBIpstmt->keepParameters)
+            {
+                /* as for str, reuse a descriptor owned buffer */
+                if (!parameter[i]->rowsetData || 
+                    IIDBI_WIDE_UNITS(tmpUniStrLen) * sizeof(SQLWCHAR) > 
+                    parameter[i]->bindSize)
+                {
+                    dbi_resetParameter(parameter[i]);
+                    parameter[i]->precision = tmpUniStrLen ? 
+                        (int)IIDBI_WIDE_UNITS(tmpUniStrLen) : 1;
+                    parameter[i]->bindSize = parameter[i]->precision * 
+                        sizeof(SQLWCHAR);
+                    parameter[i]->rowsetData = malloc(parameter[i]->bindSize);
+                    if (!parameter[i]->rowsetData)
+                    {
+                        exception = IIDBI_InterfaceError;
+                        errMsg = "Unable to allocate internal Unicode string to send to server";
+                        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+                        goto errorExit;
+                    }
+                    parameter[i]->internalSize = parameter[i]->bindSize;
+                }
+                tmplength = IIDBI_unicodeToWide(PyUnicode_AS_UNICODE(elem), 
+                    tmpUniStrLen, (SQLWCHAR *)parameter[i]->rowsetData);
+                parameter[i]->orInd = (int)(tmplength * sizeof(SQLWCHAR)); /* byte length */
+                parameter[i]->data = parameter[i]->rowsetData;
+            }
+            else if (sizeof(Py_UNICODE) == sizeof(SQLWCHAR))
+            {
+                /* 
+                ** Bind the string's own storage, params holds the
+                ** reference until the execute is done, as for str.
+                */
+                parameter[i]->orInd = (int)(tmpUniStrLen * sizeof(SQLWCHAR)); /* byte length */
+                parameter[i]->internalSize = parameter[i]->orInd; /* NOTE unlike get/fetch no +1 (sizeof(SQLWCHAR)) null terminator */
+                parameter[i]->precision = (int)tmpUniStrLen;
+                parameter[i]->data = PyUnicode_AS_UNICODE(elem);
+            }
+            else
+            {
+                /* transcode into the statement's wide buffer */
+                if (IIDBI_paramWideReserve(IIDBIpstmt, i, wideUsed, 
+                    IIDBI_WIDE_UNITS(tmpUniStrLen)) < 0)
+                {
+                    exception = IIDBI_InterfaceError;
+                    errMsg = "Unable to allocate internal Unicode string to send to server";
+                    DBPRINTF(DBI_TRC_STAT)("%s\n", errMsg);
+                    result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+                    goto errorExit;
+                }
+                unicodeStr = IIDBIpstmt->wideBuffer + wideUsed;
+                tmplength = IIDBI_unicodeToWide(PyUnicode_AS_UNICODE(elem), 
+                    tmpUniStrLen, unicodeStr);
+                wideUsed += tmplength;
+                parameter[i]->orInd = (int)(tmplength * sizeof(SQLWCHAR)); /* byte length */
+                parameter[i]->internalSize = parameter[i]->orInd; /* NOTE unlike get/fetch no +1 (sizeof(SQLWCHAR)) null terminator */
+                parameter[i]->precision = (int)tmplength;
+                parameter[i]->data = unicodeStr;
+            }
+        }
+        else if (kind == IIDBI_PARAM_BUFFER) 
+        {
+            if (!PyObject_CheckReadBuffer( elem ) )
+            {
+                exception = IIDBI_InternalError; 
+                errMsg = "Read buffer is not contiguous";
+                result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+                goto errorExit;
+            }
+            if (PyObject_AsReadBuffer( elem, (const void **)&data, &len )
+               == -1 )
+            {
+                exception = IIDBI_InternalError; 
+                errMsg = "Could not convert buffer object to pointer";
+                result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+                goto errorExit;
+            }
+            if (parameter[i]->type != SQL_LONGVARBINARY)
+                dbi_resetParameter(parameter[i]);
+            else if (parameter[i]->precision != len)
+                parameter[i]->isBound = FALSE;
+            parameter[i]->type = SQL_LONGVARBINARY;
+            parameter[i]->cType = SQL_C_BINARY;
+            parameter[i]->orInd = SQL_NTS;
+            parameter[i]->data = data;
+            parameter[i]->precision = len;
+            parameter[i]->scale = 0;
+            parameter[i]->isNull = 0;
+        }
+        else if (kind == IIDBI_PARAM_NONE)
+        {
+            if (parameter[i]->type != SQL_TYPE_NULL)
+                dbi_resetParameter(parameter[i]);
+            parameter[i]->isNull = 1;
+            parameter[i]->data = NULL;
+            parameter[i]->type = SQL_TYPE_NULL; /* UNDOCUMENTED Ingres extension - the NULL type */
+            parameter[i]->cType = SQL_C_CHAR; /* Have to have something, Microsoft ODBC manager won't accept 0, Ingres CLI does though */
+            parameter[i]->precision = 0;
+            parameter[i]->scale = 0;
+            parameter[i]->orInd = 0;
+        }
+        else if (kind == IIDBI_PARAM_DATETIME)
+        {
+            parameter[i]->isNull = 0;
+            if (parameter[i]->type != SQL_TYPE_TIMESTAMP)
+                dbi_resetParameter(parameter[i]);
+            ts = parameter[i]->slot;
+            ts->year = PyDateTime_GET_YEAR(elem);
+            ts->month = PyDateTime_GET_MONTH(elem);
+            ts->day = PyDateTime_GET_DAY(elem);
+            ts->hour = PyDateTime_DATE_GET_HOUR(elem);
+            ts->minute = PyDateTime_DATE_GET_MINUTE(elem);
+            ts->second = PyDateTime_DATE_GET_SECOND(elem);
+        ts->fraction = 0;
+            parameter[i]->data = ts;
+            parameter[i]->type = SQL_TYPE_TIMESTAMP;
+            parameter[i]->cType = SQL_C_TYPE_TIMESTAMP;
+            parameter[i]->precision = 0;
+            parameter[i]->scale = 0;
+            parameter[i]->orInd = 0;
+        }
+        else if (kind == IIDBI_PARAM_DATE)
+        {
+            parameter[i]->isNull = 0;
+            if (parameter[i]->type != SQL_TYPE_DATE)
+                dbi_resetParameter(parameter[i]);
+            date = parameter[i]->slot;
+            date->year = PyDateTime_GET_YEAR(elem);
+            date->month = PyDateTime_GET_MONTH(elem);
+            date->day = PyDateTime_GET_DAY(elem);
+            parameter[i]->data = date;
+            parameter[i]->type = SQL_TYPE_DATE;
+            parameter[i]->cType = SQL_C_TYPE_DATE;
+            parameter[i]->precision = 0;
+            parameter[i]->scale = 0;
+            parameter[i]->orInd = 0;
+        }
+        else if (kind == IIDBI_PARAM_TIME)
+        {
+            parameter[i]->isNull = 0;
+            if (parameter[i]->type != SQL_TYPE_TIME)
+                dbi_resetParameter(parameter[i]);
+            tm = parameter[i]->slot;
+            tm->hour = PyDateTime_TIME_GET_HOUR(elem);
+            tm->minute = PyDateTime_TIME_GET_MINUTE(elem);
+            tm->second = PyDateTime_TIME_GET_SECOND(elem);
+            parameter[i]->data = tm;
+            parameter[i]->type = SQL_TYPE_TIME;
+            parameter[i]->cType = SQL_C_TYPE_TIME;
+            parameter[i]->precision = 0;
+            parameter[i]->scale = 0;
+            parameter[i]->orInd = 0;
+        }
+        else if (kind == IIDBI_PARAM_DECIMAL)
+        {
+            char *decimal = NULL;
+            char *tmp_str = NULL;
+            PyObject *str = NULL;
+            int decimalLen;
+
+            /* precision and scale vary by value, always rebind */
+            dbi_resetParameter(parameter[i]);
+            decimalLen = IIDBI_decimalToChar(elem, parameter[i]->slot, 
+                IIDBI_PARAM_SLOT_SIZE, &parameter[i]->precision, 
+                &parameter[i]->scale);
+            if (decimalLen >= 0)
+                parameter[i]->data = parameter[i]->slot;
+            else if ((str = PyObject_Str(elem)) != NULL)
+            {
+                if (PyString_GET_SIZE(str) < IIDBI_PARAM_SLOT_SIZE)
+                {
+                    strcpy(parameter[i]->slot, PyString_AS_STRING(str));
+                    parameter[i]->data = parameter[i]->slot;
+                }
+                else
+                    parameter[i]->data = strdup(PyString_AsString(str));
+                Py_DECREF(str);
+            }
+            if (parameter[i]->data == NULL)
+            {
+                Py_XDECREF(params);
+                exception = IIDBI_InternalError;
+                errMsg = "strdup returned NULL";
+                result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+                goto errorExit;
+            }
+            parameter[i]->type = SQL_DECIMAL;
+            parameter[i]->cType = SQL_C_CHAR;
+            parameter[i]->orInd = SQL_NTS;
+            parameter[i]->isNull = 0;
+            if (decimalLen >= 0)
+                parameter[i]->internalSize = decimalLen + 1;
+            else
+            {
+                parameter[i]->internalSize = (int)strlen((char *)parameter[i]->data) + 1; /* +1 for NULL terminator */
+                tmp_str = (char *)parameter[i]->data;
+                /* Ignore leading signs and leading zeros */
+                while (*tmp_str!='\0' && (*tmp_str=='-' || *tmp_str=='0')) /* check for '+' too? Not seen one before */
+                {
+                    tmp_str++;
+                }
+                parameter[i]->precision = (int)strlen(tmp_str);
+                decimal = strstr(parameter[i]->data,".");
+                if (!decimal)
+                    decimal = strstr(parameter[i]->data, ",");
+                if (decimal)
+                {
+                    decimal++;
+                    parameter[i]->precision--; /* do not count decimal seperator as part of precision */
+                }
+                if (decimal)
+                    parameter[i]->scale = (int)strlen(decimal);
+                else
+                     parameter[i]->scale = 0;
+            }
+        } 
+        else if (kind == IIDBI_PARAM_STREAM)
+        {
+            /* read and sent segment by segment during the execute */
+            dbi_resetParameter(parameter[i]);
+            parameter[i]->putStream = IIDBI_putSourceNew(elem);
+            if (!parameter[i]->putStream)
+            {
+                exception = IIDBI_InterfaceError;
+                errMsg = "Unable to allocate LOB parameter stream";
+                result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+                goto errorExit;
+            }
+            parameter[i]->type = SQL_LONGVARBINARY;
+            parameter[i]->cType = SQL_C_BINARY;
+            parameter[i]->orInd = SQL_DATA_AT_EXEC;
+            parameter[i]->data = NULL;
+            parameter[i]->precision = 0;
+            parameter[i]->scale = 0;
+            parameter[i]->isNull = 0;
+        }
+        else 
+        {
+            Py_XDECREF(params);
+            exception = IIDBI_InternalError;
+            errMsg = "unknown python parameter type";
+            result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+            goto errorExit;
+        }
+        Py_DECREF(elem);
+        DBPRINTF(DBI_TRC_STAT)("For bind %d, type is %d (cType is %d), precision is %d, scale is %d internal size is %d and nullable is %d\n", i, parameter[i]->type, parameter[i]->cType, parameter[i]->precision, parameter[i]->scale, parameter[i]->internalSize, parameter[i]->isNull);
+    } /* for (i = 0; i < parmCount; i++) */
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_sendParameters }}}1\n", self);
+    return DBI_SQL_SUCCESS;
+
+errorExit:
+    Py_XDECREF(elem);
+    DBPRINTF(DBI_TRC_STAT)("%p: IIDBI_sendParameters errorExit\n", self);
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_sendParameters }}}1\n", self);
+    if (result)
+        return DBI_SQL_SUCCESS_WITH_INFO;
+    else
+        return DBI_SQL_ERROR;
+}
+
+/*{
+** Name: IIDBI_paramKind
+**
+** Description:
+**     Find how IIDBI_sendParameters() binds a value.
+**
+** Inputs:
+**     elem - parameter value.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     IIDBI_PARAM_xxx, IIDBI_PARAM_UNKNOWN if the value cannot be bound.
+**
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created from IIDBI_sendParameters().
+}*/
+
+static int IIDBI_paramKind(PyObject *elem)
+{
+    int isDecimal;
+
+    if (PyInt_Check(elem))
+        return IIDBI_PARAM_INT;
+    if (PyLong_Check(elem))
+        return IIDBI_PARAM_LONG;
+    if (PyFloat_Check(elem))
+        return IIDBI_PARAM_FLOAT;
+    if (PyString_Check(elem))
+        return IIDBI_PARAM_STRING;
+    if (PyUnicode_Check(elem))
+        return IIDBI_PARAM_UNICODE;
+    if (PyBuffer_Check(elem))
+        return IIDBI_PARAM_BUFFER;
+    if (elem == Py_None)
+        return IIDBI_PARAM_NONE;
+    if (PyDateTime_Check(elem))
+        return IIDBI_PARAM_DATETIME;
+    if (PyDate_Check(elem))
+        return IIDBI_PARAM_DATE;
+    if (PyTime_Check(elem))
+        return IIDBI_PARAM_TIME;
+    isDecimal = PyObject_IsInstance(elem, decimalType);
+    if (isDecimal == 1)
+        return IIDBI_PARAM_DECIMAL;
+    if (isDecimal == -1)
+        PyErr_Clear();
+    if (PyObject_HasAttrString(elem, "read") || PyIter_Check(elem))
+        return IIDBI_PARAM_STREAM;
+    return IIDBI_PARAM_UNKNOWN;
+}
+
+/*{
+** Name: IIDBI_paramKindCache
+**
+** Description:
+**     Remember the type and kind of the value at a parameter position,
+**     for IIDBI_sendParameters() to skip the type checks of values of
+**     the same type.  Only kinds decided by the type alone are cached.
+**
+** Inputs:
+**     self - cursor object.
+**     i - parameter position.
+**     parmCount - number of parameters.
+**     elem - parameter value.
+**     kind - IIDBI_paramKind() of elem.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None.
+**
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     Holds a reference to the type until replaced or released by
+**     IIDBI_paramKindRelease(). Nothing is cached if memory runs out.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static void IIDBI_paramKindCache(IIDBI_CURSOR *self, int i, int parmCount,
+    PyObject *elem, int kind)
+{
+    PyObject **types;
+    unsigned char *kinds;
+
+    if (parmCount > self->paramKindCount)
+    {
+        types = realloc(self->paramTypes, parmCount * sizeof(PyObject *));
+        if (!types)
+            return;
+        self->paramTypes = types;
+        kinds = realloc(self->paramKinds, parmCount);
+        if (!kinds)
+            return;
+        self->paramKinds = kinds;
+        memset(types + self->paramKindCount, 0, 
+            (parmCount - self->paramKindCount) * sizeof(PyObject *));
+        self->paramKindCount = parmCount;
+    }
+    Py_XDECREF(self->paramTypes[i]);
+    self->paramTypes[i] = (PyObject *)Py_TYPE(elem);
+    Py_INCREF(self->paramTypes[i]);
+    self->paramKinds[i] = (unsigned char)kind;
+}
+
+/*{
+** Name: IIDBI_paramKindRelease
+**
+** Description:
+**     Release the parameter kinds cached by IIDBI_paramKindCache().
+**
+** Inputs:
+**     self - cursor object.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None.
+**
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static void IIDBI_paramKindRelease(IIDBI_CURSOR *self)
+{
+    int i;
+
+    for (i = 0; i < self->paramKindCount; i++)
+        Py_XDECREF(self->paramTypes[i]);
+    free(self->paramTypes);
+    free(self->paramKinds);
+    self->paramTypes = NULL;
+    self->paramKinds = NULL;
+    self->paramKindCount = 0;
+}
+
+/*{
+** Name: IIDBI_unicodeToWide
+**
+** Description:
+**     Copy a unicode string into SQLWCHARs. Where Py_UNICODE is wider
+**     than SQLWCHAR, characters outside the BMP become UTF-16 surrogate
+**     pairs; where it is narrower, surrogate pairs are combined.
+**
+** Inputs:
+**     src - characters of the unicode string.
+**     len - number of characters.
+**
+** Outputs:
+**     dst - at least IIDBI_WIDE_UNITS(len) SQLWCHARs.
+**
+** Returns:
+**     Number of SQLWCHARs written.
+**
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static Py_ssize_t IIDBI_unicodeToWide(Py_UNICODE *src, Py_ssize_t len, 
+    SQLWCHAR *dst)
+{
+    SQLWCHAR *p = dst;
+    unsigned long ch;
+    Py_ssize_t i;
+
+    if (sizeof(Py_UNICODE) == sizeof(SQLWCHAR))
+    {
+        memcpy(dst, src, len * sizeof(SQLWCHAR));
+        return len;
+    }
+    for (i = 0; i < len; i++)
+    {
+        ch = (unsigned long)src[i];
+        if (sizeof(Py_UNICODE) > sizeof(SQLWCHAR) && ch > 0xFFFF)
+        {
+            ch -= 0x10000;
+            *p++ = (SQLWCHAR)(0xD800 | (ch >> 10));
+            *p++ = (SQLWCHAR)(0xDC00 | (ch & 0x3FF));
+        }
+        else if (sizeof(Py_UNICODE) < sizeof(SQLWCHAR) && 
+            ch >= 0xD800 && ch < 0xDC00 && i + 1 < len &&
+            src[i + 1] >= 0xDC00 && src[i + 1] < 0xE000)
+        {
+            *p++ = (SQLWCHAR)(0x10000 + ((ch - 0xD800) << 10) + 
+                (src[i + 1] - 0xDC00));
+            i++;
+        }
+        else
+            *p++ = (SQLWCHAR)ch;
+    }
+    return p - dst;
+}
+
+/*{
+** Name: IIDBI_paramWideReserve
+**
+** Description:
+**     Make room in the statement's wide character buffer for another
+**     unicode parameter. The buffer is kept for the next execute, so
+**     it only grows while the parameters get longer. When it moves, the
+**     parameters already transcoded into it are pointed at the new one.
+**
+** Inputs:
+**     IIDBIpstmt - statement control block.
+**     count - parameters already set.
+**     used - SQLWCHARs of the buffer already used.
+**     need - SQLWCHARs needed.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     0 on success, -1 if out of memory.
+**
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static int IIDBI_paramWideReserve(IIDBI_STMT *IIDBIpstmt, int count, 
+    Py_ssize_t used, Py_ssize_t need)
+{
+    SQLWCHAR *old = IIDBIpstmt->wideBuffer;
+    SQLWCHAR *buf;
+    SQLWCHAR *data;
+    Py_ssize_t size = IIDBIpstmt->wideBufferSize;
+    int i;
+
+    if (used + need <= size)
+        return 0;
+    size = size * 2 > used + need ? size * 2 : used + need;
+    buf = malloc((size ? size : 1) * sizeof(SQLWCHAR));
+    if (!buf)
+        return -1;
+    if (used)
+        memcpy(buf, old, used * sizeof(SQLWCHAR));
+    for (i = 0; i < count; i++)
+    {
+        data = IIDBIpstmt->parameter[i]->data;
+        if (IIDBIpstmt->parameter[i]->type == SQL_WVARCHAR && 
+            data >= old && data < old + used)
+            IIDBIpstmt->parameter[i]->data = buf + (data - old);
+    }
+    free(old);
+    IIDBIpstmt->wideBuffer = buf;
+    IIDBIpstmt->wideBufferSize = size;
+    return 0;
+}
+
+/*{
+** Name: IIDBI_releaseParameters
+**
+** Description:
+**     Release the parameters kept by executemany() between rows.
+**
+** Inputs:
+**     IIDBIpstmt - statement control block.
+**     prepareForced - TRUE if executemany() prepared a query that was
+**                     not requested to be prepared.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     None.
+**
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     Frees the parameter descriptor.  If prepareForced is set, the next
+**     execute reverts to direct execution.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static void IIDBI_releaseParameters(IIDBI_STMT *IIDBIpstmt, int prepareForced)
+{
+    IIDBIpstmt->keepParameters = FALSE;
+    if (IIDBIpstmt->parmCount)
+        dbi_freeDescriptor(IIDBIpstmt, 1);
+    if (prepareForced)
+    {
+        IIDBIpstmt->prepareRequested = FALSE;
+        IIDBIpstmt->prepareCompleted = FALSE;
+    }
+}
+
+/*{
+** Name: IIDBI_paramArrayType
+**
+** Description:
+**     Map a Python value to the SQL type used for it in a parameter
+**     array.
+**
+** Inputs:
+**     elem - parameter value, not None.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     The SQL type, or -1 if the value cannot be sent in an array.
+**
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static int IIDBI_paramArrayType(PyObject *elem)
+{
+    int isDecimal;
+
+    if (PyInt_Check(elem))
+        return SQL_INTEGER;
+    if (PyLong_Check(elem))
+        return SQL_BIGINT;
+    if (PyFloat_Check(elem))
+        return SQL_DOUBLE;
+    if (PyString_Check(elem))
+        return SQL_VARCHAR;
+    if (PyUnicode_Check(elem))
+    {
+        /* copied as is, so only when Python and ODBC agree on the width */
+        if (sizeof(Py_UNICODE) == sizeof(SQLWCHAR))
+            return SQL_WVARCHAR;
+        return -1;
+    }
+    if (PyDateTime_Check(elem))
+        return SQL_TYPE_TIMESTAMP;
+    if (PyDate_Check(elem))
+        return SQL_TYPE_DATE;
+    if (PyTime_Check(elem))
+        return SQL_TYPE_TIME;
+    isDecimal = PyObject_IsInstance(elem, decimalType);
+    if (isDecimal == 1)
+        return SQL_DECIMAL;
+    if (isDecimal == -1)
+        PyErr_Clear();
+    return -1;
+}
+
+/*{
+** Name: IIDBI_sendParameterArray
+**
+** Description:
+**     Convert count rows of an executemany() parameter set, starting at
+**     row start, into column-wise parameter arrays so that they are sent
+**     to the DBMS with a single execute.  This is only done when, None
+**     aside, every column holds values of one kind that fit a fixed 
+**     width array element (int and long, float, str, unicode, datetime,
+**     date, time or Decimal). Anything else is left to the row at a time
+**     path, IIDBI_sendParameters().
+**
+** Inputs:
+**     self - cursor object. 
+**     rows - parameter set, as returned by PySequence_Fast().
+**     start - first row to send.
+**     count - number of rows to send.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     DBI_SQL_SUCCESS - the parameter descriptors hold the arrays.
+**     DBI_SQL_NO_DATA - the rows cannot be sent as arrays, no exception
+**         is raised.
+**     DBI_SQL_SUCCESS_WITH_INFO/DBI_SQL_ERROR - as IIDBI_sendParameters().
+**
+** Exceptions:
+**     The parameter arrays must be successfully allocated.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+**     16-Oct-2026 (agent)
+**         Format Decimal values with IIDBI_decimalToChar().
+**     16-Oct-2026 (agent)
+**         Moved the per-value work to IIDBI_paramArrayScan(),
+**         IIDBI_paramArrayDescribe() and IIDBI_paramArrayStore(), shared
+**         with IIDBI_sendColumnArray().
+}*/
+
+int IIDBI_sendParameterArray(IIDBI_CURSOR *self, PyObject *rows, int start,
+    int count)
+{
+    PyObject *exception;
+    char *errMsg;
+    int result = 0;
+    int return_code = DBI_SQL_NO_DATA;
+    int parmCount = 0;
+    int *types = NULL;
+    int *maxLen = NULL;
+    int *maxDigits = NULL;
+    int *maxScale = NULL;
+    int i, j, len;
+    PyObject *row = NULL;
+    PyObject **items;
+    PyObject *elem;
+    IIDBI_STMT *IIDBIpstmt = self->IIDBIpstmt;
+    IIDBI_DESCRIPTOR *desc;
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_sendParameterArray %d %d {{{1\n", self,
+        start, count);
+
+    if (count < 2)
+        goto notSuitable;
+
+    /*
+    ** Pass 1: settle the type and the widest value of each column.
+    */
+    for (j = start; j < start + count; j++)
+    {
+        row = PySequence_Fast(PySequence_Fast_GET_ITEM(rows, j), "");
+        if (!row)
         {
-            result = IIDBI_mapError2exception((PyObject*)self, &IIDBIpstmt->hdr.err, rc, 
-                szProcStr); 
-            goto errorExit;
+            PyErr_Clear();
+            goto notSuitable;
         }
+        len = PySequence_Fast_GET_SIZE(row);
+        if (j == start)
+        {
+            parmCount = len;
+            if (!parmCount)
+                goto notSuitable;
+            types = calloc(parmCount, sizeof(int));
+            maxLen = calloc(parmCount, sizeof(int));
+            maxDigits = calloc(parmCount, sizeof(int));
+            maxScale = calloc(parmCount, sizeof(int));
+            if (!types || !maxLen || !maxDigits || !maxScale)
+                goto notSuitable;
+            for (i = 0; i < parmCount; i++)
+                types[i] = SQL_TYPE_NULL;
+        }
+        else if (len != parmCount)
+            goto notSuitable;
 
-        /*
-        ** Return (possibly modified) parameters back to the caller.   
-        */
-        row = PyTuple_New(IIDBIpstmt->parmCount);
-
-        parameter = IIDBIpstmt->parameter;
+        items = PySequence_Fast_ITEMS(row);
         for (i = 0; i < parmCount; i++)
         {
-            if (parameter[i]->isNull)
-            {
-                Py_INCREF(Py_None);
-                PyTuple_SetItem(row, i, Py_None);
-            }
-            else
-            {
-                switch (parameter[i]->type)
-                {
-                case SQL_BIGINT:
-                    n = *(ODBCINT64 *)parameter[i]->data;
-                    PyTuple_SetItem(row, i, PyLong_FromLongLong(n));
-                    break;
-        
-                case SQL_INTEGER:
-                    j = *(SQLINTEGER *)parameter[i]->data;
-                    m = (long)j;
-                    PyTuple_SetItem(row, i, PyInt_FromLong(m));
-                    break;
-        
-                 case SQL_SMALLINT:
-                    k = *(SQLSMALLINT *)parameter[i]->data;
-                    m = (long)k;
-                    PyTuple_SetItem(row, i, PyInt_FromLong(m));
-                    break;
-        
-                case SQL_TINYINT:
-                    l = *(SQLCHAR *)parameter[i]->data;
-                    m = (long)l;
-                    PyTuple_SetItem(row, i, PyInt_FromLong(m));
-                    break;
-          
-                case SQL_FLOAT:
-                case SQL_REAL:
-                case SQL_DOUBLE:
-                    PyTuple_SetItem(row, i,
-                            PyFloat_FromDouble(*(double *)parameter[i]->data));
-                    break;
-        
-                case SQL_LONGVARCHAR:
-                case SQL_LONGVARBINARY:
-                    PyTuple_SetItem(row, i, (PyObject *)
-                            PyString_FromStringAndSize( parameter[i]->data, 
-                                                        parameter[i]->precision));
-                    break;
-        
-                case SQL_WCHAR:
-                case SQL_WVARCHAR:
-                case SQL_WLONGVARCHAR:
-                    PyTuple_SetItem(row, i, (PyObject *)
-                            PyUnicode_Decode((const char *)parameter[i]->data, 
-                            (int)wcslen(parameter[i]->data)*sizeof(SQLWCHAR),
-                            "utf_16","strict")); /* dbproc FIXME */
-                    break;
-        
-                default:
-                    PyTuple_SetItem(row, i, 
-                            PyString_FromString(parameter[i]->data)); /* dbproc FIXME use PyString_FromStringAndSize */
-                    break;
-                }
-            }
-        } /* for (i = 0; i < parmCount; i++) */
-    }  /* if (params) */
-    else
+            elem = items[i];
+            if (elem == Py_None)
+                continue;
+            if (!IIDBI_paramArrayScan(elem, &types[i], &maxLen[i],
+                &maxDigits[i], &maxScale[i]))
+                goto notSuitable;
+        }
+        Py_DECREF(row);
+        row = NULL;
+    }
+
+    /*
+    ** Pass 2: allocate the arrays and copy the values in.
+    */
+    if (IIDBIpstmt->parmCount)
+        dbi_freeDescriptor(IIDBIpstmt, 1);
+    if (dbi_allocDescriptor(IIDBIpstmt, parmCount, 1) != DBI_SQL_SUCCESS)
     {
-        strcat(szProcStr, " ) }");
+        exception = IIDBI_OperationalError;
+        errMsg = "could not allocate descriptor";
+        goto errorExit;
+    }
+    IIDBIpstmt->paramsetSize = count;
 
-        Py_BEGIN_ALLOW_THREADS
-        rc = dbi_cursorExecute( IIDBIpdbc, IIDBIpstmt, szProcStr, TRUE);
-        Py_END_ALLOW_THREADS
-        if (rc != DBI_SQL_SUCCESS)
+    for (i = 0; i < parmCount; i++)
+    {
+        desc = IIDBIpstmt->parameter[i];
+        IIDBI_paramArrayDescribe(desc, types[i], maxLen[i], maxDigits[i],
+            maxScale[i]);
+        desc->rowsetData = calloc(count, desc->bindSize);
+        desc->rowsetInd = calloc(count, sizeof(SQLLEN));
+        if (!desc->rowsetData || !desc->rowsetInd)
         {
-            result = IIDBI_mapError2exception((PyObject*)self, &IIDBIpstmt->hdr.err, 
-                rc, szProcStr);
+            exception = IIDBI_OperationalError;
+            errMsg = "could not allocate parameter arrays";
             goto errorExit;
         }
     }
-    self->rowcount = IIDBIpstmt->rowCount;
 
-    if (IIDBIpstmt->hasResultSet)
+    for (j = 0; j < count; j++)
     {
-        IIDBI_DESCRIPTOR *descriptor;
-        PyObject *descRow = NULL;
-        int type = -1;
-
-        self->description = PyList_New(0);
-        rc = dbi_allocDescriptor(IIDBIpstmt, IIDBIpstmt->descCount, 0);
-        if (rc != DBI_SQL_SUCCESS)
+        row = PySequence_Fast(PySequence_Fast_GET_ITEM(rows, start + j), "");
+        if (!row)
         {
-            exception = IIDBI_OperationalError; 
-            errMsg = "Could not allocate descriptor";
-            result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+            exception = IIDBI_InternalError;
+            errMsg = "failed to retrieve input parameter sequence";
             goto errorExit;
         }
-        Py_BEGIN_ALLOW_THREADS
-        rc = dbi_describeColumns(IIDBIpstmt);
-        Py_END_ALLOW_THREADS
-        if (rc != DBI_SQL_SUCCESS)
+        items = PySequence_Fast_ITEMS(row);
+        for (i = 0; i < parmCount; i++)
         {
-            exception = IIDBI_OperationalError;
-            errMsg = "Could not describe columns";
-            result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-            goto errorExit;
+            if (!IIDBI_paramArrayStore(IIDBIpstmt->parameter[i], j, items[i]))
+            {
+                exception = IIDBI_InternalError;
+                errMsg = "could not convert Decimal parameter";
+                goto errorExit;
+            }
         }
-        if (rc != DBI_SQL_SUCCESS)
+        Py_DECREF(row);
+        row = NULL;
+    }
+    return_code = DBI_SQL_SUCCESS;
+
+notSuitable:
+    Py_XDECREF(row);
+    free(types);
+    free(maxLen);
+    free(maxDigits);
+    free(maxScale);
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_sendParameterArray %s }}}1\n", self,
+        return_code == DBI_SQL_SUCCESS ? "arrays" : "not suitable");
+    return return_code;
+
+errorExit:
+    Py_XDECREF(row);
+    free(types);
+    free(maxLen);
+    free(maxDigits);
+    free(maxScale);
+    dbi_freeDescriptor(IIDBIpstmt, 1);
+    result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_sendParameterArray }}}1\n", self);
+    if (result)
+        return DBI_SQL_SUCCESS_WITH_INFO;
+    else
+        return DBI_SQL_ERROR;
+}
+
+/*{
+** Name: IIDBI_paramArrayScan
+**
+** Description:
+**     Fold a value into the SQL type and the widest value of its
+**     parameter array column.
+**
+** Inputs:
+**     elem - parameter value, not None.
+**     type - SQL type of the column so far, SQL_TYPE_NULL if none.
+**     maxLen - longest string or Decimal so far.
+**     maxDigits - most integral Decimal digits so far.
+**     maxScale - largest Decimal scale so far.
+**
+** Outputs:
+**     type, maxLen, maxDigits, maxScale - updated for elem.
+**
+** Returns:
+**     TRUE, or FALSE if the column cannot be sent as an array.
+**
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created from IIDBI_sendParameterArray().
+}*/
+
+static int IIDBI_paramArrayScan(PyObject *elem, int *type, int *maxLen,
+    int *maxDigits, int *maxScale)
+{
+    int elemType, len, digits, scale;
+    long lval;
+    char *tmp_str, *decimal;
+    char decimalStr[IIDBI_DECIMAL_STRING_SIZE];
+    PyObject *str;
+
+    elemType = IIDBI_paramArrayType(elem);
+    switch (elemType)
+    {
+    case SQL_INTEGER:
+        lval = PyInt_AS_LONG(elem);
+        if (lval > 2147483647L || lval < -2147483647L - 1)
+            elemType = SQL_BIGINT;
+        break;
+
+    case SQL_BIGINT:
+        if (PyLong_Check(elem))
         {
-            exception = IIDBI_OperationalError;
-            errMsg = "Could not allocate data";
-            result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-            goto errorExit;
+            PyLong_AsLongLong(elem);
+            if (PyErr_Occurred())
+            {
+                PyErr_Clear();
+                return FALSE;
+            }
         }
-        for (i = 0; i < IIDBIpstmt->descCount; i++)
-        {
-            descriptor = IIDBIpstmt->descriptor[i];
-            descRow = PyTuple_New(7);
+        break;
 
-            rc = PyTuple_SetItem( descRow, 0, 
-                PyString_FromString(descriptor->columnName));
-            type = IIDBI_mapType(descriptor->type);
-            if (type == DBI_UNKNOWN_TYPE)
+    case SQL_VARCHAR:
+        len = (int)PyString_GET_SIZE(elem);
+        if (len > *maxLen)
+            *maxLen = len;
+        break;
+
+    case SQL_WVARCHAR:
+        len = (int)PyUnicode_GET_SIZE(elem);
+        if (len > *maxLen)
+            *maxLen = len;
+        break;
+
+    case SQL_DECIMAL:
+        len = IIDBI_decimalToChar(elem, decimalStr, sizeof(decimalStr), 
+            &digits, &scale);
+        if (len >= 0)
+            digits -= scale;
+        else
+        {
+            str = PyObject_Str(elem);
+            if (!str)
             {
-                exception = IIDBI_OperationalError; 
-                errMsg = "Invalid data type";
-                result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-                goto errorExit;
+                PyErr_Clear();
+                return FALSE;
             }
-            rc = PyTuple_SetItem( descRow, 1, PyInt_FromLong((long)type));
-            rc = PyTuple_SetItem( descRow, 2, Py_None); Py_INCREF(Py_None);
-            rc = PyTuple_SetItem( descRow, 3, Py_None); Py_INCREF(Py_None);
-            rc = PyTuple_SetItem( descRow, 4, Py_None); Py_INCREF(Py_None);
-            rc = PyTuple_SetItem( descRow, 5, Py_None); Py_INCREF(Py_None);
-            rc = PyTuple_SetItem( descRow, 6, 
-                PyInt_FromLong((long)descriptor->nullable));
+            tmp_str = PyString_AS_STRING(str);
+            if (strchr(tmp_str, 'E') || strchr(tmp_str, 'e') ||
+                !isdigit((unsigned char)tmp_str[strlen(tmp_str) - 1]))
+            {
+                /* exponent, NaN or Infinity */
+                Py_DECREF(str);
+                return FALSE;
+            }
+            len = (int)strlen(tmp_str);
+            /* Ignore leading signs and leading zeros */
+            while (*tmp_str == '-' || *tmp_str == '0')
+                tmp_str++;
+            decimal = strchr(tmp_str, '.');
+            if (!decimal)
+                decimal = strchr(tmp_str, ',');
+            scale = decimal ? (int)strlen(decimal + 1) : 0;
+            digits = (int)strlen(tmp_str) - scale - (decimal ? 1 : 0);
+            Py_DECREF(str);
+        }
+        if (len > *maxLen)
+            *maxLen = len;
+        if (digits > *maxDigits)
+            *maxDigits = digits;
+        if (scale > *maxScale)
+            *maxScale = scale;
+        break;
+
+    case -1:
+        return FALSE;
+
+    default:
+        break;
+    }
+
+    if (*type == SQL_TYPE_NULL)
+        *type = elemType;
+    else if (*type != elemType)
+    {
+        if ((*type == SQL_INTEGER || *type == SQL_BIGINT) &&
+            (elemType == SQL_INTEGER || elemType == SQL_BIGINT))
+            *type = SQL_BIGINT;
+        else
+            return FALSE;
+    }
+    return TRUE;
+}
+
+/*{
+** Name: IIDBI_paramArrayDescribe
+**
+** Description:
+**     Set the C type, SQL type and element size of a parameter array
+**     from the results of IIDBI_paramArrayScan().
+**
+** Inputs:
+**     desc - parameter descriptor.
+**     type - SQL type of the column, SQL_TYPE_NULL if every value is None.
+**     maxLen - longest string or Decimal.
+**     maxDigits - most integral Decimal digits.
+**     maxScale - largest Decimal scale.
+**
+** Outputs:
+**     desc - type, cType, precision, scale and bindSize set.
+**
+** Returns:
+**     None.
+**
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created from IIDBI_sendParameterArray().
+}*/
+
+static void IIDBI_paramArrayDescribe(IIDBI_DESCRIPTOR *desc, int type, 
+    int maxLen, int maxDigits, int maxScale)
+{
+    desc->type = type;
+    desc->precision = 0;
+    desc->scale = 0;
+    switch (type)
+    {
+    case SQL_INTEGER:
+        desc->cType = SQL_C_LONG;
+        desc->bindSize = sizeof(SQLINTEGER);
+        break;
+
+    case SQL_BIGINT:
+        desc->cType = SQL_C_SBIGINT;
+        desc->bindSize = sizeof(ODBCINT64);
+        break;
+
+    case SQL_DOUBLE:
+        desc->cType = SQL_C_DOUBLE;
+        desc->bindSize = sizeof(double);
+        desc->precision = 8;
+        break;
+
+    case SQL_VARCHAR:
+        desc->cType = SQL_C_CHAR;
+        desc->precision = maxLen ? maxLen : 1;
+        desc->bindSize = desc->precision;
+        break;
+
+    case SQL_WVARCHAR:
+        desc->cType = SQL_C_WCHAR;
+        desc->precision = maxLen ? maxLen : 1;
+        desc->bindSize = desc->precision * sizeof(SQLWCHAR);
+        break;
+
+    case SQL_TYPE_TIMESTAMP:
+        desc->cType = SQL_C_TYPE_TIMESTAMP;
+        desc->bindSize = sizeof(SQL_TIMESTAMP_STRUCT);
+        break;
 
-            rc = PyList_Append( self->description, descRow);
-            Py_XDECREF(descRow);
-        }
-    }
-    else
-    {
-        self->description = Py_None;
-        Py_INCREF(self->description);
-    }
+    case SQL_TYPE_DATE:
+        desc->cType = SQL_C_TYPE_DATE;
+        desc->bindSize = sizeof(SQL_DATE_STRUCT);
+        break;
 
-    dbi_freeData(IIDBIpstmt);   
+    case SQL_TYPE_TIME:
+        desc->cType = SQL_C_TYPE_TIME;
+        desc->bindSize = sizeof(SQL_TIME_STRUCT);
+        break;
 
-    if (!parmCount)
-    {
-        Py_INCREF(Py_None);
-        row = Py_None;
+    case SQL_DECIMAL:
+        desc->cType = SQL_C_CHAR;
+        desc->precision = maxDigits + maxScale;
+        if (!desc->precision)
+            desc->precision = 1;
+        desc->scale = maxScale;
+        desc->bindSize = maxLen + 1; /* +1 for NULL terminator */
+        break;
+
+    default: /* every value is None */
+        desc->cType = SQL_C_CHAR; 
+        desc->bindSize = 1;
+        break;
     }
-    else
-        dbi_freeDescriptor(IIDBIpstmt, 1);
+}
 
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorCallProc }}}1\n", self);
-    return row;
+/*{
+** Name: IIDBI_paramArrayStore
+**
+** Description:
+**     Copy a value into row j of a parameter array described by
+**     IIDBI_paramArrayDescribe().
+**
+** Inputs:
+**     desc - parameter descriptor with its arrays allocated.
+**     j - row of the array.
+**     elem - parameter value, None for NULL.
+**
+** Outputs:
+**     desc - the value and its length/indicator stored.
+**
+** Returns:
+**     TRUE, or FALSE if a Decimal could not be converted.
+**
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created from IIDBI_sendParameterArray().
+}*/
 
-errorExit:
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorCallProc }}}1\n", self);
-    dbi_freeData(IIDBIpstmt);
-    if (result)
+static int IIDBI_paramArrayStore(IIDBI_DESCRIPTOR *desc, int j, 
+    PyObject *elem)
+{
+    SQLLEN *ind = &desc->rowsetInd[j];
+    char *buf = (char *)desc->rowsetData + j * desc->bindSize;
+    SQL_TIMESTAMP_STRUCT *ts;
+    SQL_DATE_STRUCT *date;
+    SQL_TIME_STRUCT *tm;
+    PyObject *str;
+    int len, digits, scale;
+
+    if (elem == Py_None)
     {
-        Py_INCREF(Py_None);
-        return Py_None;
+        *ind = SQL_NULL_DATA;
+        return TRUE;
     }
-    return NULL;
+    *ind = 0;
+    switch (desc->type)
+    {
+    case SQL_INTEGER:
+        *(SQLINTEGER *)buf = (SQLINTEGER)PyInt_AS_LONG(elem);
+        break;
+
+    case SQL_BIGINT:
+        if (PyInt_Check(elem))
+            *(ODBCINT64 *)buf = PyInt_AS_LONG(elem);
+        else
+            *(ODBCINT64 *)buf = PyLong_AsLongLong(elem);
+        break;
+
+    case SQL_DOUBLE:
+        *(double *)buf = PyFloat_AS_DOUBLE(elem);
+        break;
 
+    case SQL_VARCHAR:
+        len = (int)PyString_GET_SIZE(elem);
+        memcpy(buf, PyString_AS_STRING(elem), len);
+        *ind = len;
+        break;
+
+    case SQL_WVARCHAR:
+        len = (int)PyUnicode_GET_SIZE(elem) * sizeof(SQLWCHAR);
+        memcpy(buf, PyUnicode_AS_UNICODE(elem), len);
+        *ind = len;
+        break;
+
+    case SQL_TYPE_TIMESTAMP:
+        ts = (SQL_TIMESTAMP_STRUCT *)buf;
+        ts->year = PyDateTime_GET_YEAR(elem);
+        ts->month = PyDateTime_GET_MONTH(elem);
+        ts->day = PyDateTime_GET_DAY(elem);
+        ts->hour = PyDateTime_DATE_GET_HOUR(elem);
+        ts->minute = PyDateTime_DATE_GET_MINUTE(elem);
+        ts->second = PyDateTime_DATE_GET_SECOND(elem);
+        ts->fraction = 0;
+        break;
+
+    case SQL_TYPE_DATE:
+        date = (SQL_DATE_STRUCT *)buf;
+        date->year = PyDateTime_GET_YEAR(elem);
+        date->month = PyDateTime_GET_MONTH(elem);
+        date->day = PyDateTime_GET_DAY(elem);
+        break;
+
+    case SQL_TYPE_TIME:
+        tm = (SQL_TIME_STRUCT *)buf;
+        tm->hour = PyDateTime_TIME_GET_HOUR(elem);
+        tm->minute = PyDateTime_TIME_GET_MINUTE(elem);
+        tm->second = PyDateTime_TIME_GET_SECOND(elem);
+        break;
+
+    case SQL_DECIMAL:
+        *ind = SQL_NTS;
+        if (IIDBI_decimalToChar(elem, buf, (int)desc->bindSize, 
+            &digits, &scale) >= 0)
+            break;
+        str = PyObject_Str(elem);
+        if (!str)
+        {
+            PyErr_Clear();
+            return FALSE;
+        }
+        strncpy(buf, PyString_AS_STRING(str), desc->bindSize - 1);
+        Py_DECREF(str);
+        break;
+    }
+    return TRUE;
 }
 
 /*{
-** Name: IIDBI_cursorFetch
+** Name: IIDBI_sendColumnArray
 **
 ** Description:
-**     Fetch one row from the DBMS.
+**     Bind count rows of an executecolumns() parameter set, starting at
+**     row start, as parameter arrays.  Numeric buffer columns are bound
+**     in place, or copied a batch at a time when only reachable through
+**     the old buffer interface (see IIDBI_PARAMCOLUMN); sequence columns
+**     are converted as by IIDBI_sendParameterArray().
 **
 ** Inputs:
-**     self - cursor object.
+**     self - cursor object. 
+**     columns - parameter columns, from IIDBI_paramColumnInit().
+**     parmCount - number of columns.
+**     start - first row to send.
+**     count - number of rows to send.
 **
 ** Outputs:
 **     None.
 **
 ** Returns:
-**     A tuple containing the data.
-**     
+**     DBI_SQL_SUCCESS - the parameter descriptors hold the arrays.
+**     DBI_SQL_NO_DATA - the rows cannot be sent as arrays, no exception
+**         is raised.
+**     DBI_SQL_SUCCESS_WITH_INFO/DBI_SQL_ERROR - as IIDBI_sendParameters().
+**
 ** Exceptions:
-**     The cursor must be open. The ODBC statement handle must be non-null.
-**     The cursor object must have a valid descriptor and descriptor count.
-**     The fetch must succeed.
-**         
+**     The parameter arrays must be successfully allocated.  The columns
+**     must not have been shortened.
+**
 ** Side Effects:
-**     cursor->rowcount is incremented.
+**     None.
 **
 ** History:
-**     26-May-06 Ralph.Loen@ingres.com
+**     16-Oct-2026 (agent)
 **         Created.
-**     09-Dec-10 Grant.Croker@ingres.com
-**         Trac Ticket 161 - Provide a more descriptive error message when a
-**         fetch is performed against non-SELECT query.
 }*/
 
-static PyObject *IIDBI_cursorFetch(IIDBI_CURSOR *self)
+int IIDBI_sendColumnArray(IIDBI_CURSOR *self, IIDBI_PARAMCOLUMN *columns,
+    int parmCount, int start, int count)
 {
-    IIDBI_STMT *IIDBIpstmt = NULL;
-    RETCODE rc;
-    int i;
-    SQLINTEGER j;
-    SQLSMALLINT k;
-    SQLCHAR l;
-    long m;
-    SQLBIGINT n;
-    PyObject *row = NULL;
-    IIDBI_DESCRIPTOR **descriptor = NULL;
-    SQL_TIMESTAMP_STRUCT *ts = NULL;
     PyObject *exception;
     char *errMsg;
-    int result = FALSE;
-    IIDBI_CONNECTION *connection;
-
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorFetch {{{1\n", self);
-
-    connection = self->connection;
-    /* Py_INCREF(connection); we don't intend to use this and we have the GIL so no need to increment */
-    if (connection == (IIDBI_CONNECTION *)Py_None)
-    {
-        exception = IIDBI_InternalError; 
-        errMsg = "Invalid connection object";
-        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-        goto errorExit;
-    }
-    else
+    int result = 0;
+    int return_code = DBI_SQL_NO_DATA;
+    int *types = NULL;
+    int *maxLen = NULL;
+    int *maxDigits = NULL;
+    int *maxScale = NULL;
+    int i, j, row;
+    char *data;
+    PyObject **items;
+    IIDBI_STMT *IIDBIpstmt = self->IIDBIpstmt;
+    IIDBI_PARAMCOLUMN *column;
+    IIDBI_DESCRIPTOR *desc;
+
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_sendColumnArray %d %d {{{1\n", self,
+        start, count);
+
+    if (count < 2)
+        goto notSuitable;
+
+    types = calloc(parmCount, sizeof(int));
+    maxLen = calloc(parmCount, sizeof(int));
+    maxDigits = calloc(parmCount, sizeof(int));
+    maxScale = calloc(parmCount, sizeof(int));
+    if (!types || !maxLen || !maxDigits || !maxScale)
+        goto notSuitable;
+
+    /*
+    ** Pass 1: settle the type and the widest value of each sequence
+    ** column.
+    */
+    for (i = 0; i < parmCount; i++)
     {
-        if (connection->closed && !self->closed)
+        column = &columns[i];
+        if (!IIDBI_paramColumnCheck(column, start + count, &data))
         {
-            IIDBI_cursorClose(self); /* FIXME check return and exceptions...*/
+            exception = IIDBI_InterfaceError;
+            errMsg = "parameter column changed size";
+            goto errorExit;
+        }
+        types[i] = SQL_TYPE_NULL;
+        if (!column->items)
+            continue;
+        items = PySequence_Fast_ITEMS(column->items) + start;
+        for (j = 0; j < count; j++)
+        {
+            if (items[j] == Py_None)
+                continue;
+            if (!IIDBI_paramArrayScan(items[j], &types[i], &maxLen[i],
+                &maxDigits[i], &maxScale[i]))
+                goto notSuitable;
         }
     }
 
-    if (self->closed)
-    {
-        exception = IIDBI_InterfaceError; 
-        errMsg = "cursor is already closed";
-        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-        goto errorExit;
-    }
-    if (!self->IIDBIpstmt)
-    {
-        self->rowcount = -1;
-        Py_DECREF(self->rownumber);
-        exception = IIDBI_InternalError;
-        errMsg = "Invalid DBI statement handle";
-        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-        goto errorExit;
-    }
-    else
-        IIDBIpstmt = self->IIDBIpstmt;
-
-    if (!IIDBIpstmt->descCount)
-    {
-        self->rowcount = -1;
-        exception = IIDBI_DataError;
-        errMsg = "No results are available";
-        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-        goto errorExit;
-    }
-
-    
-    if (!IIDBIpstmt->descriptor)
+    /*
+    ** Pass 2: bind the buffers and fill the arrays of the sequences.
+    */
+    if (IIDBIpstmt->parmCount)
+        dbi_freeDescriptor(IIDBIpstmt, 1);
+    if (dbi_allocDescriptor(IIDBIpstmt, parmCount, 1) != DBI_SQL_SUCCESS)
     {
-        self->rowcount = -1;
-        exception = IIDBI_InterfaceError;
-        errMsg = "Missing tuple descriptor";
-        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+        exception = IIDBI_OperationalError;
+        errMsg = "could not allocate descriptor";
         goto errorExit;
     }
-    else
-        descriptor = IIDBIpstmt->descriptor;
-
-    dbi_allocData(IIDBIpstmt);
-    Py_BEGIN_ALLOW_THREADS
-    rc = dbi_cursorFetchone(IIDBIpstmt);
-    Py_END_ALLOW_THREADS
-    if (rc == DBI_SQL_NO_DATA)
-    {
-        Py_XDECREF(row);
-        row = Py_None;
-        Py_INCREF(row);
+    IIDBIpstmt->paramsetSize = count;
 
-        goto exitLabel;
-    }
-    else if (rc != DBI_SQL_SUCCESS)
+    for (i = 0; i < parmCount; i++)
     {
-        Py_XDECREF(row);
-        self->rowcount = -1;
-        Py_DECREF(self->rownumber);
-        self->rownumber = Py_None;
-        Py_INCREF(self->rownumber);
-        self->rowindex = 0;
-        dbi_freeDescriptor(IIDBIpstmt, 0);
-        result = IIDBI_mapError2exception((PyObject *)self, &IIDBIpstmt->hdr.err, 
-            rc, NULL); 
-        goto errorExit;
-    }
+        column = &columns[i];
+        desc = IIDBIpstmt->parameter[i];
+        desc->rowsetInd = calloc(count, sizeof(SQLLEN));
+        if (!desc->rowsetInd)
+        {
+            exception = IIDBI_OperationalError;
+            errMsg = "could not allocate parameter arrays";
+            goto errorExit;
+        }
 
-    self->rowcount = IIDBIpstmt->rowCount;
-    row = PyTuple_New(IIDBIpstmt->descCount);
+        if (column->items)
+        {
+            IIDBI_paramArrayDescribe(desc, types[i], maxLen[i], 
+                maxDigits[i], maxScale[i]);
+            desc->rowsetData = calloc(count, desc->bindSize);
+            if (!desc->rowsetData)
+            {
+                exception = IIDBI_OperationalError;
+                errMsg = "could not allocate parameter arrays";
+                goto errorExit;
+            }
+            items = PySequence_Fast_ITEMS(column->items) + start;
+            for (j = 0; j < count; j++)
+            {
+                if (!IIDBI_paramArrayStore(desc, j, items[j]))
+                {
+                    exception = IIDBI_InternalError;
+                    errMsg = "could not convert Decimal parameter";
+                    goto errorExit;
+                }
+            }
+            continue;
+        }
 
-    for (i = 0; i < IIDBIpstmt->descCount; i++)
-    {
-        if (descriptor[i]->isNull)
+        IIDBI_paramColumnCheck(column, start + count, &data);
+        data += start * column->itemSize;
+        desc->type = column->type;
+        desc->cType = column->cType;
+        desc->precision = (column->type == SQL_REAL || 
+            column->type == SQL_DOUBLE) ? (int)column->itemSize : 0;
+        desc->scale = 0;
+        desc->bindSize = column->itemSize;
+        if (column->copy)
         {
-            Py_INCREF(Py_None);
-            PyTuple_SetItem(row, i, Py_None);
+            desc->rowsetData = malloc(count * column->itemSize);
+            if (!desc->rowsetData)
+            {
+                exception = IIDBI_OperationalError;
+                errMsg = "could not allocate parameter arrays";
+                goto errorExit;
+            }
+            memcpy(desc->rowsetData, data, count * column->itemSize);
         }
         else
         {
-            switch (descriptor[i]->type)
-            {
-            case SQL_BIGINT:
-                n = *(ODBCINT64 *)descriptor[i]->data;
-                PyTuple_SetItem(row, i, PyLong_FromLongLong(n));
-                break;
-
-            case SQL_INTEGER:
-                j = *(SQLINTEGER *)descriptor[i]->data;
-                m = (long)j;
-                PyTuple_SetItem(row, i, PyInt_FromLong(m));
-                break;
+            desc->rowsetData = data;
+            desc->rowsetBorrowed = TRUE;
+        }
+        for (j = 0; column->nulls && j < count; j++)
+        {
+            row = start + j;
+            if (column->nulls[row / 8] & (1 << (row % 8)))
+                desc->rowsetInd[j] = SQL_NULL_DATA;
+        }
+    }
+    return_code = DBI_SQL_SUCCESS;
 
-             case SQL_SMALLINT:
-                k = *(SQLSMALLINT *)descriptor[i]->data;
-                m = (long)k;
-                PyTuple_SetItem(row, i, PyInt_FromLong(m));
-                break;
+notSuitable:
+    free(types);
+    free(maxLen);
+    free(maxDigits);
+    free(maxScale);
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_sendColumnArray %s }}}1\n", self,
+        return_code == DBI_SQL_SUCCESS ? "arrays" : "not suitable");
+    return return_code;
 
-            case SQL_TINYINT:
-                l = *(SQLCHAR *)descriptor[i]->data;
-                m = (long)l;
-                PyTuple_SetItem(row, i, PyInt_FromLong(m));
-                break;
-      
-            case SQL_FLOAT:
-            case SQL_REAL:
-            case SQL_DOUBLE:
-                PyTuple_SetItem(row, i,
-                        PyFloat_FromDouble(*(double *)descriptor[i]->data));
-                break;
+errorExit:
+    free(types);
+    free(maxLen);
+    free(maxDigits);
+    free(maxScale);
+    dbi_freeDescriptor(IIDBIpstmt, 1);
+    result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_sendColumnArray }}}1\n", self);
+    if (result)
+        return DBI_SQL_SUCCESS_WITH_INFO;
+    else
+        return DBI_SQL_ERROR;
+}
 
-            case SQL_TYPE_TIME:
-            case SQL_TYPE_TIMESTAMP:
-            case SQL_TYPE_DATE:
-            case SQL_DATE:
-            case SQL_TIME:
-            case SQL_TIMESTAMP:
-            {
-                  ts = (SQL_TIMESTAMP_STRUCT *)descriptor[i]->data;
+/*{
+** Name: IIDBI_paramBufferType
+**
+** Description:
+**     Map the struct module format and item size of a buffer to the
+**     ODBC C and SQL types binding its values as they are.
+**
+** Inputs:
+**     format - format of a value, e.g. "l" or "=d", or an array typecode.
+**     itemSize - bytes per value.
+**
+** Outputs:
+**     cType - ODBC C type.
+**     type - SQL type.
+**
+** Returns:
+**     TRUE, or FALSE if the values cannot be bound as they are.
+**
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
 
-                  PyTuple_SetItem(row, i,
-                      (PyObject *)PyDateTime_FromDateAndTime( ts->year,
-                      ts->month, ts->day, ts->hour, ts->minute, ts->second,
-                      ts->fraction));
-                break;
-            }
-            case SQL_LONGVARCHAR:
-            case SQL_LONGVARBINARY:
-                    PyTuple_SetItem(row, i, (PyObject *)
-                        PyString_FromStringAndSize( descriptor[i]->data, 
-                                                    descriptor[i]->precision));
-                break;
+static int IIDBI_paramBufferType(char *format, Py_ssize_t itemSize, 
+    int *cType, int *type)
+{
+    if (!format)
+        return FALSE;
+    if (*format == '@' || *format == '=')
+        format++;
+    if (!format[0] || format[1])
+        return FALSE;
 
-            case SQL_WCHAR:
-            case SQL_WVARCHAR:
-            case SQL_WLONGVARCHAR:
-                      PyTuple_SetItem(row, i, (PyObject *)
-                        PyUnicode_FromWideChar( (const wchar_t *)descriptor[i]->data, 
-                                                (Py_ssize_t) descriptor[i]->orInd/sizeof(SQLWCHAR))
-                        );
-                    if (PyErr_Occurred())
-                    {
-                        DBPRINTF(DBI_TRC_RET)("PyTuple_SetItem(....PyUnicode_FromWideChar.. failed\n");
-                        /*
-                        ** TODO consider logging stack back trace to log 
-                        ** (or include in exception text), this way we know 
-                        ** why the Python call failed? Maybe put this logic
-                        ** in IIDBI_handleError().
-                        ** Requires stderr redirect, may need to tack GIL lock too.
-                        ** 
-                        ** See http://groups.google.com/group/comp.lang.python/msg/5c3b92953cbef32b?hl=en&dmode=source
-                        ** See http://effbot.org/pyfaq/how-do-i-catch-the-output-from-pyerr-print-or-anything-that-prints-to-stdout-stderr.htm
-                        */
-                        exception = IIDBI_InterfaceError;
-                        errMsg = "Conversion of result column from SQLWCHAR into PyUnicode failed.";
-                        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-                        goto errorExit;
-                    }
-                break;
-            case SQL_DECIMAL:
-                    PyTuple_SetItem(row, i, 
-                        (PyObject *)PyObject_CallFunction(decimalType, "s", descriptor[i]->data));
-                    break;
+    switch (format[0])
+    {
+    case 'b':
+        *cType = SQL_C_STINYINT;
+        *type = SQL_TINYINT;
+        return itemSize == 1;
 
-            default:
-                DBPRINTF(DBI_TRC_STAT)("IIDBI_cursorFetch defaulting col %d type descriptor[i]->type %d\n", i, descriptor[i]->type);
-                PyTuple_SetItem(row, i, 
-                    PyString_FromStringAndSize(descriptor[i]->data,
-                                                (Py_ssize_t) descriptor[i]->orInd)
-                );
-                break;
-            }
-        }
-    }
+    case 'h':
+        *cType = SQL_C_SSHORT;
+        *type = SQL_SMALLINT;
+        return itemSize == sizeof(SQLSMALLINT);
 
-exitLabel:
-    dbi_freeData(IIDBIpstmt);
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorFetch }}}1\n", self);
+    case 'i':
+    case 'l':
+    case 'q':
+        if (itemSize == sizeof(SQLINTEGER))
+        {
+            *cType = SQL_C_LONG;
+            *type = SQL_INTEGER;
+            return TRUE;
+        }
+        *cType = SQL_C_SBIGINT;
+        *type = SQL_BIGINT;
+        return itemSize == sizeof(ODBCINT64);
 
-    if (row && row != Py_None)
-        self->rowindex++;
+    case 'f':
+        *cType = SQL_C_FLOAT;
+        *type = SQL_REAL;
+        return itemSize == sizeof(SQLREAL);
 
-    Py_XDECREF(self->rownumber);
-    self->rownumber = PyInt_FromLong(self->rowindex);
-    return row;
+    case 'd':
+        *cType = SQL_C_DOUBLE;
+        *type = SQL_DOUBLE;
+        return itemSize == sizeof(double);
 
-errorExit:
-    dbi_freeData(IIDBIpstmt);
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorFetch }}}1\n", self);
-    Py_XDECREF(self->rownumber);
-    self->rownumber = Py_None;
-    Py_INCREF(self->rownumber);
-    self->rowindex = 0;
-    if (row)
-    {
-        Py_XDECREF(row);
-    }
-    if (result)
-    {
-        Py_INCREF(Py_None);
-        return Py_None;
+    default:
+        return FALSE;
     }
-    return NULL;
 }
 
 /*{
-** Name: IIDBI_cursorNextSet
+** Name: IIDBI_paramColumnInit
 **
 ** Description:
-**     Returns the next result set from a multi-result set stored procedure.
+**     Set up a parameter column of executecolumns().  Column buffers,
+**     objects exporting a one dimensional contiguous buffer and objects
+**     with array.array's typecode and itemsize attributes are used as
+**     numeric buffers when IIDBI_paramBufferType() accepts their
+**     format; anything else must be a sequence.
 **
 ** Inputs:
-**    self - cursor object.
+**     column - parameter column to set up.
+**     source - column object, referenced by the caller until the column
+**              is released.
 **
 ** Outputs:
-**     None.
+**     column - set up.
+**     count - number of values in the column.
 **
 ** Returns:
-**     NULL.
+**     TRUE, or FALSE if source is neither a buffer nor a sequence.
 **
 ** Exceptions:
-**     Always returns "not supported" exception.
+**     None.
 **
 ** Side Effects:
-**     None.
+**     Holds the buffer of source, if any, until released by
+**     IIDBI_paramColumnRelease().
 **
 ** History:
-**     26-May-06 Ralph.Loen@ingres.com
+**     16-Oct-2026 (agent)
 **         Created.
 }*/
 
-static PyObject *IIDBI_cursorNextSet(IIDBI_CURSOR *self)
+static int IIDBI_paramColumnInit(IIDBI_PARAMCOLUMN *column, 
+    PyObject *source, Py_ssize_t *count)
 {
-    char *errMsg;
-    PyObject *exception;
+    IIDBI_COLUMNBUFFER *buffer;
+    PyObject *typecode;
+    PyObject *itemsize;
+    const void *data;
+    Py_ssize_t len;
 
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorNextSet {{{1\n", self);
-    IIDBI_handleWarning ( "DB-API extension cursor.nextset() used", 
-        NULL ) ;
-    errMsg = "cursor.nextset() is not supported in Ingres";
-    exception = IIDBI_NotSupportedError;
-    IIDBI_handleError((PyObject *)self, exception, errMsg);
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorNextSet }}}1\n", self);
-    return(NULL);
+    memset(column, 0, sizeof(IIDBI_PARAMCOLUMN));
+    column->source = source;
+
+    if (PyObject_TypeCheck(source, &IIDBI_columnBufferType))
+    {
+        buffer = (IIDBI_COLUMNBUFFER *)source;
+        if (IIDBI_paramBufferType(buffer->format, buffer->itemSize,
+            &column->cType, &column->type))
+        {
+            column->data = buffer->data + buffer->offset;
+            column->itemSize = buffer->itemSize;
+            if (buffer->nullCount)
+                column->nulls = 
+                    (unsigned char *)PyString_AS_STRING(buffer->nulls);
+            *count = buffer->count;
+            return TRUE;
+        }
+    }
+
+#ifdef Py_TPFLAGS_HAVE_NEWBUFFER
+    if (PyObject_CheckBuffer(source))
+    {
+        if (PyObject_GetBuffer(source, &column->view, 
+            PyBUF_ND | PyBUF_FORMAT) < 0)
+            PyErr_Clear();
+        else if (column->view.ndim == 1 && column->view.itemsize > 0 &&
+            IIDBI_paramBufferType(column->view.format, 
+            column->view.itemsize, &column->cType, &column->type))
+        {
+            column->hasView = TRUE;
+            column->data = column->view.buf;
+            column->itemSize = column->view.itemsize;
+            *count = column->view.len / column->itemSize;
+            return TRUE;
+        }
+        else
+            PyBuffer_Release(&column->view);
+    }
+#endif
+
+    typecode = PyObject_GetAttrString(source, "typecode");
+    itemsize = PyObject_GetAttrString(source, "itemsize");
+    if (typecode && itemsize && PyString_Check(typecode) && 
+        PyInt_Check(itemsize) && PyInt_AS_LONG(itemsize) > 0 &&
+        IIDBI_paramBufferType(PyString_AS_STRING(typecode), 
+        PyInt_AS_LONG(itemsize), &column->cType, &column->type) &&
+        PyObject_AsReadBuffer(source, &data, &len) == 0)
+    {
+        column->copy = TRUE;
+        column->itemSize = PyInt_AS_LONG(itemsize);
+        *count = len / column->itemSize;
+    }
+    PyErr_Clear();
+    Py_XDECREF(typecode);
+    Py_XDECREF(itemsize);
+    if (column->copy)
+        return TRUE;
+
+    column->items = PySequence_Fast(source, "");
+    if (!column->items)
+    {
+        PyErr_Clear();
+        return FALSE;
+    }
+    *count = PySequence_Fast_GET_SIZE(column->items);
+    return TRUE;
 }
 
 /*{
-** Name: IIDBI_cursorScroll
+** Name: IIDBI_paramColumnCheck
 **
 ** Description:
-**     Scroll a cursor according to the input direction and value. 
+**     Check that a parameter column still holds at least end values, and
+**     find the first value of a buffer column.  A column copied through
+**     the old buffer interface is looked up again, as it may have been
+**     resized or moved while the GIL was released.
 **
 ** Inputs:
-**    self - cursor object.
-**    args - evaluates to value (number of rows) and optional mode 
-**           ('relative' or 'absolute')
+**     column - parameter column.
+**     end - number of values needed.
 **
 ** Outputs:
-**     None.
+**     data - first value of a buffer column, NULL for a sequence.
 **
 ** Returns:
-**     NULL.
+**     TRUE, or FALSE if the column has been shortened.
 **
 ** Exceptions:
-**     Always returns "not supported" exception.
+**     None.
 **
 ** Side Effects:
 **     None.
 **
 ** History:
-**     26-May-06 Ralph.Loen@ingres.com
+**     16-Oct-2026 (agent)
 **         Created.
 }*/
 
-static PyObject *IIDBI_cursorScroll(IIDBI_CURSOR *self, PyObject *args)
+static int IIDBI_paramColumnCheck(IIDBI_PARAMCOLUMN *column, 
+    Py_ssize_t end, char **data)
 {
-    char *errMsg;
-    PyObject *exception;
-    int result = FALSE;
-
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorScroll {{{1\n", self);
-
-    IIDBI_handleWarning ( "DB-API extension cursor.scroll() used", 
-        NULL ) ;
-    errMsg = "Not yet supported natively in Ingres";
-    exception = IIDBI_NotSupportedError;
-    result = IIDBI_handleError((PyObject *)self, exception, errMsg);
+    const void *buf;
+    Py_ssize_t len;
 
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorScroll }}}1\n", self);
-    if (result)
+    *data = column->data;
+    if (column->items)
+        return PySequence_Fast_GET_SIZE(column->items) >= end;
+    if (!column->copy)
+        return TRUE;
+    if (PyObject_AsReadBuffer(column->source, &buf, &len) < 0)
     {
-        Py_INCREF(Py_None);
-        return Py_None;
+        PyErr_Clear();
+        return FALSE;
     }
-    else
-        return NULL;
+    *data = (char *)buf;
+    return len >= end * column->itemSize;
 }
 
 /*{
-** Name: IIDBI_cursorSetInputSizes
+** Name: IIDBI_paramColumnItem
 **
 ** Description:
-**    Determines the segment size for sending blob parameters.
+**     Return value j of a parameter column, for the rows executecolumns()
+**     sends one at a time.
 **
 ** Inputs:
-**     self - cursor object.
-**     args - evaluates to a sequence of input segment sizes for each
-**            input parameter.  Applies only to the underlying segment size
-**            for blob columns.
+**     column - parameter column.
+**     data - first value, from IIDBI_paramColumnCheck().
+**     j - row.
 **
 ** Outputs:
 **     None.
 **
 ** Returns:
-**         
+**     New reference to the value, None for NULL, or NULL on error.
+**
 ** Exceptions:
-**         
+**     None.
+**
 ** Side Effects:
-**     Determines segment size in SQLPutData() in the ODBC layer.
+**     None.
 **
 ** History:
-**     26-May-06 Ralph.Loen@ingres.com
+**     16-Oct-2026 (agent)
 **         Created.
 }*/
 
-static PyObject *IIDBI_cursorSetInputSizes(IIDBI_CURSOR *self, PyObject *args)
+static PyObject *IIDBI_paramColumnItem(IIDBI_PARAMCOLUMN *column, 
+    char *data, Py_ssize_t j)
 {
-    int len = 0;
-    int i;
-    PyObject *obj = NULL;
-    PyObject *item = NULL;
-    PyObject *exception;
-    char *errMsg;
-    int result = FALSE;
-
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorSetInputSizes {{{1\n", self);
+    PyObject *elem;
 
-    if (!PyArg_ParseTuple(args, "O", &obj)) 
+    if (column->items)
     {
-        exception = IIDBI_InterfaceError;
-        errMsg = "invalid argruments for cursor.setinputsizes";
-        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-        goto errorExit;
+        elem = PySequence_Fast_GET_ITEM(column->items, j);
+        Py_INCREF(elem);
+        return elem;
     }
-    if (!PySequence_Check(obj) )
+    if (column->nulls && column->nulls[j / 8] & (1 << (j % 8)))
     {
-        exception = IIDBI_InterfaceError;
-        errMsg = "argument to cursor.setinputsizes must be a sequence type";
-        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-        goto errorExit;
+        Py_INCREF(Py_None);
+        return Py_None;
     }
+    data += j * column->itemSize;
+    switch (column->cType)
+    {
+    case SQL_C_STINYINT:
+        return PyInt_FromLong(*(signed char *)data);
 
-    len = PySequence_Length( obj );
+    case SQL_C_SSHORT:
+        return PyInt_FromLong(*(SQLSMALLINT *)data);
 
-    self->inputSegmentSize = malloc(len*sizeof(int));
-    self->inputSegmentLen = len;
-    
-    for (i = 0; i < len; i++)
-    {
-        item = PySequence_GetItem(obj, i);
-        if (item != Py_None)
-        {
-            self->inputSegmentSize[i] = PyInt_AsLong(item);
-            if (self->inputSegmentSize[i] < 0)
-            {  
-                exception = IIDBI_InterfaceError;
-                errMsg = "argument has invalid type";
-                result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-                goto errorExit;
-            }
-        }
-		else
-            self->inputSegmentSize[i] = 0;
-        Py_DECREF(item);
-    }
+    case SQL_C_LONG:
+        return PyInt_FromLong(*(SQLINTEGER *)data);
 
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorSetInputSizes }}}1\n", self);
-    Py_INCREF(Py_None);
-    return(Py_None);
+    case SQL_C_SBIGINT:
+        return PyLong_FromLongLong(*(ODBCINT64 *)data);
 
-errorExit:
-    dbi_freeData(self->IIDBIpstmt);
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorSetInputSizes }}}1\n", self);
-    if (result)
-    {
-        Py_INCREF(Py_None);
-        return Py_None;
-    }
+    case SQL_C_FLOAT:
+        return PyFloat_FromDouble(*(SQLREAL *)data);
 
-    return NULL;
+    default:
+        return PyFloat_FromDouble(*(double *)data);
+    }
 }
 
 /*{
-** Name: IIDBI_cursorSetOutputSize
+** Name: IIDBI_paramColumnRelease
 **
 ** Description:
-**    Determines the segment size for fetching blob data.
+**     Release the parameter columns of executecolumns().
 **
 ** Inputs:
-**     self - cursor object.
-**     args - evaluates to output segment size, with optional index into
-**            the blob column.
+**     columns - parameter columns.
+**     count - number of columns.
 **
 ** Outputs:
-**     args must evaluate to at least one, or at most two, integers.
+**     None.
 **
 ** Returns:
 **     None.
-**         
+**
 ** Exceptions:
-**         
+**     None.
+**
 ** Side Effects:
-**     Determines segment size in SQLGetData() in the ODBC layer.
+**     Frees columns.
 **
 ** History:
-**     26-May-06 Ralph.Loen@ingres.com
+**     16-Oct-2026 (agent)
 **         Created.
 }*/
 
-
-static PyObject *IIDBI_cursorSetOutputSize(IIDBI_CURSOR *self, PyObject *args)
+static void IIDBI_paramColumnRelease(IIDBI_PARAMCOLUMN *columns, int count)
 {
-    int size = 0;
-    int column = 0;
-    PyObject *exception;
-    char *errMsg;
-    int result = FALSE;
-
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorSetOutputSize {{{1\n", self);
+    int i;
 
-    if (!PyArg_ParseTuple(args, "i|i", &size, &column)) 
+    for (i = 0; i < count; i++)
     {
-        exception = IIDBI_InterfaceError;
-        errMsg = "invalid argruments for cursor.setoutputsize";
-        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-        goto errorExit;
+        Py_XDECREF(columns[i].items);
+#ifdef Py_TPFLAGS_HAVE_NEWBUFFER
+        if (columns[i].hasView)
+            PyBuffer_Release(&columns[i].view);
+#endif
     }
+    free(columns);
+}
 
-    self->outputSegmentSize = size;
-    self->outputColumnIndex = column;
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorSetOutputSize }}}1\n", self);
+/*{
+** Name: IIDBI_paramSetSendRows
+**
+** Description:
+**     IIDBI_PARAMSET sendArray function of executemany(), see
+**     IIDBI_sendParameterArray().
+**
+** Inputs:
+**     set - parameter set.
+**     self - cursor object.
+**     start - index of the first row.
+**     count - number of rows.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     As IIDBI_sendParameterArray(), DBI_SQL_NO_DATA if the parameter
+**     set is not a sequence that can be indexed.
+**
+** Exceptions:
+**     As IIDBI_sendParameterArray().
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     17-Oct-2026 (agent)
+**         Created.
+}*/
 
-    Py_INCREF(Py_None);
-    return(Py_None);
+static int IIDBI_paramSetSendRows(IIDBI_PARAMSET *set, IIDBI_CURSOR *self,
+    int start, int count)
+{
+    if (!set->rows)
+        return DBI_SQL_NO_DATA;
+    return IIDBI_sendParameterArray(self, set->rows, start, count);
+}
+
+/*{
+** Name: IIDBI_paramSetGetRow
+**
+** Description:
+**     IIDBI_PARAMSET getRow function of executemany(), the row's own
+**     parameter sequence.
+**
+** Inputs:
+**     set - parameter set.
+**     self - cursor object.
+**     row - row index.
+**
+** Outputs:
+**     result - as returned by IIDBI_handleError().
+**
+** Returns:
+**     New reference to the row, or NULL.
+**
+** Exceptions:
+**     The row must be retrieved.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     17-Oct-2026 (agent)
+**         Created.
+}*/
 
-errorExit:
-    dbi_freeData(self->IIDBIpstmt);
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorSetOutputSize }}}1\n", self);
+static PyObject *IIDBI_paramSetGetRow(IIDBI_PARAMSET *set, 
+    IIDBI_CURSOR *self, Py_ssize_t row, int *result)
+{
+    PyObject *params = PySequence_GetItem(set->sequence, row);
 
-    if (result)
-    {
-        Py_INCREF(Py_None);
-        return Py_None;
-    }
-    return NULL;
+    if (!params)
+        *result = IIDBI_handleError((PyObject *)self, IIDBI_InternalError,
+            "failed to retrieve input parameter sequence");
+    return params;
 }
 
 /*{
-** Name: IIDBI_fetchMany
+** Name: IIDBI_paramSetSendColumns
 **
 ** Description:
-**     Fetch a pre-determined number of rows.
+**     IIDBI_PARAMSET sendArray function of executecolumns(), see
+**     IIDBI_sendColumnArray().
 **
 ** Inputs:
+**     set - parameter set.
 **     self - cursor object.
-**     args - evaluates to the number of rows.
+**     start - index of the first row.
+**     count - number of rows.
 **
 ** Outputs:
 **     None.
 **
 ** Returns:
-**     A list of rows up to the specified maximum.
-**    
+**     As IIDBI_sendColumnArray().
+**
 ** Exceptions:
-**     Args must evaluate to an integer.  The cursor must be open. The 
-**     ODBC statement handle must be non-null.  The cursor object must have 
-**     a valid descriptor and descriptor count.  The fetch must succeed.
-**         
+**     As IIDBI_sendColumnArray().
+**
 ** Side Effects:
 **     None.
 **
 ** History:
-**     26-May-06 Ralph.Loen@ingres.com
+**     17-Oct-2026 (agent)
 **         Created.
 }*/
 
-static PyObject *IIDBI_cursorFetchMany(IIDBI_CURSOR *self, PyObject *args)
+static int IIDBI_paramSetSendColumns(IIDBI_PARAMSET *set, 
+    IIDBI_CURSOR *self, int start, int count)
 {
-    PyObject *list = NULL;
-    PyObject *row = NULL;
-    int dbistat = 0;
-    int arraySize = 0;
-    int arrayCount = 0;
-    int resultSetSize = 0;
-    PyObject *exception;
-    char *errMsg;
-    int result = FALSE;
- 
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorFetchMany {{{1\n", self);
-
-    if (self->closed)
-    {
-        exception = IIDBI_InterfaceError; 
-        errMsg = "cursor is already closed";
-        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-        goto errorExit;
-    }
-    if (!self->IIDBIpstmt)
-    {
-        exception = IIDBI_InternalError;
-        errMsg = "Invalid DBI statement handle";
-        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-        goto errorExit;
-    }
-
-    if (self->arraysize < 0)
-    {
-        exception = IIDBI_InterfaceError; 
-        errMsg = "cursor.arraysize attribute must not be a negative value";
-        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-        goto errorExit;
-    }
+    return IIDBI_sendColumnArray(self, set->columns, set->parmCount, start,
+        count);
+}
 
-    if (!PyArg_ParseTuple(args, "|i", &resultSetSize)) 
-    {
-        exception = IIDBI_InterfaceError; 
-        errMsg = "usage: cursor.fetchmany([rows])";
-        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-        goto errorExit;
-    }  
+/*{
+** Name: IIDBI_paramSetColumnRow
+**
+** Description:
+**     IIDBI_PARAMSET getRow function of executecolumns(), a tuple of the
+**     row's value in each column.
+**
+** Inputs:
+**     set - parameter set.
+**     self - cursor object.
+**     row - row index.
+**
+** Outputs:
+**     result - as returned by IIDBI_handleError().
+**
+** Returns:
+**     New reference to the row, or NULL.
+**
+** Exceptions:
+**     The columns must not have changed size.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     17-Oct-2026 (agent)
+**         Created.
+}*/
 
-    if (resultSetSize < 0)
-    {
-        exception = IIDBI_InterfaceError; 
-        errMsg = "cursor.fetchmany() argument must not be a negative value";
-        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-        goto errorExit;
-    }
-    list = PyList_New(0);
-    if (PyObject_Length(args) == 1)
-        arraySize = resultSetSize;
-    else
-        arraySize = self->arraysize;
+static PyObject *IIDBI_paramSetColumnRow(IIDBI_PARAMSET *set, 
+    IIDBI_CURSOR *self, Py_ssize_t row, int *result)
+{
+    PyObject *params;
+    PyObject *elem;
+    char *data;
+    int i;
 
-    while (row != Py_None && arrayCount != arraySize)
+    params = PyTuple_New(set->parmCount);
+    if (!params)
+        return NULL;
+    for (i = 0; i < set->parmCount; i++)
     {
-        row = IIDBI_cursorFetch(self);
-        if (row == NULL)
+        if (!IIDBI_paramColumnCheck(&set->columns[i], row + 1, &data))
         {
-            Py_DECREF(list);
-            exception = IIDBI_DatabaseError;
-            errMsg = "Error fetching rows";
-            result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-            goto errorExit;
+            Py_DECREF(params);
+            *result = IIDBI_handleError((PyObject *)self, 
+                IIDBI_InterfaceError, "parameter column changed size");
+            return NULL;
         }
-        if (row != Py_None)
+        elem = IIDBI_paramColumnItem(&set->columns[i], data, row);
+        if (!elem)
         {
-            dbistat = PyList_Append(list, row);
-            arrayCount++;
+            Py_DECREF(params);
+            return NULL;
         }
-	Py_XDECREF(row);
-    }
-
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorFetchMany }}}1\n", self);
-    return list;
-
-errorExit:
-    self->rowcount = -1;
-        Py_XDECREF(self->rownumber);
-    self->rownumber = Py_None;
-        Py_INCREF(self->rownumber);
-    self->rowindex = 0;
-    dbi_freeData(self->IIDBIpstmt);
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorFetchMany }}}1\n", self);
-    if (result)
-    {
-        Py_INCREF(Py_None);
-        return Py_None;
+        PyTuple_SET_ITEM(params, i, elem);
     }
-    return NULL;
+    return params;
 }
 
 /*{
-** Name: IIDBI_cursorFetchAll
+** Name: IIDBI_putSourceNew
 **
 ** Description:
-**     Fetches all rows in the target table(s).
+**     Create the stream for a LOB parameter given as a file-like object,
+**     whose read(size) method is called for each segment, or as an
+**     iterator yielding segments. Segments must be str or buffer
+**     objects; an empty read() ends the value.
 **
 ** Inputs:
-**     None.
+**     elem - file-like object or iterator.
 **
 ** Outputs:
 **     None.
 **
 ** Returns:
-**     A list of tuples containing all available rows.
-**     
+**     The stream, or NULL if it could not be allocated.
+**
 ** Exceptions:
-**     Args must evaluate to an integer.  The cursor must be open. The 
-**     ODBC statement handle must be non-null.  The cursor object must have 
-**     a valid descriptor and descriptor count.  The fetch must succeed.
-**         
-** Side Effects:
 **     None.
 **
+** Side Effects:
+**     References to the read method or the iterator are held until the
+**     stream is released.
+**
 ** History:
-**     26-May-06 Ralph.Loen@ingres.com
+**     16-Oct-2026 (agent)
 **         Created.
 }*/
 
-static PyObject *IIDBI_cursorFetchAll(IIDBI_CURSOR *self)
+static IIDBI_PUTSTREAM *IIDBI_putSourceNew(PyObject *elem)
 {
-    PyObject *list = NULL;
-    PyObject *row = NULL;
-    PyObject *lastexception = NULL;
-    int dbistat = 0;
-    PyObject *exception;
-    char *errMsg;
-    int result = FALSE;
- 
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorFetchAll {{{1\n", self);
-
-    if (self->closed)
-    {
-        exception = IIDBI_InterfaceError; 
-        errMsg = "cursor is already closed";
-        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-        goto errorExit;
-    }
-
-    if (!self->IIDBIpstmt)
-    {
-        exception = IIDBI_InternalError;
-        errMsg = "Invalid DBI statement handle";
-        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-        goto errorExit;
-    }
-
-    row = IIDBI_cursorFetch(self);
-
-    if (row == NULL)
-    {
-        lastexception = PyErr_Occurred();
-        if (lastexception == NULL)
-        {
-            if (PyErr_GivenExceptionMatches(lastexception, IIDBI_Error))
-            {
-                /* We have an unhandled (non-IngresDBI) exception */
-                DBPRINTF(DBI_TRC_STAT)("fetchall call to IIDBI_cursorFetch got null\n");
-                exception = IIDBI_DatabaseError;
-                errMsg = "Error fetching rows";
-                result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-            }
-        }
-        goto errorExit;
-    }
+    IIDBI_PUTSOURCE *source;
 
-    list = PyList_New(0);
+    source = (IIDBI_PUTSOURCE *)calloc(1, sizeof(IIDBI_PUTSOURCE));
+    if (!source)
+        return NULL;
 
-    while (row != Py_None)
+    source->stream.read = IIDBI_putSourceRead;
+    source->stream.release = IIDBI_putSourceRelease;
+    if (PyObject_HasAttrString(elem, "read"))
+        source->read = PyObject_GetAttrString(elem, "read");
+    else
     {
-        dbistat = PyList_Append(list, row);
-        Py_XDECREF(row);
-        row = IIDBI_cursorFetch(self);
-        if (row == NULL)
-        {
-            DBPRINTF(DBI_TRC_STAT)("fetchall call to IIDBI_cursorFetch got null\n");
-            Py_XDECREF(list);
-            exception = IIDBI_DatabaseError;
-            errMsg = "Error fetching rows";
-            result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-            goto errorExit;
-        }
+        Py_INCREF(elem);
+        source->iterator = elem;
     }
-    Py_XDECREF(row);
-
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorFetchAll (success) %d }}}1\n", self,          self->rowcount);
-    return list;
-
-errorExit:
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorFetchAll (err) %d }}}1\n", self,
-        self->rowcount);
-    dbi_freeData(self->IIDBIpstmt);
-    self->rowcount = -1;
-    Py_XDECREF(self->rownumber);
-    self->rownumber = Py_None;
-    Py_INCREF(self->rownumber);
-    self->rowindex = 0;
-    if (result)
+    if (!source->read && !source->iterator)
     {
-        Py_INCREF(Py_None);
-        return Py_None;
+        PyErr_Clear();
+        free(source);
+        return NULL;
     }
-    return NULL;
+    return &source->stream;
 }
 
 /*{
-** Name: IIDBI_connCommit
+** Name: IIDBI_putSourceRead
 **
 ** Description:
-**     Commit a transaction.
+**     IIDBI_PUTSTREAM read function of a LOB parameter source. Called
+**     by dbi_cursorExecute(), usually with the GIL released, so the GIL
+**     is taken for the duration of the call.
 **
 ** Inputs:
-**     self - connection object.
+**     stream - the IIDBI_PUTSOURCE.
+**     size - segment size requested from a file-like object.
 **
 ** Outputs:
-**     None.
+**     data - the segment, valid until the next call.
+**     len - length of the segment in bytes.
 **
 ** Returns:
-**     None.
-**         
+**     DBI_SQL_SUCCESS
+**     DBI_SQL_NO_DATA   end of the value.
+**     DBI_SQL_ERROR     a Python exception is set.
+**
 ** Exceptions:
-**     ODBC connection handle must be valid.  Connection object must be open.
+**     Whatever read() or the iterator raises. InterfaceError if a
+**     segment is not a str or buffer.
 **
 ** Side Effects:
 **     None.
 **
 ** History:
-**     26-May-06 Ralph.Loen@ingres.com
+**     16-Oct-2026 (agent)
 **         Created.
 }*/
 
-static PyObject *IIDBI_connCommit(IIDBI_CONNECTION *self)
+static int IIDBI_putSourceRead(IIDBI_PUTSTREAM *stream, int size, 
+    char **data, SQLLEN *len)
 {
-    RETCODE rc;
-    IIDBI_DBC *IIDBIpdbc = self->IIDBIpdbc;
-    PyObject *exception;
-    char *errMsg;
-    int result = FALSE;
-
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_connCommit {{{1\n", self);
-    if (self->closed)
-    {
-        exception = self->Error;
-        errMsg = "connection is closed";
-        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-        goto errorExit;
-    }
-    if (!self->IIDBIpdbc)
-    {
-        exception = self->InterfaceError;
-        errMsg = "Invalid DBI connection handle";
-        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-        goto errorExit;
-    }
-
-    Py_BEGIN_ALLOW_THREADS
-    rc = dbi_connectionCommit(self->IIDBIpdbc);
-    Py_END_ALLOW_THREADS
-    if (rc != DBI_SQL_SUCCESS)
-    {
-        result = IIDBI_mapError2exception((PyObject *)self,&IIDBIpdbc->hdr.err, 
-            rc, NULL);
-        goto errorExit;
-    }
-
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_connCommit }}}1\n", self);
-    Py_INCREF(Py_None);
-    return Py_None;
-
-errorExit:
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_connCommit }}}1\n", self);
-    if (result)
-    {
-        Py_INCREF(Py_None);
-        return Py_None;
+    IIDBI_PUTSOURCE *source = (IIDBI_PUTSOURCE *)stream;
+    PyGILState_STATE gstate;
+    const void *buf;
+    Py_ssize_t bufLen;
+    int return_code = DBI_SQL_SUCCESS;
+
+    gstate = PyGILState_Ensure();
+    for (;;)
+    {
+        Py_XDECREF(source->segment);
+        if (source->read)
+            source->segment = PyObject_CallFunction(source->read, "i", size);
+        else
+            source->segment = PyIter_Next(source->iterator);
+        if (!source->segment)
+        {
+            return_code = PyErr_Occurred() ? DBI_SQL_ERROR : DBI_SQL_NO_DATA;
+            break;
+        }
+        if (PyUnicode_Check(source->segment))
+        {
+            PyErr_SetString(IIDBI_InterfaceError, 
+                "LOB parameter segments must be str or buffer objects");
+            return_code = DBI_SQL_ERROR;
+            break;
+        }
+        if (PyObject_AsReadBuffer(source->segment, &buf, &bufLen) == -1)
+        {
+            return_code = DBI_SQL_ERROR;
+            break;
+        }
+        if (bufLen)
+        {
+            *data = (char *)buf;
+            *len = bufLen;
+            break;
+        }
+        /* end of file, iterators may yield empty segments */
+        if (source->read)
+        {
+            return_code = DBI_SQL_NO_DATA;
+            break;
+        }
     }
-    return NULL;
+    PyGILState_Release(gstate);
+    return return_code;
 }
 
 /*{
-** Name: IIDBI_connRollback
+** Name: IIDBI_putSourceRelease
 **
 ** Description:
-**     Roll back a transaction.
+**     IIDBI_PUTSTREAM release function of a LOB parameter source. May be
+**     called with the GIL released.
 **
 ** Inputs:
-**     self - connection object.
+**     stream - the IIDBI_PUTSOURCE.
 **
 ** Outputs:
 **     None.
 **
 ** Returns:
 **     None.
-**         
+**
 ** Exceptions:
-**     ODBC connection handle must be valid.  Connection object must be open.
+**     None.
 **
 ** Side Effects:
-**     None.
+**     The source is freed.
 **
 ** History:
-**     26-May-06 Ralph.Loen@ingres.com
+**     16-Oct-2026 (agent)
 **         Created.
 }*/
 
-static PyObject *IIDBI_connRollback(IIDBI_CONNECTION *self)
+static void IIDBI_putSourceRelease(IIDBI_PUTSTREAM *stream)
 {
-    RETCODE rc;
-    IIDBI_DBC *IIDBIpdbc = self->IIDBIpdbc;
-    PyObject *exception;
-    char *errMsg; 
-    int result = FALSE;
-
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_connRollback {{{1\n", self);
+    IIDBI_PUTSOURCE *source = (IIDBI_PUTSOURCE *)stream;
+    PyGILState_STATE gstate;
+
+    gstate = PyGILState_Ensure();
+    Py_XDECREF(source->read);
+    Py_XDECREF(source->iterator);
+    Py_XDECREF(source->segment);
+    PyGILState_Release(gstate);
+    free(source);
+}
 
-    if (self->closed)
-    {
-        exception = self->Error; 
-        errMsg = "connection is closed";
-        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-        goto errorExit;
-    }
-    if (!self->IIDBIpdbc)
-    {
-        exception = self->InterfaceError;
-        errMsg = "Invalid DBI connection handle";
-        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-        goto errorExit;
-    }
+/*{
+** Name: IIDBI_lobGrow
+**
+** Description:
+**     IIDBI_LOBALLOC grow function. Moves a LONG VARCHAR or LONG BYTE
+**     value being read into a Python string, desc->lobObject, and
+**     resizes it as the value grows, so the row takes the value without
+**     copying it again. The string's own null terminator covers
+**     SQL_C_CHAR's. Called with the GIL released.
+**
+** Inputs:
+**     desc - column descriptor.
+**     buf - current buffer, the string's once it exists.
+**     count - bytes of buf in use.
+**     size - new buffer size.
+**
+** Outputs:
+**     desc->lobObject - string holding the buffer.
+**
+** Returns:
+**     The new buffer, or NULL if no memory is left. buf is released
+**     either way.
+**
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     17-Oct-2026 (agent)
+**         Created from dbi_lobBuffer().
+}*/
 
-    Py_BEGIN_ALLOW_THREADS
-    rc = dbi_connectionRollback(self->IIDBIpdbc);
-    Py_END_ALLOW_THREADS
-    if (rc != DBI_SQL_SUCCESS)
-    {
-        result = IIDBI_mapError2exception((PyObject *)self, &IIDBIpdbc->hdr.err, 
-            rc, NULL);
-        goto errorExit;
-    }
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_connRollback }}}1\n", self);
-    Py_INCREF(Py_None);
-    return Py_None;
+static char *IIDBI_lobGrow(IIDBI_DESCRIPTOR *desc, char *buf, SQLLEN count,
+    SQLLEN size)
+{
+    PyGILState_STATE gstate;
+    char *newBuf = NULL;
 
-errorExit:
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_connRollback }}}1\n", self);
-    if (result)
+    gstate = PyGILState_Ensure();
+    if (!desc->lobObject)
     {
-        Py_INCREF(Py_None);
-        return Py_None;
+        desc->lobObject = PyString_FromStringAndSize(NULL, size);
+        if (desc->lobObject)
+            memcpy(PyString_AS_STRING(desc->lobObject), buf, count);
+        free(buf);
     }
-    return NULL;
+    else
+        _PyString_Resize(&desc->lobObject, size);
+    if (desc->lobObject)
+        newBuf = PyString_AS_STRING(desc->lobObject);
+    else
+        PyErr_Clear();
+    PyGILState_Release(gstate);
+    return newBuf;
 }
 
 /*{
-** Name: IIDBI_mapError2Exception
+** Name: IIDBI_lobDrop
 **
 ** Description:
-**     Convert an ODBC error to an ingresdbi exception object.
+**     IIDBI_LOBALLOC release function. Drops a LONG value left in
+**     desc->lobObject when the row was not built. May be called with
+**     the GIL released.
 **
 ** Inputs:
-**     self - connection or cursor object.
+**     desc - column descriptor.
 **
 ** Outputs:
-**     None.
+**     desc->lobObject is cleared.
 **
 ** Returns:
 **     None.
-**         
+**
 ** Exceptions:
 **     None.
 **
@@ -5191,216 +13867,195 @@ errorExit:
 **     None.
 **
 ** History:
-**     26-May-06 Ralph.Loen@ingres.com
-**         Created.
+**     17-Oct-2026 (agent)
+**         Created from dbi_lobRelease().
 }*/
 
-
-int IIDBI_mapError2exception(PyObject *self, IIDBI_ERROR *err, RETCODE rc, 
-    char *queryText)
+static void IIDBI_lobDrop(IIDBI_DESCRIPTOR *desc)
 {
-    PyObject *errObj;
-    PyObject *exceptObj;
-    PyObject *errTuple;
-    IIDBI_CONNECTION *conn = NULL;
-    IIDBI_CURSOR *cursor = NULL;
-    int result = FALSE;
-
-    if (self && PyObject_TypeCheck(self, &IIDBI_connectType))
-        conn = (IIDBI_CONNECTION *)self;
-    else
-        cursor = (IIDBI_CURSOR *)self;
-
-    switch (rc)
-    {
-    case DBI_SQL_SUCCESS_WITH_INFO:
-        exceptObj = conn ? conn->Warning : IIDBI_Warning;
-        break;
-
-    case DBI_INTERNAL_ERROR:
-        exceptObj = conn ? conn->OperationalError : 
-            IIDBI_OperationalError;
-        break;
-
-    case DBI_SQL_ERROR:
-        if (!strcmp(err->sqlState, "23501"))
-            exceptObj = conn ? conn->IntegrityError :
-               IIDBI_IntegrityError;
-        else
-            exceptObj = conn ? conn->DataError : IIDBI_DataError;
-        break;
-
-    default:
-        exceptObj = conn ? conn->InternalError : IIDBI_InternalError;
-        break;
-    }
-    if (conn && conn->errorhandler != Py_None)
-    {
-         result = IIDBI_handleError(self, exceptObj, err->messageText);
-         goto handler_exit;
-    }
-    else if (cursor && cursor->errorhandler != Py_None)
-    {
-         result = IIDBI_handleError(self, exceptObj, err->messageText);
-         goto handler_exit;
-    }
+    PyGILState_STATE gstate;
 
-    errObj = Py_BuildValue("iissz", rc, err->native, err->sqlState,  
-        err->messageText, queryText);
-
-    errTuple = Py_BuildValue("OO", exceptObj, errObj);
-
-    PyList_Append( conn ? conn->messages : cursor->messages, errTuple);
-    Py_DECREF(errTuple);
-
-    PyErr_SetObject(exceptObj, errObj);
-
-    return FALSE;
-
-handler_exit:
-    return result;
+    gstate = PyGILState_Ensure();
+    Py_CLEAR(desc->lobObject);
+    PyGILState_Release(gstate);
 }
 
 /*{
-** Name: IIDBI_connClose
+** Name: IIDBI_decimalModeArg
 **
 ** Description:
-**      Mark a connection object as closed and deallocate connection data.
+**     Map the name of a connection.decimal mode, in either case, to
+**     its IIDBI_DECIMAL_xxx value.
 **
 ** Inputs:
-**     self - connection object.
+**     arg - mode name.
 **
 ** Outputs:
 **     None.
 **
 ** Returns:
-**     None.
+**     IIDBI_DECIMAL_xxx, or -1 if arg is not a mode.
 **
 ** Exceptions:
-**     Connection object must be open.
+**     None.
 **
 ** Side Effects:
 **     None.
 **
 ** History:
-**     26-May-06 Ralph.Loen@ingres.com
+**     16-Oct-2026 (agent)
 **         Created.
 }*/
 
-static PyObject *IIDBI_connClose(IIDBI_CONNECTION *self) 
+static int IIDBI_decimalModeArg(char *arg)
 {
-    PyObject *exception;
-    char *errMsg;
-    int result = FALSE;
-
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_connClose {{{1\n", self);
-
-    if (self->closed)
-    {
-        exception = self->Error;
-        errMsg = "connection is already closed";
-        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-        goto errorExit;
-    }
-
-    self->closed = TRUE;
-    IIDBI_connCleanup(self);
-
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_connClose }}}1\n", self);
-    Py_INCREF(Py_None);
-    return Py_None;
+    int i, j;
 
-errorExit:
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_connClose }}}1\n", self);
-    if (result)
+    for (i = 0; i < (int)(sizeof(decimalModes) / sizeof(decimalModes[0])); 
+        i++)
     {
-        Py_INCREF(Py_None);
-        return Py_None;
+        for (j = 0; arg[j] && tolower((unsigned char)arg[j]) == 
+            decimalModes[i][j]; j++)
+            ;
+        if (!arg[j] && !decimalModes[i][j])
+            return i;
     }
-    else
-        return NULL;
+    return -1;
 }
 
 /*{
-** Name: IIDBI_cursorClose
+** Name: IIDBI_decimalFromChar
 **
 ** Description:
-**     Close a DBI cursor object.
+**     Convert a DECIMAL column, fetched as a string, to the Python
+**     type selected by the connection.decimal mode. A Decimal is made
+**     by a single call of the cached Decimal type with the string. For
+**     the "float" and "int" modes the string is split into sign,
+**     significant digits and scale here, so no Decimal is created.
+**     Strings that are not plain decimals go through Decimal.
 **
 ** Inputs:
-**     self - cursor object.
+**     data - null terminated string returned by the driver.
+**     mode - IIDBI_DECIMAL_xxx.
 **
 ** Outputs:
 **     None.
 **
 ** Returns:
-**     None.
-**         
+**     New reference to the value, or NULL on error.
+**
 ** Exceptions:
-**     Cursor object must be open.
+**     Conversion of the string must succeed.
 **
 ** Side Effects:
 **     None.
 **
 ** History:
-**     26-May-06 Ralph.Loen@ingres.com
+**     16-Oct-2026 (agent)
 **         Created.
+**     17-Oct-2026 (agent)
+**         Build a Decimal from the driver string, which is faster than
+**         its private slots or tuple constructor on the pure Python
+**         decimal module.
 }*/
 
-static PyObject *IIDBI_cursorClose(IIDBI_CURSOR *self) 
+static PyObject *IIDBI_decimalFromChar(char *data, int mode)
 {
-    PyObject *exception;
-    char *errMsg;
-    int result = FALSE;
-
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorClose {{{1\n", self);
+    char digits[IIDBI_DECIMAL_STRING_SIZE];
+    char number[IIDBI_DECIMAL_STRING_SIZE + 16];
+    char *p = data;
+    int sign = 0;
+    int nDigits = 0;
+    int scale = 0;
+    int seen = FALSE;
+    int inFraction = FALSE;
+    double d;
+    PyObject *value = NULL;
+
+    if (mode == IIDBI_DECIMAL_STRING)
+        return PyString_FromString(data);
+    if (mode == IIDBI_DECIMAL_DECIMAL)
+        return PyObject_CallFunction(decimalType, "s", data);
+
+    while (*p == ' ')
+        p++;
+    if (*p == '-' || *p == '+')
+        sign = (*p++ == '-');
+    for (; *p; p++)
+    {
+        if (isdigit((unsigned char)*p))
+        {
+            if (nDigits == sizeof(digits) - 1)
+                break;
+            if (nDigits || *p != '0') /* drop leading zeros */
+                digits[nDigits++] = *p;
+            if (inFraction)
+                scale++;
+            seen = TRUE;
+        }
+        else if ((*p == '.' || *p == ',') && !inFraction)
+            inFraction = TRUE;
+        else
+            break;
+    }
+    while (*p == ' ')
+        p++;
+    if (!nDigits)
+        digits[nDigits++] = '0';
+    digits[nDigits] = '\0';
 
-    if (self->closed)
+    if (*p || !seen)
     {
-        exception = IIDBI_InterfaceError;
-        errMsg = "cursor is already closed";
-        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-        goto errorExit;
+        value = PyObject_CallFunction(decimalType, "s", data);
+        if (value && mode == IIDBI_DECIMAL_FLOAT)
+        {
+            PyObject *fvalue = PyNumber_Float(value);
+
+            Py_DECREF(value);
+            value = fvalue;
+        }
+        return value;
     }
-   
-    self->closed = TRUE;
 
-    if (IIDBI_cursorCleanup(self) != DBI_SQL_SUCCESS)
+    if (mode == IIDBI_DECIMAL_FLOAT)
     {
-        exception = IIDBI_InternalError;
-        errMsg = "Error releasing cursor resources";
-        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-        goto errorExit;
+        /* let the float parser do the rounding */
+        sprintf(number, "%s%se-%d", sign ? "-" : "", digits, scale);
+        d = PyOS_string_to_double(number, NULL, NULL);
+        if (d == -1.0 && PyErr_Occurred())
+            return NULL;
+        return PyFloat_FromDouble(d);
     }
 
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorClose }}}1\n", self);
-    Py_INCREF(Py_None);
-    return Py_None;
-
-errorExit:
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorClose }}}1\n", self);
-    if (result)
+    if (!scale)
     {
-        Py_INCREF(Py_None);
-        return Py_None;
+        sprintf(number, "%s%s", sign ? "-" : "", digits);
+        return PyInt_FromString(number, NULL, 10);
     }
-    return NULL;
+    return PyObject_CallFunction(decimalType, "s", data);
 }
 
 /*{
-** Name: IIDBI_cursorCleanup
+** Name: IIDBI_decimalToChar
 **
 ** Description:
-**     Deallocate internal cursor resources and mark closed.
+**     Format a Decimal parameter with str() and copy it into buf if it
+**     is a plain decimal string. The precision and scale it is bound
+**     with are counted from the string.
 **
 ** Inputs:
-**     self - cursor object.
+**     value - parameter object.
+**     bufLen - size of buf.
 **
 ** Outputs:
-**     None.
+**     buf - null terminated string.
+**     precision - significant digits, at least 1.
+**     scale - digits after the decimal point.
 **
 ** Returns:
-**     DBI_SQL_SUCCESS;
+**     Length of the string, or -1 if str() fails, the string is in
+**     exponent form, NaN or Infinity, or it does not fit in buf. The
+**     caller then handles the str() form itself.
 **
 ** Exceptions:
 **     None.
@@ -5409,163 +14064,211 @@ errorExit:
 **     None.
 **
 ** History:
-**     26-May-06 Ralph.Loen@ingres.com
+**     16-Oct-2026 (agent)
 **         Created.
+**     17-Oct-2026 (agent)
+**         Format the value with str(), which is faster than as_tuple()
+**         on the pure Python decimal module.
 }*/
 
-int IIDBI_cursorCleanup(IIDBI_CURSOR *self)
+static int IIDBI_decimalToChar(PyObject *value, char *buf, int bufLen, 
+    int *precision, int *scale)
 {
-    IIDBI_CONNECTION *connection = self->connection;
-    int rc = DBI_SQL_SUCCESS;
-    IIDBI_STMT *IIDBIpstmt = NULL;
-
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorCleanup }}}1\n", self);
-
-    IIDBIpstmt = self->IIDBIpstmt;
-
-    self->closed = 1;
-
-    if (!IIDBIpstmt)
-        goto exitLabel;
-
-    if (!connection->closed)
-    {
-        Py_BEGIN_ALLOW_THREADS
-        rc = dbi_cursorClose(self->IIDBIpstmt);
-        Py_END_ALLOW_THREADS
-        if (rc != DBI_SQL_SUCCESS)
-            goto exitLabel;
-    }
-    if (IIDBIpstmt->descCount)
-    {
-        rc = dbi_freeDescriptor(IIDBIpstmt, 0);
-        if (rc != DBI_SQL_SUCCESS)
-            goto exitLabel;
-    }
+    PyObject *str;
+    char *data;
+    char *p;
+    int intDigits = 0;
+    int frac = 0;
+    int inFraction = FALSE;
+    int len;
 
-    if (IIDBIpstmt->parmCount)
+    str = PyObject_Str(value);
+    if (!str)
     {
-        rc = dbi_freeDescriptor(IIDBIpstmt, 1);
-        if (rc != DBI_SQL_SUCCESS)
-            goto exitLabel;
+        PyErr_Clear();
+        return -1;
     }
-
-exitLabel:
-
-    if (self->szSqlStr)
+    data = PyString_AS_STRING(str);
+    len = (int)PyString_GET_SIZE(str);
+    p = data;
+    if (*p == '-')
+        p++;
+    /* Ignore leading zeros */
+    while (*p == '0')
+        p++;
+    for (; *p; p++)
+    {
+        if (isdigit((unsigned char)*p))
+        {
+            if (inFraction)
+                frac++;
+            else
+                intDigits++;
+        }
+        else if (*p == '.' && !inFraction)
+            inFraction = TRUE;
+        else
+            break;
+    }
+    if (*p || len >= bufLen || !isdigit((unsigned char)data[len - 1]))
     {
-         free(self->szSqlStr);
-         self->szSqlStr = NULL;
+        Py_DECREF(str);
+        return -1;
     }
-
-    IIDBI_clearMessages(self->messages);
-    if (IIDBIpstmt)
-	free(IIDBIpstmt);
-    self->IIDBIpstmt = NULL;
-
-    self->rowcount = -1;
-    Py_XDECREF(self->rownumber);
-    self->rownumber = Py_None;
-    Py_INCREF(self->rownumber);
-    self->rowindex = 0;
-
-    if (self->inputSegmentSize)
-        free(self->inputSegmentSize);
-    self->inputSegmentSize = NULL;
-    self->inputSegmentLen = 0;
-
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorCleanup {{{1\n", self);
-    return rc;
+    memcpy(buf, data, len + 1);
+    Py_DECREF(str);
+    *precision = (intDigits + frac) ? intDigits + frac : 1;
+    *scale = frac;
+    return len;
 }
 
 /*{
-** Name: IIDBI_mapType
+** Name: IIDBI_convertResolve
 **
 ** Description:
-**     Map an ODBC data type to one of the five ingresdbi module attribute
-**     type codes: NUMBER, BINARY, STRING, UNICODE, or DATETIME.
+**     Resolve the output converter of each result column. A converter
+**     is looked up by column index, then by ODBC type name (see
+**     IIDBI_convertTypeName()), first in cursor.converters and then in
+**     connection.converters. It is one of the names "default", "string",
+**     "bytes", "int" or "float", or a callable passed the column's
+**     string form. "int" and "float" only apply to numeric columns.
+**
+**     Nothing is allocated when neither dictionary has entries, so
+**     IIDBI_cursorBuildRow() then takes its usual path.
 **
 ** Inputs:
-**     ODBC SQL type.
+**     self - cursor object.
+**     IIDBIpstmt - statement with the described result columns.
 **
 ** Outputs:
-**     None.
+**     errMsg - message when a converter is not valid.
 **
 ** Returns:
-**     DBI_NUMBER_TYPE
-**     DBI_BINARY_TYPE
-**     DBI_STRING_TYPE
-**     DBI_UNICODE_TYPE
-**     DBI_DATETIME_TYPE
+**     0 on success, -1 on error.
 **
 ** Exceptions:
-**     None.      
+**     None.
 **
 ** Side Effects:
-**     None.
+**     Sets convertModes, convertCalls and convertCount of the cursor.
 **
 ** History:
-**     26-May-06 Ralph.Loen@ingres.com
+**     16-Oct-2026 (agent)
 **         Created.
 }*/
 
-int IIDBI_mapType(int type)
+static int IIDBI_convertResolve(IIDBI_CURSOR *self, IIDBI_STMT *IIDBIpstmt, 
+    char **errMsg)
 {
-    int retType = DBI_UNKNOWN_TYPE;
+    PyObject *connConverters = NULL;
+    PyObject *converter;
+    char *typeName;
+    int mode;
+    int type;
+    int i, j;
+
+    IIDBI_convertRelease(self);
+    if (self->connection != (IIDBI_CONNECTION *)Py_None)
+        connConverters = self->connection->converters;
+    if ((!self->converters || !PyDict_Size(self->converters)) &&
+        (!connConverters || !PyDict_Size(connConverters)))
+        return 0;
 
-    switch (type)
+    self->convertModes = (unsigned char *)calloc(IIDBIpstmt->descCount, 
+        sizeof(unsigned char));
+    if (!self->convertModes)
     {
-    case SQL_CHAR:
-    case SQL_VARCHAR:
-    case SQL_NUMERIC:
-       retType = DBI_STRING_TYPE;
-       break;
-
-    case SQL_WCHAR:
-    case SQL_WVARCHAR:
-    case SQL_WLONGVARCHAR:
-       retType = DBI_UNICODE_TYPE;
-       break;
-    case SQL_FLOAT:
-    case SQL_REAL:
-    case SQL_DOUBLE:
-    case SQL_BIGINT:
-    case SQL_SMALLINT:
-    case SQL_TINYINT:
-    case SQL_INTEGER:
-    case SQL_DECIMAL:
-        retType = DBI_NUMBER_TYPE;
-        break;
+        *errMsg = "Could not allocate output converters";
+        return -1;
+    }
+    self->convertCount = IIDBIpstmt->descCount;
 
-    case SQL_TYPE_TIMESTAMP:
-    case SQL_TYPE_DATE:
-    case SQL_TYPE_TIME:
-        retType = DBI_DATETIME_TYPE;
-        break;
+    for (i = 0; i < IIDBIpstmt->descCount; i++)
+    {
+        type = IIDBIpstmt->descriptor[i]->type;
+        typeName = IIDBI_convertTypeName(type);
+        converter = IIDBI_convertLookup(self->converters, i, typeName);
+        if (!converter)
+            converter = IIDBI_convertLookup(connConverters, i, typeName);
+        if (!converter)
+            continue;
 
-    case SQL_BIT:
-#ifdef SQL_BIT_VARYING 
-    case SQL_BIT_VARYING:
-#endif
-    case SQL_LONGVARBINARY:
-    case SQL_LONGVARCHAR:
-    case SQL_BINARY:
-    case SQL_VARBINARY:
-        retType = DBI_BINARY_TYPE;
-        break;
+        mode = -1;
+        if (PyString_Check(converter))
+        {
+            for (j = 0; j < (int)(sizeof(convertModeNames) / 
+                sizeof(convertModeNames[0])); j++)
+            {
+                if (!strcmp(PyString_AS_STRING(converter), 
+                    convertModeNames[j]))
+                    mode = j;
+            }
+        }
+        else if (PyCallable_Check(converter))
+        {
+            if (!self->convertCalls)
+            {
+                self->convertCalls = PyTuple_New(IIDBIpstmt->descCount);
+                if (!self->convertCalls)
+                {
+                    *errMsg = "Could not allocate output converters";
+                    IIDBI_convertRelease(self);
+                    return -1;
+                }
+                for (j = 0; j < IIDBIpstmt->descCount; j++)
+                {
+                    Py_INCREF(Py_None);
+                    PyTuple_SET_ITEM(self->convertCalls, j, Py_None);
+                }
+            }
+            Py_INCREF(converter);
+            Py_DECREF(PyTuple_GET_ITEM(self->convertCalls, i));
+            PyTuple_SET_ITEM(self->convertCalls, i, converter);
+            mode = IIDBI_CONVERT_CALL;
+        }
+        if (mode < 0)
+        {
+            *errMsg = "Output converters must be default, string, bytes, "
+                "int, float or a callable";
+            IIDBI_convertRelease(self);
+            return -1;
+        }
 
-    default:
-        retType = DBI_UNKNOWN_TYPE;
-        break;
+        switch (type)
+        {
+        case SQL_DECIMAL:
+            break;
+
+        case SQL_FLOAT:
+        case SQL_REAL:
+        case SQL_DOUBLE:
+            if (mode == IIDBI_CONVERT_FLOAT)
+                mode = IIDBI_CONVERT_DEFAULT;
+            break;
+
+        case SQL_BIGINT:
+        case SQL_INTEGER:
+        case SQL_SMALLINT:
+        case SQL_TINYINT:
+            if (mode == IIDBI_CONVERT_INT)
+                mode = IIDBI_CONVERT_DEFAULT;
+            break;
+
+        default:
+            if (mode == IIDBI_CONVERT_INT || mode == IIDBI_CONVERT_FLOAT)
+                mode = IIDBI_CONVERT_DEFAULT;
+            break;
+        }
+        self->convertModes[i] = (unsigned char)mode;
     }
-    return retType;
+    return 0;
 }
 
 /*{
-** Name: IIDBI_cursorIterator
+** Name: IIDBI_convertRelease
 **
 ** Description:
-**     Iterator method for cursor object.
+**     Release the output converters resolved by IIDBI_convertResolve().
 **
 ** Inputs:
 **     self - cursor object.
@@ -5574,8 +14277,8 @@ int IIDBI_mapType(int type)
 **     None.
 **
 ** Returns:
-**     New reference to cursor object.
-**         
+**     void.
+**
 ** Exceptions:
 **     None.
 **
@@ -5583,788 +14286,607 @@ int IIDBI_mapType(int type)
 **     None.
 **
 ** History:
-**     26-May-06 Ralph.Loen@ingres.com
+**     16-Oct-2026 (agent)
 **         Created.
 }*/
 
-static PyObject *IIDBI_cursorIterator(IIDBI_CURSOR *self) 
+static void IIDBI_convertRelease(IIDBI_CURSOR *self)
 {
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorIterator {{{1\n", self);
-    IIDBI_handleWarning ( "DB-API extension cursor.__iter__() used",
-        NULL ) ;
-    Py_INCREF(self); 
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorIterator }}}1\n", self);
-    return ((PyObject *)self);
+    if (self->convertModes)
+        free(self->convertModes);
+    self->convertModes = NULL;
+    Py_CLEAR(self->convertCalls);
+    self->convertCount = 0;
 }
 
 /*{
-** Name: IIDBI_cursorIterNext
+** Name: IIDBI_convertLookup
 **
 ** Description:
-**     Iterator method for cursor object.  Returns a row from a
-**     previously executed select query.
+**     Find the converter of a column in a converters dictionary, by
+**     column index first and then by ODBC type name.
 **
 ** Inputs:
-**     self - cursor object. 
+**     converters - dictionary, may be NULL.
+**     column - column index, from 0.
+**     typeName - ODBC type name of the column, may be NULL.
 **
 ** Outputs:
 **     None.
 **
 ** Returns:
-**    row - a row of data from the DBMS.
+**     Borrowed reference to the converter, or NULL if there is none.
 **
 ** Exceptions:
-**    Raises PyExc_StopIteration when EOD is reached.
+**     None.
 **
 ** Side Effects:
 **     None.
 **
 ** History:
-**     26-May-06 Ralph.Loen@ingres.com
+**     16-Oct-2026 (agent)
 **         Created.
 }*/
 
-static PyObject *IIDBI_cursorIterNext(IIDBI_CURSOR *self)
+static PyObject *IIDBI_convertLookup(PyObject *converters, int column, 
+    char *typeName)
 {
-    PyObject *row = NULL;
-    PyObject *exception;
-    char *errMsg;
-    int result = FALSE;
+    PyObject *key;
+    PyObject *converter = NULL;
 
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_cursorIterNext {{{1\n", self);
-    IIDBI_handleWarning ( "DB-API extension cursor.next() used",
-        NULL ) ;
-    row = IIDBI_cursorFetch(self);
-    if (row == NULL)
+    if (!converters || !PyDict_Size(converters))
+        return NULL;
+
+    key = PyInt_FromLong((long)column);
+    if (key)
     {
-        exception = IIDBI_DatabaseError;
-        errMsg = "Error fetching rows";
-        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-        goto errorExit;
+        converter = PyDict_GetItem(converters, key);
+        Py_DECREF(key);
     }
-    if (row == Py_None)
-    {
-	Py_XDECREF(row);
-        PyErr_SetString(PyExc_StopIteration, "EOD");
-        goto errorExit;
-    }    
- 
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_iterNext }}}1\n", self);
-    
-    return (row);
+    if (!converter && typeName)
+        converter = PyDict_GetItemString(converters, typeName);
+    PyErr_Clear();
+    return converter;
+}
 
-errorExit:
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_iterNext }}}1\n", self);
-    if (result)
+/*{
+** Name: IIDBI_convertTypeName
+**
+** Description:
+**     Name of an ODBC SQL type, as used for the keys of the converters
+**     dictionaries.
+**
+** Inputs:
+**     type - ODBC SQL type.
+**
+** Outputs:
+**     None.
+**
+** Returns:
+**     Type name, or NULL for a type without one.
+**
+** Exceptions:
+**     None.
+**
+** Side Effects:
+**     None.
+**
+** History:
+**     16-Oct-2026 (agent)
+**         Created.
+}*/
+
+static char *IIDBI_convertTypeName(int type)
+{
+    switch (type)
     {
-        Py_INCREF(Py_None);
-        return Py_None;
+    case SQL_CHAR:              return "SQL_CHAR";
+    case SQL_VARCHAR:           return "SQL_VARCHAR";
+    case SQL_LONGVARCHAR:       return "SQL_LONGVARCHAR";
+    case SQL_WCHAR:             return "SQL_WCHAR";
+    case SQL_WVARCHAR:          return "SQL_WVARCHAR";
+    case SQL_WLONGVARCHAR:      return "SQL_WLONGVARCHAR";
+    case SQL_BINARY:            return "SQL_BINARY";
+    case SQL_VARBINARY:         return "SQL_VARBINARY";
+    case SQL_LONGVARBINARY:     return "SQL_LONGVARBINARY";
+    case SQL_BIT:               return "SQL_BIT";
+    case SQL_NUMERIC:           return "SQL_NUMERIC";
+    case SQL_DECIMAL:           return "SQL_DECIMAL";
+    case SQL_BIGINT:            return "SQL_BIGINT";
+    case SQL_INTEGER:           return "SQL_INTEGER";
+    case SQL_SMALLINT:          return "SQL_SMALLINT";
+    case SQL_TINYINT:           return "SQL_TINYINT";
+    case SQL_FLOAT:             return "SQL_FLOAT";
+    case SQL_REAL:              return "SQL_REAL";
+    case SQL_DOUBLE:            return "SQL_DOUBLE";
+    case SQL_TYPE_DATE:         return "SQL_TYPE_DATE";
+    case SQL_TYPE_TIME:         return "SQL_TYPE_TIME";
+    case SQL_TYPE_TIMESTAMP:    return "SQL_TYPE_TIMESTAMP";
+    default:                    return NULL;
     }
-    return NULL;
 }
 
 /*{
-** Name: IIDBI_handleError
+** Name: IIDBI_convertColumn
 **
 ** Description:
-**      Raise an error if self->errorhandler is NULL.  If self->errorhandler
-**      is non-NULL, execute the errorhandler routine and return.  Populate
-**      self->messages with error information.
+**     Convert a result column with its output converter, in place of the
+**     usual conversion of IIDBI_cursorBuildRow(). The string form of a
+**     column is its str, or the UTF-8 encoding of a unicode column, or
+**     the raw SQLWCHAR bytes in bytes mode. Dates and times are formatted
+**     as "YYYY-MM-DD", "HH:MM:SS" and "YYYY-MM-DD HH:MM:SS[.ffffff]".
 **
 ** Inputs:
-**     self - connection or cursor object.
+**     descriptor - column, not null.
+**     mode - IIDBI_CONVERT_xxx mode, not IIDBI_CONVERT_DEFAULT.
+**     call - callable for IIDBI_CONVERT_CALL.
 **
 ** Outputs:
 **     None.
 **
 ** Returns:
-**     TRUE if self->errorhandler is non-NULL, FALSE otherwise.
+**     New reference, NULL on error.
 **
 ** Exceptions:
-**     None.    
+**     Any raised by the callable.
 **
 ** Side Effects:
-**     None.
+**     Takes the string a LONG column was read into.
 **
 ** History:
-**     26-May-06 Ralph.Loen@ingres.com
+**     16-Oct-2026 (agent)
 **         Created.
+**     17-Oct-2026 (agent)
+**         Read TINYINT values as signed, as they are bound.
 }*/
 
-int IIDBI_handleError(PyObject *self, PyObject *exception, char *errMsg)
+static PyObject *IIDBI_convertColumn(IIDBI_DESCRIPTOR *descriptor, int mode,
+    PyObject *call)
 {
-    PyObject  *errTuple;
-    IIDBI_CONNECTION *conn = NULL;
-    IIDBI_CURSOR *cursor = NULL;
-    PyObject *calledObj = NULL;
-    PyObject *args = NULL; 
-  
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_handleError {{{1\n", self);
+    SQL_TIMESTAMP_STRUCT *ts;
+    ODBCINT64 n = 0;
+    char buf[IIDBI_DECIMAL_STRING_SIZE];
+    char *p;
+    PyObject *value = NULL;
+    PyObject *result;
 
-    if (self && PyObject_TypeCheck(self, &IIDBI_connectType))
-        conn = (IIDBI_CONNECTION *)self;
-    else
-        cursor = (IIDBI_CURSOR *)self;
-     
-    errTuple = Py_BuildValue("Os", exception, errMsg);
-    if (conn)
-       PyList_Append( conn->messages, errTuple);
-    else
-       PyList_Append( cursor->messages, errTuple);
-    Py_XDECREF(errTuple);
+    switch (descriptor->type)
+    {
+    case SQL_BIGINT:
+        n = *(ODBCINT64 *)descriptor->data;
+        break;
 
-    if (conn && conn->errorhandler != Py_None)
+    case SQL_INTEGER:
+        n = *(SQLINTEGER *)descriptor->data;
+        break;
+
+    case SQL_SMALLINT:
+        n = *(SQLSMALLINT *)descriptor->data;
+        break;
+
+    case SQL_TINYINT:
+        n = *(SQLSCHAR *)descriptor->data;
+        break;
+    }
+
+    if (mode == IIDBI_CONVERT_INT)
     {
-        args = Py_BuildValue("OOOs",self, Py_None, exception, errMsg);
-        if (args)
-        {
-            calledObj = PyEval_CallObject(conn->errorhandler, args);
-            Py_XDECREF(args);
-            if (calledObj)
-            {               
-                Py_XDECREF(calledObj);
-                goto handler_exit;
-            }
-            else
-            {
-                exception = IIDBI_ProgrammingError;
-                errMsg = "Usage: connection.errorhandler(connection, cursor, exception, errMsg)";
-            }
-        }
-        else
-        {
-            exception = IIDBI_InternalError;
-            errMsg = "Could not build internal arguments from connection.errorhandler()";
-        }
+        if (descriptor->type == SQL_DECIMAL)
+            return IIDBI_convertScaled(descriptor);
+        value = PyFloat_FromDouble(*(double *)descriptor->data);
+        if (!value)
+            return NULL;
+        result = PyNumber_Int(value);
+        Py_DECREF(value);
+        return result;
+    }
+    if (mode == IIDBI_CONVERT_FLOAT)
+    {
+        if (descriptor->type == SQL_DECIMAL)
+            return IIDBI_decimalFromChar(descriptor->data, 
+                IIDBI_DECIMAL_FLOAT);
+        return PyFloat_FromDouble((double)n);
     }
-    else if (cursor && cursor->errorhandler != Py_None)
+
+    switch (descriptor->type)
     {
-        args = Py_BuildValue("OOOs",cursor->connection, 
-            cursor, exception, errMsg);
-        if (args)
+    case SQL_BIGINT:
+    case SQL_INTEGER:
+    case SQL_SMALLINT:
+    case SQL_TINYINT:
+        PyOS_snprintf(buf, sizeof(buf), "%" PY_FORMAT_LONG_LONG "d", 
+            (PY_LONG_LONG)n);
+        value = PyString_FromString(buf);
+        break;
+
+    case SQL_FLOAT:
+    case SQL_REAL:
+    case SQL_DOUBLE:
+        p = PyOS_double_to_string(*(double *)descriptor->data, 'r', 0, 0, 
+            NULL);
+        if (!p)
+            return NULL;
+        value = PyString_FromString(p);
+        PyMem_Free(p);
+        break;
+
+    case SQL_TYPE_DATE:
+    case SQL_DATE:
+        ts = (SQL_TIMESTAMP_STRUCT *)descriptor->data;
+        PyOS_snprintf(buf, sizeof(buf), "%04d-%02d-%02d", (int)ts->year,
+            (int)ts->month, (int)ts->day);
+        value = PyString_FromString(buf);
+        break;
+
+    case SQL_TYPE_TIME:
+    case SQL_TIME:
+        ts = (SQL_TIMESTAMP_STRUCT *)descriptor->data;
+        PyOS_snprintf(buf, sizeof(buf), "%02d:%02d:%02d", (int)ts->hour,
+            (int)ts->minute, (int)ts->second);
+        value = PyString_FromString(buf);
+        break;
+
+    case SQL_TYPE_TIMESTAMP:
+    case SQL_TIMESTAMP:
+        ts = (SQL_TIMESTAMP_STRUCT *)descriptor->data;
+        PyOS_snprintf(buf, sizeof(buf), "%04d-%02d-%02d %02d:%02d:%02d", 
+            (int)ts->year, (int)ts->month, (int)ts->day, (int)ts->hour,
+            (int)ts->minute, (int)ts->second);
+        if (ts->fraction)
+            PyOS_snprintf(buf + strlen(buf), sizeof(buf) - strlen(buf), 
+                ".%06lu", (unsigned long)ts->fraction);
+        value = PyString_FromString(buf);
+        break;
+
+    case SQL_WCHAR:
+    case SQL_WVARCHAR:
+    case SQL_WLONGVARCHAR:
+        if (mode == IIDBI_CONVERT_BYTES)
         {
-            calledObj = PyEval_CallObject(cursor->errorhandler, args);
-            Py_XDECREF(args);
-            if (calledObj)
-            {
-                 Py_XDECREF(calledObj);
-                 goto handler_exit;
-            }
-            else
-            {
-                exception = IIDBI_ProgrammingError;
-                errMsg = "Usage: cursor.errorhandler(connection, cursor, exception, errMsg)";
-            }
+            value = PyString_FromStringAndSize(descriptor->data, 
+                (Py_ssize_t)descriptor->orInd);
+            break;
         }
-        else
+        result = PyUnicode_FromWideChar((const wchar_t *)descriptor->data, 
+            (Py_ssize_t)descriptor->orInd/sizeof(SQLWCHAR));
+        if (!result)
+            return NULL;
+        value = PyUnicode_AsUTF8String(result);
+        Py_DECREF(result);
+        break;
+
+    case SQL_DECIMAL:
+        value = PyString_FromString(descriptor->data);
+        break;
+
+    case SQL_LONGVARCHAR:
+    case SQL_LONGVARBINARY:
+        if (descriptor->lobObject)
         {
-            exception = IIDBI_InternalError;
-            errMsg = "Could not build internal arguments from cursor.errorhandler()";
+            value = descriptor->lobObject;
+            descriptor->lobObject = NULL;
+            if (PyString_GET_SIZE(value) != descriptor->precision)
+                _PyString_Resize(&value, descriptor->precision);
         }
-    }
-    if (calledObj != Py_None) 
-    {
-        DBPRINTF(DBI_TRC_STAT)("%p: IIDBI_handleError ERROR: %s\n", self, errMsg);
-
-        PyErr_SetString(exception, errMsg);
+        else
+            value = PyString_FromStringAndSize(descriptor->data, 
+                descriptor->precision);
+        break;
 
-        DBPRINTF(DBI_TRC_RET)("%p: IIDBI_handleError }}}1\n", self);
-        return FALSE;
+    default:
+        value = PyString_FromStringAndSize(descriptor->data,
+            (Py_ssize_t)descriptor->orInd);
+        break;
     }
 
-handler_exit:
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_handleError }}}1\n", self);
-    return TRUE;
+    if (value && mode == IIDBI_CONVERT_CALL)
+    {
+        result = PyObject_CallFunctionObjArgs(call, value, NULL);
+        Py_DECREF(value);
+        value = result;
+    }
+    return value;
 }
 
 /*{
-** Name: IIDBI_handleWarning
+** Name: IIDBI_convertScaled
 **
 ** Description:
-**     Raise a warning exception and optionally populate self->messages with
-**     warning information.
+**     Convert a DECIMAL column to the integer holding its digits at the
+**     scale of the column, so 12.5 in a DECIMAL(10,2) column becomes
+**     1250. Strings other than plain decimals go through Decimal.
 **
 ** Inputs:
-**     self - connection or cursor object.
+**     descriptor - DECIMAL column, not null.
 **
 ** Outputs:
 **     None.
 **
 ** Returns:
-**     Void.    
+**     New reference to an int or long, NULL on error.
 **
 ** Exceptions:
-**     None.    
+**     None.
 **
 ** Side Effects:
 **     None.
 **
 ** History:
-**     26-May-06 Ralph.Loen@ingres.com
+**     16-Oct-2026 (agent)
 **         Created.
 }*/
 
-void IIDBI_handleWarning(char *errMsg, PyObject *messages)
+static PyObject *IIDBI_convertScaled(IIDBI_DESCRIPTOR *descriptor)
 {
-    PyObject  *errTuple;
-
-    DBPRINTF(DBI_TRC_RET)("IIDBI_handleWarning {{{1\n");
-
-    PyErr_Warn( PyExc_Warning, errMsg ) ;
-
-    if (messages)
+    char digits[IIDBI_DECIMAL_STRING_SIZE + 1];
+    char *p = descriptor->data;
+    int nDigits = 0;
+    int frac = 0;
+    int seen = FALSE;
+    int inFraction = FALSE;
+    PyObject *value;
+    PyObject *scaled;
+
+    while (*p == ' ')
+        p++;
+    if (*p == '-' || *p == '+')
+    {
+        if (*p == '-')
+            digits[nDigits++] = '-';
+        p++;
+    }
+    for (; *p; p++)
+    {
+        if (isdigit((unsigned char)*p))
+        {
+            if (nDigits == IIDBI_DECIMAL_STRING_SIZE)
+                break;
+            digits[nDigits++] = *p;
+            if (inFraction)
+                frac++;
+            seen = TRUE;
+        }
+        else if ((*p == '.' || *p == ',') && !inFraction)
+            inFraction = TRUE;
+        else
+            break;
+    }
+    while (*p == ' ')
+        p++;
+    while (frac < descriptor->scale && nDigits < IIDBI_DECIMAL_STRING_SIZE)
     {
-        errTuple = Py_BuildValue("Os",PyExc_Warning, errMsg);
-        PyList_Append( messages, errTuple);
-        Py_DECREF(errTuple);
+        digits[nDigits++] = '0';
+        frac++;
     }
+    digits[nDigits] = '\0';
 
-    DBPRINTF(DBI_TRC_RET)("IIDBI_handleWarning }}}1\n");
+    if (!*p && seen && frac == descriptor->scale)
+        return PyInt_FromString(digits, NULL, 10);
+
+    value = IIDBI_decimalFromChar(descriptor->data, IIDBI_DECIMAL_DECIMAL);
+    if (!value)
+        return NULL;
+    scaled = PyObject_CallMethod(value, "scaleb", "i", descriptor->scale);
+    Py_DECREF(value);
+    if (!scaled)
+        return NULL;
+    value = PyNumber_Int(scaled);
+    Py_DECREF(scaled);
+    return value;
 }
 
 /*{
-** Name: IIDBI_clearMessages
+** Name: IIDBI_fetchColumnPut
 **
 ** Description:
-**     Clear the message queue.
+**     Append the value of a numeric column of the current row to the
+**     C values collected for cursor.fetchcolumns().
 **
 ** Inputs:
-**     messages - a list of cursor or connection error and warning messages.
+**     column - column being collected, typecode set.
+**     descriptor - column of the current row, not null.
 **
 ** Outputs:
 **     None.
 **
 ** Returns:
-**     Void.    
+**     0 on success, -1 if the values could not be grown.
 **
 ** Exceptions:
-**     None.    
+**     MemoryError.
 **
 ** Side Effects:
 **     None.
 **
 ** History:
-**     26-May-06 Ralph.Loen@ingres.com
+**     16-Oct-2026 (agent)
 **         Created.
+**     17-Oct-2026 (agent)
+**         Read TINYINT values as signed, as they are bound.
 }*/
 
-void IIDBI_clearMessages(PyObject *messages)
+static int IIDBI_fetchColumnPut(IIDBI_FETCHCOLUMN *column, 
+    IIDBI_DESCRIPTOR *descriptor)
 {
-    int count;
+    size_t itemSize = column->typecode == 'd' ? sizeof(double) : 
+        sizeof(long);
+    char *data;
+    long value = 0;
 
-    DBPRINTF(DBI_TRC_RET)("IIDBI_clearMessages {{{1\n");
+    if (column->count == column->size)
+    {
+        data = realloc(column->data, column->size * 2 * itemSize);
+        if (!data)
+        {
+            PyErr_NoMemory();
+            return -1;
+        }
+        column->data = data;
+        column->size *= 2;
+    }
 
-    count = PyList_Size(messages);
+    if (column->typecode == 'd')
+    {
+        ((double *)column->data)[column->count++] = 
+            *(double *)descriptor->data;
+        return 0;
+    }
 
-    if (count)
-        PySequence_DelSlice(messages, 0, count);
+    switch (descriptor->type)
+    {
+    case SQL_BIGINT:
+        value = (long)*(ODBCINT64 *)descriptor->data;
+        break;
 
-    DBPRINTF(DBI_TRC_RET)("IIDBI_clearMessages }}}1\n");
+    case SQL_INTEGER:
+        value = (long)*(SQLINTEGER *)descriptor->data;
+        break;
+
+    case SQL_SMALLINT:
+        value = (long)*(SQLSMALLINT *)descriptor->data;
+        break;
+
+    case SQL_TINYINT:
+        value = (long)*(SQLSCHAR *)descriptor->data;
+        break;
+    }
+    ((long *)column->data)[column->count++] = value;
+    return 0;
 }
 
 /*{
-** Name: IIDBI_checkBoolean
+** Name: IIDBI_fetchColumnList
 **
 ** Description:
-**     Evaluate argument and return TRUE or FALSE.  
+**     Move the C values collected for a numeric column into a list,
+**     done when the column turns out to hold a NULL.
 **
 ** Inputs:
-**     arg - argument string.
+**     column - column being collected, typecode set.
 **
 ** Outputs:
 **     None.
 **
 ** Returns:
-**     TRUE if first character is "y" or string evaluates to "ON".
-**     FALSE otherwise.
+**     0 on success, -1 on error.
 **
 ** Exceptions:
-**     None.     
+**     None.
 **
 ** Side Effects:
-**     None.
+**     The column is collected in its list from now on.
 **
 ** History:
-**     26-May-06 Ralph.Loen@ingres.com
+**     16-Oct-2026 (agent)
 **         Created.
 }*/
 
-int checkBooleanArg(char *arg)
+static int IIDBI_fetchColumnList(IIDBI_FETCHCOLUMN *column)
 {
-    int i;
-    int result;
+    PyObject *list;
+    PyObject *item;
+    Py_ssize_t i;
 
-    for (i = 0; i < (int)strlen(arg); i++)
+    list = PyList_New(column->count);
+    if (!list)
+        return -1;
+    for (i = 0; i < column->count; i++)
     {
-        result = toupper(arg[i]);
-        arg[i] = result;
+        if (column->typecode == 'd')
+            item = PyFloat_FromDouble(((double *)column->data)[i]);
+        else
+            item = PyInt_FromLong(((long *)column->data)[i]);
+        if (!item)
+        {
+            Py_DECREF(list);
+            return -1;
+        }
+        PyList_SET_ITEM(list, i, item);
     }
-    if (!strcmp(arg, "ON") || arg[0] == 'Y')
-        return TRUE;
-    else
-        return FALSE;
+    free(column->data);
+    column->data = NULL;
+    column->typecode = 0;
+    column->list = list;
+    return 0;
 }
 
 /*{
-** Name: IIDBI_connCleanup
+** Name: IIDBI_fetchColumnResult
 **
 ** Description:
-**     Deallocate connection object resources and mark closed.
+**     Return a column collected by cursor.fetchcolumns(): an array.array
+**     made from its C values, or its list.
 **
 ** Inputs:
-**     self - connection object.
+**     column - collected column.
 **
 ** Outputs:
 **     None.
 **
 ** Returns:
-**    Void.     
+**     New reference, NULL on error.
 **
 ** Exceptions:
-**    None.     
+**     None.
 **
 ** Side Effects:
 **     None.
 **
 ** History:
-**     26-May-06 Ralph.Loen@ingres.com
+**     16-Oct-2026 (agent)
 **         Created.
 }*/
 
-void IIDBI_connCleanup(IIDBI_CONNECTION * self)
+static PyObject *IIDBI_fetchColumnResult(IIDBI_FETCHCOLUMN *column)
 {
-    IIDBI_DBC *IIDBIpdbc = self->IIDBIpdbc;
-
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_connCleanup {{{1\n", self);
-
-    self->closed = TRUE;
-
-    if (self->IIDBIpdbc) 
-    {
-        Py_BEGIN_ALLOW_THREADS
-        dbi_connectionRollback(IIDBIpdbc);
-        Py_END_ALLOW_THREADS
-
-        Py_BEGIN_ALLOW_THREADS
-        dbi_connectionClose(IIDBIpdbc);
-        Py_END_ALLOW_THREADS
-    }
-
-    if (self->dsn)
-    {
-        free(self->dsn);
-        self->dsn = NULL;
-    }
-    if (self->uid)
-    {
-        free(self->uid);
-        self->uid = NULL;
-    }
-    if (self->pwd)
-    {	   
-        free(self->pwd);
-	self->pwd = NULL;
-    }
-
-    if (self->database)
-    {
-        free(self->database);
-	self->database=NULL;
-    }
-
-    if (self->vnode)
-    {	    
-        free(self->vnode);
-	self->vnode = NULL;
-    }
-    if (self->servertype)
-    {
-        free(self->servertype);
-	self->servertype = NULL;
-    }
-
-    if (self->driver)
-    {
-        free(self->driver);
-	self->driver = NULL;
-    }
- 
-    if (self->group)
-    {
-        free(self->group);
-        self->group = NULL;
-    }
-  
-    if (self->dbms_pwd)
-    {
-        free(self->dbms_pwd);
-	self->dbms_pwd = NULL;
-    }
-  
-    if (self->rolename)
-    {
-        free(self->rolename);
-	self->rolename = NULL;
-    }
-  
-    if (self->rolepwd)
-    {
-        free(self->rolepwd);
-	self->rolepwd = NULL;
-    }
-  
-    if (self->connectstr)
-    {
-        free(self->connectstr);
-	self->connectstr = NULL;
-    }
-    
-    IIDBI_clearMessages(self->messages);
-
-    self->trace = 0;
-
-    if (self->IIDBIpdbc)
+    if (!column->typecode)
     {
-        free(self->IIDBIpdbc);
-        self->IIDBIpdbc = NULL;
+        Py_INCREF(column->list);
+        return column->list;
     }
-
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_connCleanup }}}1\n", self);
+    return PyObject_CallFunction(arrayType, "cs#", column->typecode, 
+        column->data, (int)(column->count * (column->typecode == 'd' ? 
+        sizeof(double) : sizeof(long))));
 }
 
 /*{
-** Name: IIDBI_sendParameters
+** Name: IIDBI_fetchColumnFree
 **
 ** Description:
-**     Prepare input parameters for execution.
+**     Free the columns collected by cursor.fetchcolumns().
 **
 ** Inputs:
-**     self - cursor object. 
-**     params - sequence of parameter data.
+**     columns - collected columns.
+**     count - number of columns.
 **
 ** Outputs:
 **     None.
 **
 ** Returns:
-**     None.         
+**     void.
 **
 ** Exceptions:
-**     Params must be in sequence format with a size greater than zero. 
-**     A parameter descriptor must be successfully allocated.
+**     None.
 **
 ** Side Effects:
 **     None.
 **
 ** History:
-**     26-May-06 Ralph.Loen@ingres.com
+**     16-Oct-2026 (agent)
 **         Created.
 }*/
 
-int IIDBI_sendParameters(IIDBI_CURSOR *self, PyObject *params)
+static void IIDBI_fetchColumnFree(IIDBI_FETCHCOLUMN *columns, int count)
 {
-    PyObject *exception;
-    char *errMsg;
-    int result=0;
-    int rc=0;
-    int parmCount;
     int i;
-    int len;
-    PyObject *elem = NULL;
-    IIDBI_DESCRIPTOR **parameter=NULL;
-    SQL_TIME_STRUCT *tm=NULL;
-    SQL_DATE_STRUCT *date=NULL;
-    SQL_TIMESTAMP_STRUCT *ts=NULL;
-    SQLWCHAR *unicodeStr=NULL;
-    Py_ssize_t tmplength=0;
-    IIDBI_STMT *IIDBIpstmt = self->IIDBIpstmt;
-    void *data;
-
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_sendParameters {{{1\n", self);
-    if (!PySequence_Check(params))
-    {
-        exception = IIDBI_InterfaceError; 
-        errMsg = "parameters must be in sequence format";
-        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-        goto errorExit;
-    }
-    parmCount = PySequence_Size( params );
-    if (parmCount == -1)
-    {
-        Py_XDECREF(params);
-        exception = IIDBI_InternalError; 
-        errMsg = "could not determine parameter count";
-        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-        goto errorExit;
-    }
-
-    if (!parmCount)
-    {
-        Py_XDECREF(params);
-        exception = IIDBI_OperationalError; 
-        errMsg = "cursor.execute() specified parameters, but the parameter count is zero";
-        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-        goto errorExit;
-    }
 
-    IIDBIpstmt->parmCount = parmCount;
-
-    rc = dbi_allocDescriptor(IIDBIpstmt, parmCount, 1);
-    if (rc != DBI_SQL_SUCCESS)
+    for (i = 0; i < count; i++)
     {
-        Py_XDECREF(params);
-        exception = IIDBI_OperationalError;
-        errMsg = "could not allocate descriptor";
-        result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-        goto errorExit;
+        if (columns[i].data)
+            free(columns[i].data);
+        Py_XDECREF(columns[i].list);
     }
-
-    parameter = IIDBIpstmt->parameter;
-    for (i = 0; i < parmCount; i++)
-    {
-        elem = PySequence_GetItem(params, i);
-        if (!elem)
-        {
-            Py_XDECREF(params);
-            exception = IIDBI_InternalError;
-            errMsg = "failed to retrieve input parameter sequence";
-            result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-            goto errorExit;
-        }
-
-        if (PyInt_Check(elem)) 
-        {
-            if (!parameter[i]->data)
-                parameter[i]->data = (int *)calloc(1,sizeof(int));
-            *(int *)parameter[i]->data = PyInt_AsLong(elem);
-            parameter[i]->type = SQL_INTEGER;
-            parameter[i]->cType = SQL_C_LONG;
-            parameter[i]->precision = sizeof(int);
-            parameter[i]->scale = 0;
-            parameter[i]->orInd = 0;
-            parameter[i]->isNull = 0;
-        }
-        else if (PyLong_Check(elem)) 
-        {
-            if (!parameter[i]->data)
-                parameter[i]->data = 
-                    (ODBCINT64 *)calloc(1,sizeof(ODBCINT64));
-            *(ODBCINT64 *)parameter[i]->data = PyLong_AsLongLong(elem);
-            parameter[i]->type = SQL_BIGINT;
-            parameter[i]->cType = SQL_C_SBIGINT;
-            parameter[i]->precision = 0;
-            parameter[i]->scale = 0;
-            parameter[i]->orInd = 0;
-            parameter[i]->isNull = 0;
-        }
-        else if (PyFloat_Check(elem)) 
-        {
-            if (!parameter[i]->data)
-                parameter[i]->data = (double *)calloc(1,sizeof(double));
-            *(double *)parameter[i]->data = PyFloat_AsDouble(elem);
-            parameter[i]->type = SQL_DOUBLE;
-            parameter[i]->cType = SQL_C_DOUBLE;
-            parameter[i]->precision = 8;
-            parameter[i]->scale = 0;
-            parameter[i]->orInd = 0;
-            parameter[i]->isNull = 0;
-        }
-        else if (PyString_Check(elem)) 
-        {
-            parameter[i]->data = PyString_AsString(elem);
-            parameter[i]->type = SQL_VARCHAR;
-            parameter[i]->cType = SQL_C_CHAR;
-            parameter[i]->precision = 
-                (int)strlen((char *)parameter[i]->data);
-            parameter[i]->scale = 0;
-            parameter[i]->orInd = PyString_Size(elem);
-            parameter[i]->isNull = 0;
-        }
-        else if (PyUnicode_Check(elem)) 
-        {
-            int tmpUniStrLen=0;
-            tmpUniStrLen = PyUnicode_GetSize(elem);
-            if (PyErr_Occurred())
-            {
-                exception = IIDBI_InterfaceError;
-                errMsg = "length check failed on Unicode string";
-                DBPRINTF(DBI_TRC_STAT)("ERROR: %s\n", errMsg);
-                result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-                goto errorExit;
-            }
-            parameter[i]->orInd = tmpUniStrLen;
-            parameter[i]->orInd = parameter[i]->orInd * sizeof(SQLWCHAR); /* byte length */
-            parameter[i]->internalSize = parameter[i]->orInd; /* NOTE unlike get/fetch no +1 (sizeof(SQLWCHAR)) null terminator */
-            parameter[i]->type = SQL_WVARCHAR;
-            parameter[i]->cType = SQL_C_WCHAR;
-            parameter[i]->precision = tmpUniStrLen;
-            parameter[i]->scale = 0;
-            parameter[i]->isNull = 0;
-
-
-            unicodeStr = malloc(parameter[i]->internalSize);
-            if (unicodeStr == NULL)
-            {
-                exception = IIDBI_InterfaceError;
-                errMsg = "Unable to allocate internal Unicode string to send to server";
-                DBPRINTF(DBI_TRC_STAT)("%s\n", errMsg);
-                result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-                goto errorExit;
-            }
-            tmplength=PyUnicode_AsWideChar(PyUnicode_FromObject(elem), unicodeStr, PyUnicode_GetSize(elem)); /* FIXME compile warnings */
-            /* tmplength=PyUnicode_AsWideChar(elem, unicodeStr, PyUnicode_GetSize(elem)); ** FIXME compile warnings */
-            if (tmplength == -1 || PyErr_Occurred())
-            {
-                exception = IIDBI_InterfaceError;
-                errMsg = "Unable to copy Python string into internal Unicode string";
-                DBPRINTF(DBI_TRC_STAT)("%s\n", errMsg);
-                result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-                goto errorExit;
-            }
-            parameter[i]->data = unicodeStr;
-        }
-        else if (PyBuffer_Check(elem)) 
-        {
-            if (!PyObject_CheckReadBuffer( elem ) )
-            {
-                exception = IIDBI_InternalError; 
-                errMsg = "Read buffer is not contiguous";
-                result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-                goto errorExit;
-            }
-            if (PyObject_AsReadBuffer( elem, (const void **)&data, &len )
-               == -1 )
-            {
-                exception = IIDBI_InternalError; 
-                errMsg = "Could not convert buffer object to pointer";
-                result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-                goto errorExit;
-            }
-            parameter[i]->type = SQL_LONGVARBINARY;
-            parameter[i]->cType = SQL_C_BINARY;
-            parameter[i]->orInd = SQL_NTS;
-            parameter[i]->data = data;
-            parameter[i]->precision = len;
-            parameter[i]->scale = 0;
-            parameter[i]->isNull = 0;
-        }
-        else if (elem == Py_None)
-        {
-            parameter[i]->isNull = 1;
-            parameter[i]->data = NULL;
-            parameter[i]->type = SQL_TYPE_NULL; /* UNDOCUMENTED Ingres extension - the NULL type */
-            parameter[i]->cType = SQL_C_CHAR; /* Have to have something, Microsoft ODBC manager won't accept 0, Ingres CLI does though */
-            parameter[i]->precision = 0;
-            parameter[i]->scale = 0;
-            parameter[i]->orInd = 0;
-        }
-        else if (PyDateTime_Check(elem))
-        {
-            parameter[i]->isNull = 0;
-            ts = malloc(sizeof(SQL_TIMESTAMP_STRUCT));
-            ts->year = PyDateTime_GET_YEAR(elem);
-            ts->month = PyDateTime_GET_MONTH(elem);
-            ts->day = PyDateTime_GET_DAY(elem);
-            ts->hour = PyDateTime_DATE_GET_HOUR(elem);
-            ts->minute = PyDateTime_DATE_GET_MINUTE(elem);
-            ts->second = PyDateTime_DATE_GET_SECOND(elem);
-        ts->fraction = 0;
-            parameter[i]->data = ts;
-            parameter[i]->type = SQL_TYPE_TIMESTAMP;
-            parameter[i]->cType = SQL_C_TYPE_TIMESTAMP;
-            parameter[i]->precision = 0;
-            parameter[i]->scale = 0;
-            parameter[i]->orInd = 0;
-        }
-        else if (PyDate_Check(elem))
-        {
-            parameter[i]->isNull = 0;
-            date = malloc(sizeof(SQL_DATE_STRUCT));
-            date->year = PyDateTime_GET_YEAR(elem);
-            date->month = PyDateTime_GET_MONTH(elem);
-            date->day = PyDateTime_GET_DAY(elem);
-            parameter[i]->data = date;
-            parameter[i]->type = SQL_TYPE_DATE;
-            parameter[i]->cType = SQL_C_TYPE_DATE;
-            parameter[i]->precision = 0;
-            parameter[i]->scale = 0;
-            parameter[i]->orInd = 0;
-        }
-        else if (PyTime_Check(elem))
-        {
-            parameter[i]->isNull = 0;
-            tm = malloc(sizeof(SQL_TIME_STRUCT));
-            tm->hour = PyDateTime_TIME_GET_HOUR(elem);
-            tm->minute = PyDateTime_TIME_GET_MINUTE(elem);
-            tm->second = PyDateTime_TIME_GET_SECOND(elem);
-            parameter[i]->data = tm;
-            parameter[i]->type = SQL_TYPE_TIME;
-            parameter[i]->cType = SQL_C_TYPE_TIME;
-            parameter[i]->precision = 0;
-            parameter[i]->scale = 0;
-            parameter[i]->orInd = 0;
-        }
-        else if (PyObject_IsInstance(elem, decimalType))
-        {
-            char *decimal = NULL;
-            char *tmp_str = NULL;
-            parameter[i]->data = 
-                strdup(PyString_AsString(PyObject_Str(elem)));
-            if (parameter[i]->data == NULL)
-            {
-                Py_XDECREF(params);
-                exception = IIDBI_InternalError;
-                errMsg = "strdup returned NULL";
-                result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-                goto errorExit;
-            }
-            parameter[i]->type = SQL_DECIMAL;
-            parameter[i]->cType = SQL_C_CHAR;
-            parameter[i]->internalSize = (int)strlen((char *)parameter[i]->data) + 1; /* +1 for NULL terminator */
-            tmp_str = (char *)parameter[i]->data;
-            /* Ignore leading signs and leading zeros */
-            while (*tmp_str!='\0' && (*tmp_str=='-' || *tmp_str=='0')) /* check for '+' too? Not seen one before */
-            {
-                tmp_str++;
-            }
-            parameter[i]->precision = (int)strlen(tmp_str);
-            decimal = strstr(parameter[i]->data,".");
-            if (!decimal)
-                decimal = strstr(parameter[i]->data, ",");
-            if (decimal)
-            {
-                decimal++;
-                parameter[i]->precision--; /* do not count decimal seperator as part of precision */
-            }
-            if (decimal)
-                parameter[i]->scale = (int)strlen(decimal);
-            else
-                 parameter[i]->scale = 0;
-            parameter[i]->orInd = SQL_NTS;
-            parameter[i]->isNull = 0;
-        } 
-        else 
-        {
-            Py_XDECREF(params);
-            exception = IIDBI_InternalError;
-            errMsg = "unknown python parameter type";
-            result = IIDBI_handleError((PyObject *)self, exception, errMsg);
-            goto errorExit;
-        }
-        Py_DECREF(elem);
-        DBPRINTF(DBI_TRC_STAT)("For bind %d, type is %d (cType is %d), precision is %d, scale is %d internal size is %d and nullable is %d\n", i, parameter[i]->type, parameter[i]->cType, parameter[i]->precision, parameter[i]->scale, parameter[i]->internalSize, parameter[i]->isNull);
-    } /* for (i = 0; i < parmCount; i++) */
-
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_sendParameters }}}1\n", self);
-    return DBI_SQL_SUCCESS;
-
-errorExit:
-    Py_XDECREF(elem);
-    DBPRINTF(DBI_TRC_STAT)("%p: IIDBI_sendParameters errorExit\n", self);
-    DBPRINTF(DBI_TRC_RET)("%p: IIDBI_sendParameters }}}1\n", self);
-    if (result)
-        return DBI_SQL_SUCCESS_WITH_INFO;
-    else
-        return DBI_SQL_ERROR;
+    free(columns);
 }
 
 /*{
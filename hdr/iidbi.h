@@ -75,6 +75,86 @@
 **          two long object names in it will truncate very quickly.
 **          This is a temp fix until IIDBI_ERROR struct can be updated
 **          with size indicator and a dynamic buffer be used instead.
+**      16-Oct-2026 (agent)
+**          Added rowset (block fetch) fields to IIDBI_DESCRIPTOR and
+**          IIDBI_STMT.
+**      16-Oct-2026 (agent)
+**          Added IIDBI_MAX_PRESIZE.
+**      16-Oct-2026 (agent)
+**          Added iterWarned and nextWarned cursor fields and
+**          IIDBI_ITER_ROWSET.
+**      16-Oct-2026 (agent)
+**          Added parameter array fields to IIDBI_STMT and
+**          IIDBI_PARAMSET_SIZE.
+**      16-Oct-2026 (agent)
+**          Added isBound to IIDBI_DESCRIPTOR and keepParameters to
+**          IIDBI_STMT.
+**      16-Oct-2026 (agent)
+**          Added the per-connection prepared statement cache,
+**          IIDBI_CACHED_STMT and IIDBI_STMT_CACHE_SIZE.
+**      16-Oct-2026 (agent)
+**          Added the per-connection pool of free statement handles and
+**          IIDBI_STMT_POOL_SIZE.
+**      16-Oct-2026 (agent)
+**          Added colsBound to IIDBI_STMT and the SQLGetData() extensions
+**          to IIDBI_DBC.
+**      16-Oct-2026 (agent)
+**          Added the LOB streaming fields to IIDBI_STMT and IIDBI_CURSOR,
+**          and the IIDBI_LOBREADER object.
+**      16-Oct-2026 (agent)
+**          Added IIDBI_PUTSTREAM and IIDBI_PUTSOURCE for LOB parameters
+**          read from file-like objects and iterators.
+**      16-Oct-2026 (agent)
+**          Added lobObject to IIDBI_DESCRIPTOR.
+**      16-Oct-2026 (agent)
+**          Added the IIDBI_DECIMAL_xxx modes and decimalMode to
+**          IIDBI_CONNECTION.
+**      16-Oct-2026 (agent)
+**          Added the IIDBI_CONVERT_xxx output converter modes and the
+**          converter registries of IIDBI_CONNECTION and IIDBI_CURSOR.
+**      16-Oct-2026 (agent)
+**          Added IIDBI_FETCHCOLUMN and IIDBI_FETCHCOLUMN_SIZE.
+**      16-Oct-2026 (agent)
+**          Added the IIDBI_COLUMNBUFFER object.
+**      16-Oct-2026 (agent)
+**          Added IIDBI_PARAMCOLUMN and rowsetBorrowed to IIDBI_DESCRIPTOR.
+**      16-Oct-2026 (agent)
+**          Added the IIDBI_PARAM_xxx parameter kinds and the parameter kind
+**          cache of IIDBI_CURSOR.
+**      16-Oct-2026 (agent)
+**          Added the parameter arena to IIDBI_STMT and
+**          IIDBI_PARAM_SLOT_SIZE.
+**      16-Oct-2026 (agent)
+**          Added the wide character parameter buffer to IIDBI_STMT and
+**          IIDBI_WIDE_UNITS.
+**      16-Oct-2026 (agent)
+**          Added IIDBI_PREFETCH and the prefetch fields of IIDBI_STMT and
+**          IIDBI_CURSOR.
+**      16-Oct-2026 (agent)
+**          Added the IIDBI_ASYNCEXEC object and the asyncExec cursor and
+**          asyncPending connection fields.
+**      16-Oct-2026 (agent)
+**          Added the query timeout and cancel fields of IIDBI_STMT and the
+**          timeout of IIDBI_CONNECTION and IIDBI_CURSOR, and
+**          IIDBI_QUERY_TIMEOUT.
+**      17-Oct-2026 (agent)
+**          Added the IIDBI_POOL object, with IIDBI_POOLENTRY,
+**          IIDBI_POOLWAITER and IIDBI_POOL_MAX_SIZE, and the pool and open
+**          cursor list of IIDBI_CONNECTION.
+**      17-Oct-2026 (agent)
+**          Added refCount to IIDBI_ENV.
+**      17-Oct-2026 (agent)
+**          The asyncExec cursor field holds a reference.
+**      17-Oct-2026 (agent)
+**          Added IIDBI_LOBALLOC.
+**      17-Oct-2026 (agent)
+**          Added streamFailed to IIDBI_ERROR.
+**      17-Oct-2026 (agent)
+**          Removed IIDBI_DECIMAL_SLOTS.
+**      17-Oct-2026 (agent)
+**          Added IIDBI_PARAMSET.
+**      17-Oct-2026 (agent)
+**          Added paramsetError to IIDBI_STMT.
 **/
 
 # ifndef __IIDBI_H_INCLUDED
@@ -87,6 +167,7 @@
 # endif
 
 # include <Python.h>
+# include <pythread.h>
 /* Pre Python 2.5 compat support */
 #if PY_VERSION_HEX < 0x02050000 /* Python 2.4 and earlier */
 /* macro as a workaround rather than typedef */
@@ -108,6 +189,9 @@
 ** History:
 **   07-Jul-04 (loera01)
 **      Created.
+**   17-Oct-2026 (agent)
+**      Added streamFailed, set when a parameter stream failed and its
+**      Python exception is the error to report.
 */
 
 # define DBI_SQL_MAX_MESSAGE_LENGTH (10*1024)
@@ -116,6 +200,7 @@ typedef struct
     char      sqlState[6];
     char      messageText[DBI_SQL_MAX_MESSAGE_LENGTH]; /* TODO make this dynamic */
     SQLINTEGER native;
+    unsigned char streamFailed; /* see dbi_putStream() */
 }  IIDBI_ERROR;
 
 # ifndef TRUE
@@ -127,6 +212,60 @@ typedef struct
 # endif
 
 #define IIDBI_MAX_ERROR_ROWS 10
+/* largest result list fetchmany() will allocate up front */
+#define IIDBI_MAX_PRESIZE 10000
+/* smallest rowset used when a result set is iterated over */
+#define IIDBI_ITER_ROWSET 100
+/* largest number of parameter rows sent per execute by executemany() */
+#define IIDBI_PARAMSET_SIZE 1000
+/* prepared statement handles kept per connection */
+#define IIDBI_STMT_CACHE_SIZE 64
+/* free statement handles kept per connection */
+#define IIDBI_STMT_POOL_SIZE 8
+/* connections a connection pool opens at most unless maxsize is given */
+#define IIDBI_POOL_MAX_SIZE 10
+/* bytes of a streamed LOB read at fetch time */
+#define IIDBI_LOB_HEAD_SIZE 8192
+/* bytes per SQLGetData() call when a LOB reader reads to the end */
+#define IIDBI_LOB_READ_SIZE 65536
+/* connection.decimal modes, how DECIMAL columns are returned */
+#define IIDBI_DECIMAL_DECIMAL 0 /* decimal.Decimal */
+#define IIDBI_DECIMAL_FLOAT 1 /* float */
+#define IIDBI_DECIMAL_INT 2 /* int or long if the scale is 0 */
+#define IIDBI_DECIMAL_STRING 3 /* string as returned by the driver */
+/* longest decimal string converted without the Decimal constructor */
+#define IIDBI_DECIMAL_STRING_SIZE 128
+/* output converter modes, resolved per column from the converters dicts */
+#define IIDBI_CONVERT_DEFAULT 0 /* usual conversion for the column type */
+#define IIDBI_CONVERT_STRING 1 /* str, unicode encoded as UTF-8 */
+#define IIDBI_CONVERT_BYTES 2 /* str, unicode as the raw SQLWCHAR bytes */
+#define IIDBI_CONVERT_INT 3 /* int, DECIMAL scaled to an integer */
+#define IIDBI_CONVERT_FLOAT 4 /* float */
+#define IIDBI_CONVERT_CALL 5 /* callable applied to the string form */
+/* initial values per column collected by cursor.fetchcolumns() */
+#define IIDBI_FETCHCOLUMN_SIZE 1024
+/* parameter kinds, how IIDBI_sendParameters() binds a value */
+#define IIDBI_PARAM_UNKNOWN 0 /* not a parameter type */
+#define IIDBI_PARAM_INT 1
+#define IIDBI_PARAM_LONG 2
+#define IIDBI_PARAM_FLOAT 3
+#define IIDBI_PARAM_STRING 4
+#define IIDBI_PARAM_UNICODE 5
+#define IIDBI_PARAM_BUFFER 6
+#define IIDBI_PARAM_NONE 7
+#define IIDBI_PARAM_DATETIME 8
+#define IIDBI_PARAM_DATE 9
+#define IIDBI_PARAM_TIME 10
+#define IIDBI_PARAM_DECIMAL 11
+#define IIDBI_PARAM_STREAM 12 /* file-like object or iterator, not cached */
+/* bytes per parameter in the parameter arena, fits any fixed size value */
+#define IIDBI_PARAM_SLOT_SIZE IIDBI_DECIMAL_STRING_SIZE
+/* most SQLWCHARs a unicode string of len characters transcodes to */
+#define IIDBI_WIDE_UNITS(len) \
+    ((len) * (sizeof(Py_UNICODE) > sizeof(SQLWCHAR) ? 2 : 1))
+/* query timeout of a cursor, its own or its connection's */
+#define IIDBI_QUERY_TIMEOUT(cursor) ((SQLULEN)((cursor)->timeout >= 0 ? \
+    (cursor)->timeout : (cursor)->connection->timeout))
 
 #define DBI_SQL_SUCCESS             0
 #define DBI_SQL_SUCCESS_WITH_INFO   1
@@ -196,13 +335,35 @@ typedef struct
 ** History:
 **   07-Jul-04 (loera01)
 **      Created.
+**   17-Oct-2026 (agent)
+**      Added refCount.
 */
 
 typedef struct 
 {
     IIDBI_HDR hdr; 
+    int refCount;             /* connections using the handle, plus one */
 } IIDBI_ENV;
 
+/*
+** Name: IIDBI_CACHED_STMT - Prepared statement cache entry
+**
+** Description:
+**    A prepared ODBC statement handle that is not in use by a cursor,
+**    and the query text it was prepared with.
+**
+** History:
+**   16-Oct-2026 (agent)
+**      Created.
+*/
+
+typedef struct _IIDBI_CACHED_STMT
+{
+    struct _IIDBI_CACHED_STMT *next; /* less recently used */
+    char *sqlText;
+    SQLHANDLE handle;
+} IIDBI_CACHED_STMT;
+
 /*
 ** Name: IIDBI_DBC - DBI connection handle
 **
@@ -212,6 +373,15 @@ typedef struct
 ** History:
 **   07-Jul-04 (loera01)
 **      Created.
+**   16-Oct-2026 (agent)
+**      Added the prepared statement cache, most recently used first.
+**      The cache is disabled while stmtCacheLock is NULL.
+**   16-Oct-2026 (agent)
+**      Added stmtPool, unprepared statement handles ready for reuse.
+**      It shares stmtCacheLock with the statement cache.
+**   16-Oct-2026 (agent)
+**      Added getDataExtensions, SQL_GETDATA_EXTENSIONS of the driver,
+**      valid once getDataKnown is set.
 */
 
 typedef struct 
@@ -219,6 +389,13 @@ typedef struct
    IIDBI_HDR hdr;
    void *conn;
    SQLHANDLE *env;
+   IIDBI_CACHED_STMT *stmtCache;
+   int stmtCacheCount;
+   PyThread_type_lock stmtCacheLock;
+   SQLHANDLE stmtPool[IIDBI_STMT_POOL_SIZE];
+   int stmtPoolCount;
+   SQLUINTEGER getDataExtensions;
+   unsigned char getDataKnown;
 } IIDBI_DBC, *pDBC;
 
 /*
@@ -277,8 +454,49 @@ typedef struct
 **          Make orInd field part of the descriptor as ODBC depends on its
 **          persistence.
 **          Changed the nullable field type to remove compiler warnings.
+**      16-Oct-2026 (agent)
+**          Added bindSize, rowsetData and rowsetInd for column-wise
+**          block fetches.
+**      16-Oct-2026 (agent)
+**          bindSize, rowsetData and rowsetInd also describe parameter
+**          arrays.
+**      16-Oct-2026 (agent)
+**          Added isBound. rowsetData/bindSize also hold the reusable
+**          copy of a string parameter kept between executemany() rows.
+**      16-Oct-2026 (agent)
+**          Added putStream, the source of a parameter sent in segments
+**          at execution time.
+**      16-Oct-2026 (agent)
+**          Added lobObject, a LONG column value read directly into the
+**          Python string returned for it.
+**      16-Oct-2026 (agent)
+**          Added rowsetBorrowed, set when rowsetData points into a Python
+**          buffer passed to cursor.executecolumns().
+**      16-Oct-2026 (agent)
+**          Added slot, the arena space of a parameter descriptor.
+*/
+
+/*
+** Name: IIDBI_PUTSTREAM - Source of a data-at-execution parameter
+**
+** Description:
+**    Supplies the value of a LOB parameter one segment at a time while
+**    the query executes. read() returns DBI_SQL_SUCCESS with the next
+**    segment, valid until the next call, DBI_SQL_NO_DATA at the end or
+**    DBI_SQL_ERROR. release() frees the stream.
+**
+** History:
+**   16-Oct-2026 (agent)
+**      Created.
 */
 
+typedef struct _IIDBI_PUTSTREAM
+{
+    int (*read)(struct _IIDBI_PUTSTREAM *stream, int size, char **data, 
+        SQLLEN *len);
+    void (*release)(struct _IIDBI_PUTSTREAM *stream);
+} IIDBI_PUTSTREAM;
+
 typedef struct _IIDBI_DESCRIPTOR
 {
     char            *columnName;
@@ -292,8 +510,67 @@ typedef struct _IIDBI_DESCRIPTOR
     int             internalSize; /* Used for internal memory malloc */
     unsigned char   isNull;
     long            orInd; /* ODBC indicator and/or byte length specifier of data */
+    SQLLEN          bindSize; /* bytes per row when bound, 0 for LOB columns */
+    void            *rowsetData; /* column-wise rowset buffer */
+    SQLLEN          *rowsetInd; /* rowset length/indicator array */
+    unsigned char   isBound; /* parameter binding on the handle is current */
+    IIDBI_PUTSTREAM *putStream; /* parameter sent from a stream */
+    PyObject        *lobObject; /* LONG value read into a string */
+    unsigned char   rowsetBorrowed; /* rowsetData is not ours to free */
+    void            *slot; /* parameter value space in the arena */
 } IIDBI_DESCRIPTOR; 
 
+/*
+** Name: IIDBI_LOBALLOC - Allocator of LONG column values
+**
+** Description:
+**    Supplies the buffer a LONG VARCHAR or LONG BYTE value is read into
+**    once it outgrows its first segment, so the value can be read
+**    straight into the object returned for it, kept in the descriptor's
+**    lobObject. grow() returns a buffer of size bytes holding the first
+**    count bytes of buf, or NULL if no memory is left; buf is released
+**    either way. release() drops a lobObject not taken by a row. Both
+**    may be called without the GIL. See dbi_lobAllocator().
+**
+** History:
+**   17-Oct-2026 (agent)
+**      Created.
+*/
+
+typedef struct _IIDBI_LOBALLOC
+{
+    char *(*grow)(IIDBI_DESCRIPTOR *desc, char *buf, SQLLEN count, 
+        SQLLEN size);
+    void (*release)(IIDBI_DESCRIPTOR *desc);
+} IIDBI_LOBALLOC;
+
+/*
+** Name: IIDBI_PREFETCH - rowset prefetch worker
+**
+** Description:
+**    State shared between a statement and the native thread that fetches
+**    its next rowset into the back buffers while the previous one is
+**    converted, see dbi_prefetchStart(). The two locks are used as
+**    semaphores: empty is released to let the worker fetch, filled by
+**    the worker when the back rowset is in.
+**
+** History:
+**   16-Oct-2026 (agent)
+**      Created.
+*/
+
+typedef struct
+{
+    PyThread_type_lock empty;
+    PyThread_type_lock filled;
+    void **rowsetData; /* back rowset buffer per column */
+    SQLLEN **rowsetInd; /* back length/indicator array per column */
+    SQLULEN rowsFetched; /* rows in the back rowset */
+    RETCODE rc; /* SQLFetch() result for the back rowset */
+    unsigned char pending; /* fetch requested and not yet collected */
+    unsigned char stop; /* worker is to exit */
+} IIDBI_PREFETCH;
+
 /*
 ** Name: IIDBI_STMT - DBI statement handle
 **
@@ -303,6 +580,41 @@ typedef struct _IIDBI_DESCRIPTOR
 ** History:
 **   07-Jul-04 (loera01)
 **      Created.
+**   16-Oct-2026 (agent)
+**      Added rowset fields. arraySize is the requested rowset size,
+**      rowsetSize the size the driver accepted.
+**   16-Oct-2026 (agent)
+**      Added parameter array fields. When paramsetSize is greater than
+**      one the parameter descriptors hold column-wise arrays in
+**      rowsetData/rowsetInd.
+**   16-Oct-2026 (agent)
+**      Added keepParameters. When set the parameter descriptors and
+**      their bindings survive dbi_cursorExecute().
+**   16-Oct-2026 (agent)
+**      Added preparedText, the query the handle is prepared with, and
+**      pdbc, the connection the handle belongs to.
+**   16-Oct-2026 (agent)
+**      Added colsBound, set when columns are bound for single row
+**      fetches; their binding buffers are rowsetData/rowsetInd.
+**   16-Oct-2026 (agent)
+**      Added lobStreaming, lobColumn, lobPending and rowGeneration.
+**      lobColumn is the (1-based) LONG column of the current row left
+**      in the driver for a LOB reader, rowGeneration changes whenever
+**      the current row does.
+**   16-Oct-2026 (agent)
+**      Added paramArena and paramArenaCount, see dbi_paramArenaAlloc().
+**   16-Oct-2026 (agent)
+**      Added wideBuffer and wideBufferSize, unicode parameters transcoded
+**      to SQLWCHAR when the widths differ.
+**   16-Oct-2026 (agent)
+**      Added prefetch and prefetcher, see dbi_prefetchStart().
+**   16-Oct-2026 (agent)
+**      Added queryTimeout and timeoutSet, see dbi_cursorExecute(), and
+**      running, the handle dbi_cursorCancel() may cancel. running is
+**      guarded by the connection's stmtCacheLock.
+**   17-Oct-2026 (agent)
+**      Added paramsetError, the zero based row of the last parameter
+**      array executed that failed, -1 if none did.
 */
 
 typedef struct 
@@ -322,6 +634,31 @@ typedef struct
     unsigned int inputSegmentLen;
     unsigned int outputSegmentSize;
     unsigned int outputColumnIndex;
+    unsigned char rowsetBound;
+    int rowsetSize;
+    int rowsetIndex;
+    SQLULEN rowsFetched;
+    int paramsetSize;
+    SQLUSMALLINT *paramStatus;
+    SQLULEN paramsProcessed;
+    int paramsetError;
+    unsigned char keepParameters;
+    char *preparedText;
+    IIDBI_DBC *pdbc;
+    unsigned char colsBound;
+    unsigned char lobStreaming;
+    unsigned char lobPending;
+    unsigned int lobColumn;
+    unsigned long rowGeneration;
+    char *paramArena; /* parameter descriptors and value slots */
+    int paramArenaCount; /* parameters the arena holds */
+    SQLWCHAR *wideBuffer; /* transcoded unicode parameters */
+    Py_ssize_t wideBufferSize; /* SQLWCHARs the wide buffer holds */
+    unsigned char prefetch; /* fetch rowsets ahead in a worker thread */
+    IIDBI_PREFETCH *prefetcher; /* running worker or NULL */
+    SQLULEN queryTimeout; /* SQL_ATTR_QUERY_TIMEOUT seconds, 0 for none */
+    unsigned char timeoutSet; /* the handle may have a timeout set */
+    SQLHANDLE running; /* handle executing a query or NULL */
 } IIDBI_STMT, *pSTMT;
 
 /*
@@ -379,9 +716,15 @@ typedef struct
     PyObject *errorhandler;
     PyObject *IOError;
     int pooled;
+    unsigned char decimalMode; /* IIDBI_DECIMAL_xxx */
+    PyObject *converters; /* output converters dict or NULL */
+    int asyncPending; /* asynchronous executes still running */
+    long timeout; /* query timeout of its cursors in seconds, 0 for none */
+    struct _IIDBI_CURSOR *cursors; /* open cursors, borrowed */
+    struct _IIDBI_POOL *pool; /* pool the connection belongs to or NULL */
 } IIDBI_CONNECTION;
 
-typedef struct
+typedef struct _IIDBI_CURSOR
 {
     PyObject_HEAD
     PyObject *description;
@@ -394,6 +737,8 @@ typedef struct
     PyObject *rownumber;
     long rowindex;
     unsigned char closed;
+    unsigned char iterWarned;
+    unsigned char nextWarned;
     IIDBI_STMT *IIDBIpstmt;
     unsigned int inputSegmentLen;
     unsigned int *inputSegmentSize;
@@ -401,6 +746,301 @@ typedef struct
     unsigned int outputColumnIndex;
     PyObject *messages;
     PyObject *errorhandler;
+    unsigned char lobStreaming;
+    PyObject *converters; /* output converters dict or NULL */
+    unsigned char *convertModes; /* IIDBI_CONVERT_xxx per column or NULL */
+    PyObject *convertCalls; /* callables per column or NULL */
+    int convertCount;
+    PyObject **paramTypes; /* type of the last value per parameter */
+    unsigned char *paramKinds; /* IIDBI_PARAM_xxx of paramTypes */
+    int paramKindCount;
+    unsigned char prefetch;
+    struct _IIDBI_ASYNCEXEC *asyncExec; /* pending execute_async() */
+    long timeout; /* query timeout in seconds, -1 for the connection's */
+    struct _IIDBI_CURSOR *prevCursor; /* connection's open cursors */
+    struct _IIDBI_CURSOR *nextCursor;
 } IIDBI_CURSOR;
 
+/*
+** Name: IIDBI_FETCHCOLUMN - column collected by cursor.fetchcolumns()
+**
+** Description:
+**    Values of a numeric column are collected as C longs or doubles in
+**    data and become an array.array of the given typecode. Other
+**    columns, and numeric columns once a NULL is seen, are collected in
+**    list.
+**
+** History:
+**   16-Oct-2026 (agent)
+**      Created.
+*/
+
+typedef struct
+{
+    char typecode; /* 'l' or 'd', 0 when collected in list */
+    char *data;
+    Py_ssize_t count;
+    Py_ssize_t size;
+    PyObject *list;
+} IIDBI_FETCHCOLUMN;
+
+/*
+** Name: IIDBI_COLUMNBUFFER - column buffer object
+**
+** Description:
+**    Numeric column of a rowset returned by cursor.fetchbuffers(). data
+**    is the rowset buffer the driver fetched into, taken over from the
+**    column (see dbi_rowsetDetach()); count values of itemSize bytes
+**    start at offset. nulls is a bitmap with a bit set for each NULL.
+**
+** History:
+**   16-Oct-2026 (agent)
+**      Created.
+*/
+
+typedef struct
+{
+    PyObject_HEAD
+    char *data;
+    Py_ssize_t offset;
+    Py_ssize_t count;
+    Py_ssize_t itemSize;
+    char *format; /* struct module format of a value */
+    PyObject *nulls;
+    int nullCount;
+} IIDBI_COLUMNBUFFER;
+
+/*
+** Name: IIDBI_PARAMCOLUMN - parameter column of cursor.executecolumns()
+**
+** Description:
+**    Values of one parameter. A buffer of fixed width numbers the driver
+**    reads as they are (see IIDBI_paramBufferType()) is bound in place:
+**    data points to the first value, cType and type are the ODBC types
+**    of a value of itemSize bytes and nulls is the NULL bitmap of a 
+**    column buffer. When the buffer is only reachable through the old
+**    buffer interface it is copied, a batch at a time, as it may be
+**    resized while the query runs. Any other column is a sequence held
+**    in items.
+**
+** History:
+**   16-Oct-2026 (agent)
+**      Created.
+*/
+
+typedef struct
+{
+    PyObject *items; /* PySequence_Fast() of the column, or NULL */
+    PyObject *source; /* buffer object, borrowed */
+    char *data;
+    Py_ssize_t itemSize;
+    int cType;
+    int type;
+    unsigned char *nulls;
+    unsigned char copy; /* re-read through the old buffer interface */
+#ifdef Py_TPFLAGS_HAVE_NEWBUFFER
+    unsigned char hasView;
+    Py_buffer view;
+#endif
+} IIDBI_PARAMCOLUMN;
+
+/*
+** Name: IIDBI_PARAMSET - parameter set of a query executed once per row
+**
+** Description:
+**    The rows of cursor.executemany() or cursor.executecolumns(), as
+**    executed by IIDBI_cursorExecuteParamSet(). sendArray() binds count
+**    rows from start as parameter arrays, or returns DBI_SQL_NO_DATA if
+**    they cannot be sent that way. getRow() returns a new reference to
+**    the parameter sequence of one row, for rows sent one at a time, or
+**    NULL with an error raised.
+**
+** History:
+**   17-Oct-2026 (agent)
+**      Created.
+*/
+
+typedef struct _IIDBI_PARAMSET
+{
+    int (*sendArray)(struct _IIDBI_PARAMSET *set, IIDBI_CURSOR *cursor, 
+        int start, int count);
+    PyObject *(*getRow)(struct _IIDBI_PARAMSET *set, IIDBI_CURSOR *cursor,
+        Py_ssize_t row, int *result);
+    char *method; /* cursor method, for error messages */
+    PyObject *sequence; /* executemany() parameter set */
+    PyObject *rows; /* PySequence_Fast() of sequence, or NULL */
+    IIDBI_PARAMCOLUMN *columns; /* executecolumns() parameter columns */
+    int parmCount; /* number of columns */
+} IIDBI_PARAMSET;
+
+/*
+** Name: IIDBI_LOBREADER - LOB reader object
+**
+** Description:
+**    File-like object returned for a streamed LONG column. head holds
+**    the data read at fetch time, the rest is read from the driver
+**    while the cursor is still positioned on the row (generation).
+**
+** History:
+**   16-Oct-2026 (agent)
+**      Created.
+*/
+
+typedef struct
+{
+    PyObject_HEAD
+    IIDBI_CURSOR *cursor;
+    IIDBI_STMT *pstmt;
+    unsigned long generation;
+    int column;
+    SQLSMALLINT cType;
+    char *head;
+    Py_ssize_t headLen;
+    Py_ssize_t headPos;
+    unsigned char more;
+    unsigned char closed;
+} IIDBI_LOBREADER;
+
+/*
+** Name: IIDBI_ASYNCEXEC - asynchronous execute object
+**
+** Description:
+**    Returned by cursor.execute_async(). A worker thread runs the query
+**    on pstmt and stores the return code in rc; done is held while it
+**    runs. The worker signals the pipe (an event on Windows) before it
+**    releases done, so it can be waited on by select() or poll(). The
+**    query and parameters are kept until the execute is finished. The
+**    cursor holds a reference to the object while the execute is
+**    pending; cursor is borrowed and cleared when it is finished.
+**
+** History:
+**   16-Oct-2026 (agent)
+**      Created.
+**   17-Oct-2026 (agent)
+**      The cursor holds the object, cursor is borrowed.
+*/
+
+typedef struct _IIDBI_ASYNCEXEC
+{
+    PyObject_HEAD
+    IIDBI_CURSOR *cursor;
+    IIDBI_DBC *pdbc;
+    IIDBI_STMT *pstmt;
+    char *query;
+    PyObject *params;
+    PyThread_type_lock done;
+# ifdef WIN32
+    HANDLE event;
+# else
+    int pipe[2];
+# endif
+    RETCODE rc;
+    unsigned char finished;
+} IIDBI_ASYNCEXEC;
+
+/*
+** Name: IIDBI_POOLENTRY - idle connection of a connection pool
+**
+** History:
+**   17-Oct-2026 (agent)
+**      Created.
+*/
+
+typedef struct _IIDBI_POOLENTRY
+{
+    struct _IIDBI_POOLENTRY *next; /* released earlier */
+    IIDBI_DBC *pdbc;
+    time_t released;
+} IIDBI_POOLENTRY;
+
+/*
+** Name: IIDBI_POOLWAITER - thread waiting for a pooled connection
+**
+** Description:
+**    Queued by pool.connect() when the pool is at its maximum size.
+**    The waiter is granted either a released connection (pdbc) or, when
+**    pdbc is NULL, a place to open a new one. It waits on the pipe (an
+**    event on Windows) with the GIL released.
+**
+** History:
+**   17-Oct-2026 (agent)
+**      Created.
+*/
+
+typedef struct _IIDBI_POOLWAITER
+{
+    struct _IIDBI_POOLWAITER *next;
+    IIDBI_DBC *pdbc;
+    unsigned char granted;
+# ifdef WIN32
+    HANDLE event;
+# else
+    int pipe[2];
+# endif
+} IIDBI_POOLWAITER;
+
+/*
+** Name: IIDBI_POOL - connection pool object
+**
+** Description:
+**    Returned by ingresdbi.ConnectionPool(). Keeps connected DBI
+**    connection handles and wraps one in a new connection object for
+**    each pool.connect(); closing that connection hands the handle back.
+**    size counts the handles open, idle or in use, and those being
+**    opened. Idle handles are kept most recently released first. The
+**    pool is only changed with the GIL held.
+**
+** History:
+**   17-Oct-2026 (agent)
+**      Created.
+*/
+
+typedef struct _IIDBI_POOL
+{
+    PyObject_HEAD
+    PyObject *args; /* connect() arguments */
+    PyObject *keywords; /* connect() keywords or NULL */
+    int minSize;
+    int maxSize;
+    long idleTimeout; /* seconds, -1 for none */
+    char *validate; /* validation query or NULL */
+    int size;
+    int idleCount;
+    IIDBI_POOLENTRY *idle;
+    IIDBI_POOLWAITER *waitHead; /* first come, first served */
+    IIDBI_POOLWAITER *waitTail;
+    int waitCount;
+    unsigned char closed;
+    unsigned char autocommit; /* settings of the pool's connections */
+    unsigned char decimalMode;
+    int trace;
+    unsigned long connects; /* statistics */
+    unsigned long disconnects;
+    unsigned long acquires;
+    unsigned long releases;
+    unsigned long waits;
+    unsigned long timeouts;
+    unsigned long validationFailures;
+} IIDBI_POOL;
+
+/*
+** Name: IIDBI_PUTSOURCE - LOB parameter read from a Python object
+**
+** Description:
+**    IIDBI_PUTSTREAM over a file-like object (its read method) or an
+**    iterator. segment holds the last value handed to the driver.
+**
+** History:
+**   16-Oct-2026 (agent)
+**      Created.
+*/
+
+typedef struct
+{
+    IIDBI_PUTSTREAM stream;
+    PyObject *read;
+    PyObject *iterator;
+    PyObject *segment;
+} IIDBI_PUTSOURCE;
+
 #endif  /* __IIDBI_H_INCLUDED */
@@ -32,6 +32,14 @@
 **          Made functions consistently return integers.
 **      21-Dec-2004 (ralph.Loen@ca.com)
 **          Added autocommit argument to dbi_connect.
+**      16-Oct-2026 (agent)
+**          Added the prepared statement cache functions.
+**      16-Oct-2026 (agent)
+**          Added the statement pool functions.
+**      17-Oct-2026 (agent)
+**          Added dbi_connectionValidate().
+**      17-Oct-2026 (agent)
+**          Added dbi_free_env().
 **/
 
 #ifndef __IIDBI_CONN_H_INCLUDED
@@ -42,6 +50,9 @@
 extern RETCODE
 dbi_alloc_env(IIDBI_ENV *penv, IIDBI_DBC *pdbc);
 
+extern RETCODE
+dbi_free_env(IIDBI_ENV *penv);
+
 extern RETCODE
 dbi_connect( IIDBI_DBC *pdbc);
 
@@ -57,4 +68,22 @@ dbi_connectionCursor( IIDBI_DBC *pdbc );
 extern RETCODE
 dbi_connectionRollback( IIDBI_DBC *pdbc );
 
+extern RETCODE
+dbi_connectionValidate( IIDBI_DBC *pdbc, char *query );
+
+extern SQLHANDLE
+dbi_stmtCacheGet( IIDBI_DBC *pdbc, char *stmnt );
+
+extern void
+dbi_stmtCachePut( IIDBI_DBC *pdbc, SQLHANDLE hstmt, char *sqlText );
+
+extern void
+dbi_stmtCacheFree( IIDBI_DBC *pdbc );
+
+extern SQLHANDLE
+dbi_stmtPoolGet( IIDBI_DBC *pdbc );
+
+extern void
+dbi_stmtPoolPut( IIDBI_DBC *pdbc, SQLHANDLE hstmt );
+
 # endif     /* __IIDBI_CONN_H_INCLUDED */
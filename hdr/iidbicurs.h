@@ -39,6 +39,23 @@
 **          Added dbi_freeData().
 **      05-Aug-2009 (Chris.Clark@ingres.com)
 **          Removed unused dbi_cursorFetchall()
+**      16-Oct-2026 (agent)
+**          Added dbi_bindColumns().
+**      16-Oct-2026 (agent)
+**          Added dbi_rowsetPending().
+**      16-Oct-2026 (agent)
+**          Added dbi_resetParameter().
+**      16-Oct-2026 (agent)
+**          Added dbi_lobCType() and dbi_cursorGetSegment().
+**      16-Oct-2026 (agent)
+**          dbi_cursorGetSegment() reports the length left in the driver.
+**      16-Oct-2026 (agent)
+**          Added dbi_rowsetCopy(), dbi_rowsetDetach() and
+**          dbi_rowsetConsume().
+**      16-Oct-2026 (agent)
+**          Added dbi_paramArenaFree().
+**      16-Oct-2026 (agent)
+**          Added dbi_cursorCancel().
 **/
 
 #ifndef __IIDBI_CURS_H_INCLUDED
@@ -54,6 +71,9 @@ extern RETCODE
 dbi_cursorExecute( IIDBI_DBC* pdbc, IIDBI_STMT* pstmt, char *stmnt, 
     unsigned char isProc );
 
+extern RETCODE
+dbi_cursorCancel( IIDBI_STMT* pstmt );
+
 extern RETCODE
 dbi_allocDescriptor ( IIDBI_STMT *pstmt, int nbrCols, unsigned char isParam );
 
@@ -72,6 +92,38 @@ dbi_cursorFetchone( IIDBI_STMT *pstmt );
 extern RETCODE 
 dbi_describeColumns (IIDBI_STMT *pstmt);
 
+extern RETCODE
+dbi_bindColumns( IIDBI_STMT *pstmt );
+
+extern int
+dbi_rowsetPending( IIDBI_STMT *pstmt );
+
+extern void
+dbi_rowsetCopy( IIDBI_STMT *pstmt, int row, int i );
+
+extern RETCODE
+dbi_rowsetDetach( IIDBI_STMT *pstmt, int i, void **data );
+
+extern void
+dbi_rowsetConsume( IIDBI_STMT *pstmt );
+
+extern void
+dbi_resetParameter( IIDBI_DESCRIPTOR *desc );
+
+extern void
+dbi_paramArenaFree( IIDBI_STMT *pstmt );
+
+extern SQLSMALLINT
+dbi_lobCType( int type );
+
+extern void
+dbi_lobAllocator( IIDBI_LOBALLOC *alloc );
+
+extern RETCODE
+dbi_cursorGetSegment( IIDBI_STMT *pstmt, int colNbr, SQLSMALLINT cType,
+    char *buf, SQLLEN bufLen, SQLLEN *len, unsigned char *more, 
+    SQLLEN *avail );
+
 extern int  
 dbi_mapType(int type);
 
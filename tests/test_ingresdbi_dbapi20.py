@@ -102,6 +102,16 @@
     10-Dec-2010 (grant)
         Trac ticket 702 - Fix up tearDown() so it actually cleans up the 
         cursor/connection after each test, preventing hangs.
+    16-Oct-2026 (agent)
+        New test test_blockFetchArraysize for block (rowset) fetches.
+    16-Oct-2026 (agent)
+        New test test_fetchmanyLargeSize for fetchmany() sizes larger than
+        the result set.
+    16-Oct-2026 (agent)
+        New test test_iteratorWarnsOnce for cursor iteration.
+    16-Oct-2026 (agent)
+        New test test_executemanyParameterArrays for executemany()
+        parameter arrays.
 """
 import dbapi20
 import unittest
@@ -111,6 +121,9 @@ import os
 import sys
 import warnings
 import datetime
+import array
+import select
+import time
 from decimal import Decimal
 import gc # CPython specific.....
 
@@ -562,7 +575,9 @@ class test_Ingresdbi(dbapi20.DatabaseAPI20Test):
             self.curs.prepared = "Yes"
             self.curs.execute("select * from iitables")
             self.curs.execute("select * from iidbcapabilities")
-            self.failIfEqual(len(self.curs.messages), 0)
+            # a prepared cursor no longer reverts to direct execution
+            # (with a warning) when its query changes
+            self.assertEqual(len(self.curs.messages), 0)
         finally:
             self.curs.close()
             self.con.close()
@@ -1444,6 +1459,777 @@ embedded bind params nulls In Unicode are lost
         self.curs.close()
         self.con.close()
 
+    def test_blockFetchArraysize(self):
+        """Rows fetched in blocks of cursor.arraysize match single row fetches
+        """
+        self.con = self._connect()
+        self.curs = self.con.cursor()
+
+        table_name='session.blockfetch'
+        dropTable(self.curs, table_name)
+        self.curs.execute("DECLARE GLOBAL TEMPORARY TABLE %s (id integer, name varchar(20), amount float, note nvarchar(10)) ON COMMIT PRESERVE ROWS WITH NORECOVERY" % table_name)
+        expected_rows=[]
+        for x in range(10):
+            if x % 3:
+                row = (x, 'name%d' % x, x * 1.5, u'note%d' % x)
+            else:
+                row = (x, None, None, None)
+            expected_rows.append(row)
+        self.curs.executemany("INSERT INTO %s VALUES (?, ?, ?, ?)" % table_name, expected_rows)
+
+        sql_query="SELECT id, name, amount, note FROM %s ORDER BY id" % table_name
+        for arraysize in (1, 4, 10, 25):
+            self.curs.arraysize = arraysize
+            self.curs.execute(sql_query)
+            rs = [self.curs.fetchone()]
+            rs.extend(self.curs.fetchmany(3))
+            rs.extend(self.curs.fetchall())
+            self.assertEqual(rs, expected_rows)
+            self.assertEqual(self.curs.fetchone(), None)
+        dropTable(self.curs, table_name)
+
+        self.curs.close()
+        self.con.close()
+
+    def test_fetchmanyLargeSize(self):
+        """fetchmany() with a size larger than the result set returns the remaining rows
+        """
+        self.con = self._connect()
+        self.curs = self.con.cursor()
+
+        self.curs.execute("SELECT table_name FROM iitables WHERE table_name LIKE 'ii%' ORDER BY table_name")
+        expected_rows = self.curs.fetchall()
+        self.failUnless(len(expected_rows) > 2)
+
+        self.curs.execute("SELECT table_name FROM iitables WHERE table_name LIKE 'ii%' ORDER BY table_name")
+        self.assertEqual(self.curs.fetchmany(0), [])
+        rs = self.curs.fetchmany(2)
+        rs.extend(self.curs.fetchmany(50000))
+        self.assertEqual(rs, expected_rows)
+        self.assertEqual(self.curs.rownumber, len(expected_rows))
+        self.assertEqual(self.curs.fetchmany(50000), [])
+
+        self.curs.close()
+        self.con.close()
+
+    def test_iteratorWarnsOnce(self):
+        """Iterating over a cursor returns every row and warns once per cursor
+        """
+        self.con = self._connect()
+        self.curs = self.con.cursor()
+
+        sql_query = "SELECT table_name FROM iitables WHERE table_name LIKE 'ii%' ORDER BY table_name"
+        self.curs.execute(sql_query)
+        expected_rows = self.curs.fetchall()
+        self.failUnless(len(expected_rows) > 2)
+
+        warnings.simplefilter('always', Warning)
+        try:
+            caught = []
+            showwarning = warnings.showwarning
+            warnings.showwarning = lambda *args, **kwargs: caught.append(args[0])
+            try:
+                self.curs.execute(sql_query)
+                rs = [row for row in self.curs]
+                self.assertEqual(rs, expected_rows)
+                self.curs.execute(sql_query)
+                rs = [self.curs.next()]
+                rs.extend([row for row in self.curs])
+                self.assertEqual(rs, expected_rows)
+            finally:
+                warnings.showwarning = showwarning
+        finally:
+            warnings.simplefilter('ignore', Warning)
+        messages = [str(w) for w in caught]
+        self.assertEqual(messages.count('DB-API extension cursor.__iter__() used'), 1)
+        self.assertEqual(messages.count('DB-API extension cursor.next() used'), 1)
+
+        self.curs.close()
+        self.con.close()
+
+    def test_executemanyParameterArrays(self):
+        """executemany() of more rows than fit in one parameter array, including
+        NULLs and a column that has to fall back to one row at a time
+        """
+        self.con = self._connect()
+        self.curs = self.con.cursor()
+
+        table_name='session.paramarrays'
+        dropTable(self.curs, table_name)
+        self.curs.execute("DECLARE GLOBAL TEMPORARY TABLE %s (id bigint, name varchar(20), uname nvarchar(20), amount float, price decimal(10,3), created timestamp) ON COMMIT PRESERVE ROWS WITH NORECOVERY" % table_name)
+        expected_rows=[]
+        for x in range(2500):
+            if x % 7:
+                row = (x, 'name%d' % x, u'uname%d' % x, x * 0.5, 
+                    Decimal('%d.%03d' % (x, x % 1000)), 
+                    datetime.datetime(2010, 1, 1 + x % 28, x % 24, x % 60, 0))
+            else:
+                row = (x, None, None, None, None, None)
+            expected_rows.append(row)
+        expected_rows[2000] = (2 ** 40,) + expected_rows[2000][1:]
+        self.curs.executemany("INSERT INTO %s VALUES (?, ?, ?, ?, ?, ?)" % table_name, expected_rows)
+        self.assertEqual(self.curs.rowcount, len(expected_rows))
+
+        self.curs.execute("SELECT id, name, uname, amount, price, created FROM %s ORDER BY id" % table_name)
+        rs = self.curs.fetchall()
+        expected_rows.sort()
+        self.assertEqual(rs, expected_rows)
+
+        # mixed types in one column are sent one row at a time
+        self.curs.execute("DELETE FROM %s" % table_name)
+        self.curs.executemany("INSERT INTO %s (id, amount) VALUES (?, ?)" % table_name,
+            [(1, 1.5), (2, 2), (3, 3.5)])
+        self.curs.execute("SELECT id, amount FROM %s ORDER BY id" % table_name)
+        self.assertEqual(self.curs.fetchall(), [(1, 1.5), (2, 2.0), (3, 3.5)])
+        dropTable(self.curs, table_name)
+
+        self.curs.close()
+        self.con.close()
+
+    def test_executemanyFailedRow(self):
+        """executemany() names the failed row, counted across the whole
+        parameter set, in the error raised
+        """
+        self.con = self._connect()
+        self.curs = self.con.cursor()
+
+        table_name='session.failedrow'
+        dropTable(self.curs, table_name)
+        self.curs.execute("DECLARE GLOBAL TEMPORARY TABLE %s (id integer) ON COMMIT PRESERVE ROWS WITH NORECOVERY" % table_name)
+        rows = [(x,) for x in range(2500)]
+        # does not fit in an integer column
+        rows[1500] = (2 ** 40,)
+        try:
+            self.curs.executemany("INSERT INTO %s VALUES (?)" % table_name, rows)
+            self.fail('executemany() of an out of range row did not fail')
+        except self.driver.DatabaseError, e:
+            self.failUnless('row 1500 of the parameter set' in str(e), str(e))
+        dropTable(self.curs, table_name)
+
+        self.curs.close()
+        self.con.close()
+
+    def test_executemanyKeptBindings(self):
+        """executemany() one row at a time with values that grow, change
+        type and are NULL between rows
+        """
+        self.con = self._connect()
+        self.curs = self.con.cursor()
+
+        table_name='session.keptbindings'
+        dropTable(self.curs, table_name)
+        self.curs.execute("DECLARE GLOBAL TEMPORARY TABLE %s (id integer, name varchar(100), uname nvarchar(100), amount float) ON COMMIT PRESERVE ROWS WITH NORECOVERY" % table_name)
+        # int and float in the amount column force the row at a time path
+        expected_rows=[
+            (1, 'a', u'a', 1.5),
+            (2, 'a' * 50, u'b' * 50, 2),
+            (3, None, None, 3.5),
+            (4, 'bc', u'bc', None),
+            (5, 'd' * 100, u'd' * 100, 5),
+            ]
+        self.curs.executemany("INSERT INTO %s VALUES (?, ?, ?, ?)" % table_name, expected_rows)
+        self.assertEqual(self.curs.rowcount, len(expected_rows))
+
+        self.curs.execute("SELECT id, name, uname, amount FROM %s ORDER BY id" % table_name)
+        rs = self.curs.fetchall()
+        self.assertEqual(rs, expected_rows)
+        dropTable(self.curs, table_name)
+
+        self.curs.close()
+        self.con.close()
+
+    def test_preparedStatementCache(self):
+        """Prepared cursors switching between queries, and several cursors
+        sharing the same query, through the connection statement cache
+        """
+        self.con = self._connect()
+        self.curs = self.con.cursor()
+
+        table_name='session.stmtcache'
+        dropTable(self.curs, table_name)
+        self.curs.execute("DECLARE GLOBAL TEMPORARY TABLE %s (id integer) ON COMMIT PRESERVE ROWS WITH NORECOVERY" % table_name)
+        self.curs.executemany("INSERT INTO %s VALUES (?)" % table_name,
+            [(x,) for x in range(10)])
+
+        self.curs.prepared = "Yes"
+        curs2 = self.con.cursor()
+        curs2.prepared = "Yes"
+        query1 = "SELECT id FROM %s WHERE id = ?" % table_name
+        query2 = "SELECT count(*) FROM %s WHERE id < ?" % table_name
+        for x in range(5):
+            self.curs.execute(query1, (x,))
+            self.assertEqual(self.curs.fetchall(), [(x,)])
+            curs2.execute(query1, (x + 1,))
+            self.curs.execute(query2, (x,))
+            self.assertEqual(curs2.fetchall(), [(x + 1,)])
+            self.assertEqual(self.curs.fetchall(), [(x,)])
+        curs2.close()
+
+        # a closed cursor leaves its statement for the next one
+        curs2 = self.con.cursor()
+        curs2.prepared = "Yes"
+        curs2.execute(query1, (7,))
+        self.assertEqual(curs2.fetchall(), [(7,)])
+        curs2.close()
+        self.curs.prepared = "No"
+        dropTable(self.curs, table_name)
+
+        self.curs.close()
+        self.con.close()
+
+    def test_statementHandleReuse(self):
+        """Direct execution reusing the cursor statement handle, and new
+        cursors taking the handles of closed ones
+        """
+        self.con = self._connect()
+        for x in range(20):
+            self.curs = self.con.cursor()
+            self.curs.execute("select table_name from iitables")
+            # leave the result set open on every other cursor
+            if x % 2:
+                self.failIfEqual(len(self.curs.fetchall()), 0)
+            self.curs.execute("select count(*) from iidbconstants")
+            self.assertEqual(self.curs.fetchall(), [(1,)])
+            self.curs.prepared = "Yes"
+            self.curs.execute("select count(*) from iidbconstants")
+            self.assertEqual(self.curs.fetchall(), [(1,)])
+            self.curs.prepared = "No"
+            self.curs.execute("select count(*) from iitables where table_name = 'iitables'")
+            self.assertEqual(self.curs.fetchone(), (1,))
+            self.curs.close()
+
+        self.con.close()
+
+    def test_fetchBoundAndLongColumns(self):
+        """Single row fetches of fixed size columns before, between and after
+        LONG columns, including NULLs
+        """
+        self.con = self._connect()
+        self.curs = self.con.cursor()
+
+        table_name='session.boundcols'
+        dropTable(self.curs, table_name)
+        self.curs.execute("DECLARE GLOBAL TEMPORARY TABLE %s (id integer, notes long varchar, name varchar(20), amount float, doc long varchar, created timestamp) ON COMMIT PRESERVE ROWS WITH NORECOVERY" % table_name)
+        expected_rows=[
+            (1, 'n' * 5000, 'one', 1.5, 'd', datetime.datetime(2010, 1, 1, 10, 30, 0)),
+            (2, None, None, None, None, None),
+            (3, '', 'three', 3.25, 'd' * 100, datetime.datetime(2011, 2, 3, 4, 5, 6)),
+            ]
+        for row in expected_rows:
+            self.curs.execute("INSERT INTO %s VALUES (?, ?, ?, ?, ?, ?)" % table_name, row)
+
+        self.curs.arraysize = 1
+        self.curs.execute("SELECT id, notes, name, amount, doc, created FROM %s ORDER BY id" % table_name)
+        rs = [self.curs.fetchone() for x in range(len(expected_rows))]
+        self.assertEqual(self.curs.fetchone(), None)
+        self.assertEqual(rs, expected_rows)
+        self.curs.execute("SELECT id, name, amount, created FROM %s ORDER BY id" % table_name)
+        self.assertEqual(self.curs.fetchall(), [(r[0], r[2], r[3], r[5]) for r in expected_rows])
+        dropTable(self.curs, table_name)
+
+        self.curs.close()
+        self.con.close()
+
+    def test_lobStreamingReader(self):
+        """cursor.lobstreaming returns the last LONG column as a reader
+        that reads the value on demand
+        """
+        self.con = self._connect()
+        self.curs = self.con.cursor()
+
+        table_name='session.lobstream'
+        dropTable(self.curs, table_name)
+        self.curs.execute("DECLARE GLOBAL TEMPORARY TABLE %s (id integer, doc long varchar) ON COMMIT PRESERVE ROWS WITH NORECOVERY" % table_name)
+        big_value = ''.join([chr(ord('a') + x % 26) for x in range(200000)])
+        expected_rows=[(1, big_value), (2, None), (3, 'short')]
+        for row in expected_rows:
+            self.curs.execute("INSERT INTO %s VALUES (?, ?)" % table_name, row)
+
+        self.curs.lobstreaming = True
+        self.curs.execute("SELECT id, doc FROM %s ORDER BY id" % table_name)
+        row = self.curs.fetchone()
+        self.assertEqual(row[0], 1)
+        self.assertTrue(isinstance(row[1], self.driver.lobreader))
+        self.assertEqual(row[1].read(10), big_value[:10])
+        self.assertEqual(''.join([piece for piece in row[1]]), big_value[10:])
+        self.assertEqual(row[1].read(), '')
+        self.assertEqual(self.curs.fetchone(), (2, None))
+        row = self.curs.fetchone()
+        self.assertEqual(row[1].read(), 'short')
+        self.assertEqual(self.curs.fetchone(), None)
+
+        # a reader is only valid until the cursor moves on
+        self.curs.execute("SELECT id, doc FROM %s ORDER BY id" % table_name)
+        row = self.curs.fetchone()
+        self.curs.fetchone()
+        self.assertRaises(self.driver.InterfaceError, row[1].read)
+
+        # multi row fetches return whole values
+        self.curs.execute("SELECT id, doc FROM %s ORDER BY id" % table_name)
+        self.assertEqual(self.curs.fetchall(), expected_rows)
+        self.curs.lobstreaming = False
+        dropTable(self.curs, table_name)
+
+        self.curs.close()
+        self.con.close()
+
+    def test_lobStreamingParameters(self):
+        """File-like objects and iterators are sent as LONG BYTE parameters
+        a segment at a time
+        """
+        import StringIO
+        self.con = self._connect()
+        self.curs = self.con.cursor()
+
+        table_name='session.lobput'
+        dropTable(self.curs, table_name)
+        self.curs.execute("DECLARE GLOBAL TEMPORARY TABLE %s (id integer, doc long byte) ON COMMIT PRESERVE ROWS WITH NORECOVERY" % table_name)
+        big_value = ''.join([chr(x % 256) for x in range(300000)])
+        self.curs.execute("INSERT INTO %s VALUES (?, ?)" % table_name, (1, StringIO.StringIO(big_value)))
+        segments = (big_value[x:x + 70000] for x in range(0, len(big_value), 70000))
+        self.curs.execute("INSERT INTO %s VALUES (?, ?)" % table_name, (2, segments))
+        self.curs.execute("INSERT INTO %s VALUES (?, ?)" % table_name, (3, iter([])))
+
+        def failing_segments():
+            yield 'abc'
+            raise ValueError('source failed')
+        self.assertRaises(ValueError, self.curs.execute, "INSERT INTO %s VALUES (?, ?)" % table_name, (4, failing_segments()))
+
+        self.curs.execute("SELECT id, doc FROM %s ORDER BY id" % table_name)
+        rs = self.curs.fetchall()
+        self.assertEqual([(r[0], str(r[1])) for r in rs], [(1, big_value), (2, big_value), (3, '')])
+        dropTable(self.curs, table_name)
+
+        self.curs.close()
+        self.con.close()
+
+    def test_longColumnsManySegments(self):
+        """LONG values spanning many fetch segments are returned whole
+        """
+        self.con = self._connect()
+        self.curs = self.con.cursor()
+
+        table_name='session.longsegs'
+        dropTable(self.curs, table_name)
+        self.curs.execute("DECLARE GLOBAL TEMPORARY TABLE %s (id integer, txt long varchar, bin long byte, utxt long nvarchar) ON COMMIT PRESERVE ROWS WITH NORECOVERY" % table_name)
+        txt_value = ''.join([chr(ord('a') + x % 26) for x in range(250001)])
+        bin_value = ''.join([chr(x % 256) for x in range(250001)])
+        utxt_value = u''.join([unichr(0x3b1 + x % 20) for x in range(100001)])
+        self.curs.execute("INSERT INTO %s VALUES (?, ?, ?, ?)" % table_name, (1, txt_value, self.driver.Binary(bin_value), utxt_value))
+        self.curs.execute("INSERT INTO %s VALUES (?, ?, ?, ?)" % table_name, (2, '', self.driver.Binary(''), u''))
+        self.curs.execute("INSERT INTO %s VALUES (?, ?, ?, ?)" % table_name, (3, None, None, None))
+
+        for size in (None, 1000):
+            if size:
+                self.curs.setoutputsize(size)
+            self.curs.execute("SELECT id, txt, bin, utxt FROM %s ORDER BY id" % table_name)
+            rs = self.curs.fetchall()
+            self.assertEqual([tuple(r) for r in rs], [(1, txt_value, bin_value, utxt_value), (2, '', '', u''), (3, None, None, None)])
+        dropTable(self.curs, table_name)
+
+        self.curs.close()
+        self.con.close()
+
+    def test_decimalModes(self):
+        """DECIMAL columns returned as Decimal, float, int or string
+        as set by connection.decimal
+        """
+        kw_args = self.connect_kw_args.copy()
+        kw_args['decimal'] = 'float'
+        self.con = self.driver.connect(*self.connect_args, **kw_args)
+        self.curs = self.con.cursor()
+
+        sql_query = "select decimal(-12.50, 10, 2), decimal(0.05, 3, 2), decimal(123456789012, 20, 0), decimal(NULL, 5, 1) from iidbconstants"
+        self.assertEqual(self.con.decimal, 'float')
+        self.curs.execute(sql_query)
+        self.assertEqual(self.curs.fetchone(), (-12.5, 0.05, 123456789012.0, None))
+
+        self.con.decimal = 'decimal'
+        self.curs.execute(sql_query)
+        rs = self.curs.fetchone()
+        self.assertEqual(rs, (Decimal('-12.50'), Decimal('0.05'), Decimal('123456789012'), None))
+        self.assertEqual(str(rs[0]), '-12.50')
+
+        self.con.decimal = 'int'
+        self.curs.execute(sql_query)
+        rs = self.curs.fetchone()
+        self.assertEqual(rs, (Decimal('-12.50'), Decimal('0.05'), 123456789012, None))
+        self.assertTrue(isinstance(rs[2], (int, long)))
+
+        self.con.decimal = 'string'
+        self.curs.execute(sql_query)
+        rs = self.curs.fetchone()
+        self.assertEqual([type(x) for x in rs[:3]], [str, str, str])
+        self.assertEqual([Decimal(x) for x in rs[:3]], [Decimal('-12.50'), Decimal('0.05'), Decimal('123456789012')])
+
+        self.con.decimal = 'DECIMAL'
+        self.curs.execute("select decimal(?, 10, 4), decimal(?, 10, 4), decimal(?, 10, 4) from iidbconstants", (Decimal('-0.0005'), Decimal('1E+3'), Decimal('12.5')))
+        self.assertEqual(self.curs.fetchone(), (Decimal('-0.0005'), Decimal('1000'), Decimal('12.5')))
+
+        def set_mode(mode):
+            self.con.decimal = mode
+        self.assertRaises(self.driver.ProgrammingError, set_mode, 'money')
+
+        self.curs.close()
+        self.con.close()
+
+    def test_outputConverters(self):
+        """Result columns converted as set by connection.converters and
+        cursor.converters
+        """
+        self.con = self._connect()
+        self.curs = self.con.cursor()
+
+        sql_query = "select decimal(12.5, 10, 2), ansidate('2026-10-16'), 42, nvarchar('abc', 3), decimal(NULL, 5, 1) from iidbconstants"
+        self.assertEqual(self.con.converters, {})
+        self.con.converters['SQL_DECIMAL'] = 'string'
+        self.curs.converters['SQL_TYPE_DATE'] = 'string'
+        self.curs.converters[0] = 'int'
+        self.curs.converters[2] = 'float'
+        self.curs.converters[3] = 'bytes'
+        self.curs.execute(sql_query)
+        rs = self.curs.fetchone()
+        self.assertEqual(rs[:3], (1250, '2026-10-16', 42.0))
+        self.assertEqual(type(rs[3]), str)
+        self.assertEqual(rs[4], None)
+
+        self.curs.converters = {3: 'string', 2: str}
+        self.curs.execute(sql_query)
+        self.assertEqual(self.curs.fetchone()[1:], (datetime.datetime(2026, 10, 16), '42', 'abc', None))
+        self.assertEqual(self.curs.fetchone(), None)
+
+        self.con.converters = None
+        self.curs.converters = None
+        self.curs.execute(sql_query)
+        self.assertEqual(self.curs.fetchone()[0], Decimal('12.50'))
+
+        self.curs.converters[1] = 'money'
+        self.assertRaises(self.driver.ProgrammingError, self.curs.execute, sql_query)
+
+        def set_converters(converters):
+            self.curs.converters = converters
+        self.assertRaises(self.driver.ProgrammingError, set_converters, [])
+
+        self.curs.close()
+        self.con.close()
+
+    def test_fetchColumns(self):
+        """Results fetched column by column, numeric columns as arrays
+        """
+        self.con = self._connect()
+        self.curs = self.con.cursor()
+
+        self.curs.execute("DECLARE GLOBAL TEMPORARY TABLE session.fetchcolumns (id integer, amount float, note varchar(10)) ON COMMIT PRESERVE ROWS WITH NORECOVERY")
+        self.curs.executemany("insert into session.fetchcolumns values (?, ?, ?)", [(i, i * 0.5, str(i)) for i in range(10)])
+
+        self.curs.execute("select id, amount, note from session.fetchcolumns order by id")
+        ids, amounts, notes = self.curs.fetchcolumns(4)
+        self.assertEqual(ids, array.array('l', range(4)))
+        self.assertEqual(amounts, array.array('d', [0.0, 0.5, 1.0, 1.5]))
+        self.assertEqual(notes, ['0', '1', '2', '3'])
+        self.assertEqual(self.curs.fetchone(), (4, 2.0, '4'))
+        ids, amounts, notes = self.curs.fetchcolumns(-1)
+        self.assertEqual(list(ids), range(5, 10))
+        self.assertEqual(self.curs.fetchcolumns(), [array.array('l'), array.array('d'), []])
+
+        self.curs.execute("insert into session.fetchcolumns values (NULL, NULL, NULL)")
+        self.curs.execute("select id, note from session.fetchcolumns where id > 7 or id is null order by id")
+        ids, notes = self.curs.fetchcolumns(10)
+        self.assertEqual(ids, [8, 9, None])
+        self.assertEqual(notes, ['8', '9', None])
+
+        self.curs.close()
+        self.con.close()
+
+    def test_fetchBuffers(self):
+        """Numeric columns of a rowset exported as buffers with a NULL
+        bitmap
+        """
+        self.con = self._connect()
+        self.curs = self.con.cursor()
+
+        self.curs.execute("DECLARE GLOBAL TEMPORARY TABLE session.fetchbuffers (id integer, amount float, note varchar(10)) ON COMMIT PRESERVE ROWS WITH NORECOVERY")
+        self.curs.executemany("insert into session.fetchbuffers values (?, ?, ?)", [(i, i * 0.5, str(i)) for i in range(250)] + [(None, None, None)])
+
+        self.curs.execute("select id, amount, note from session.fetchbuffers order by id")
+        self.assertEqual(self.curs.fetchone(), (0, 0.0, '0'))
+        rows = 1
+        while True:
+            columns = self.curs.fetchbuffers()
+            if columns is None:
+                break
+            ids, amounts, notes = columns
+            self.assertEqual(len(ids), len(notes))
+            self.assertEqual(ids.format, 'i')
+            self.assertEqual(amounts.format, 'd')
+            self.assertEqual(array.array('i', str(buffer(ids))).tolist(), [x or 0 for x in ids])
+            self.assertEqual(notes[0], str(ids[0]) if ids[0] is not None else None)
+            rows += len(ids)
+        self.assertEqual(rows, 251)
+        self.assertEqual(ids[-1], None)
+        self.assertEqual(ids.nullcount, 1)
+        self.assertEqual(ord(ids.nulls[(len(ids) - 1) / 8]) >> ((len(ids) - 1) % 8), 1)
+        self.assertEqual(self.curs.rowcount, 251)
+
+        self.curs.execute("select long_varchar('x') from iidbconstants")
+        self.assertRaises(self.driver.NotSupportedError, self.curs.fetchbuffers)
+
+        self.curs.close()
+        self.con.close()
+
+    def test_executeColumns(self):
+        """Parameter set sent column by column from sequences and buffers
+        """
+        self.con = self._connect()
+        self.curs = self.con.cursor()
+
+        self.curs.execute("DECLARE GLOBAL TEMPORARY TABLE session.executecolumns (id integer, amount float, note varchar(10)) ON COMMIT PRESERVE ROWS WITH NORECOVERY")
+        ids = array.array('l', range(1500))
+        amounts = array.array('d', [i * 0.5 for i in range(1500)])
+        notes = [str(i) for i in range(1499)] + [None]
+        self.curs.executecolumns("insert into session.executecolumns values (?, ?, ?)", (ids, amounts, notes))
+        self.assertEqual(self.curs.rowcount, 1500)
+
+        self.curs.execute("select count(*), sum(id), sum(amount), count(note) from session.executecolumns")
+        self.assertEqual(self.curs.fetchone(), (1500, 1124250, 562125.0, 1499))
+
+        # column buffers, NULLs included, go back in as they are
+        self.curs.execute("select id, amount from session.executecolumns where id < 10 or note is null")
+        columns = self.curs.fetchbuffers()
+        self.curs.execute("delete from session.executecolumns")
+        self.curs.executecolumns("insert into session.executecolumns values (?, ?, ?)", columns + [(None,) * len(columns[0])])
+        self.curs.execute("select count(*), sum(id) from session.executecolumns")
+        self.assertEqual(self.curs.fetchone(), (11, 1544))
+
+        self.assertRaises(self.driver.InterfaceError, self.curs.executecolumns, "insert into session.executecolumns (id) values (?)", ([1, 2], [3]))
+        self.assertRaises(self.driver.InterfaceError, self.curs.executecolumns, "insert into session.executecolumns (id) values (?)", (1,))
+
+        self.curs.close()
+        self.con.close()
+
+    def test_executeManyTypeChange(self):
+        """executemany() rows whose parameter types change between rows
+        """
+        self.con = self._connect()
+        self.curs = self.con.cursor()
+
+        self.curs.execute("DECLARE GLOBAL TEMPORARY TABLE session.typechange (a varchar(10), b float) ON COMMIT PRESERVE ROWS WITH NORECOVERY")
+        rows = [('a', 1), ('b', 2), (u'c', 2.5), (None, None), ('e', 4L), (u'f', 5)]
+        self.curs.executemany("insert into session.typechange values (?, ?)", rows)
+        self.curs.execute("select a, b from session.typechange order by b")
+        self.assertEqual(self.curs.fetchall(), [('a', 1.0), ('b', 2.0), ('c', 2.5), ('e', 4.0), ('f', 5.0), (None, None)])
+
+        self.curs.close()
+        self.con.close()
+
+    def test_parameterArena(self):
+        """Fixed size and Decimal parameters across executes with a
+        changing number of parameters
+        """
+        self.con = self._connect()
+        self.curs = self.con.cursor()
+
+        self.curs.execute("DECLARE GLOBAL TEMPORARY TABLE session.arena (i integer, d decimal(12,2), ts timestamp, dt ansidate) ON COMMIT PRESERVE ROWS WITH NORECOVERY")
+        self.curs.execute("insert into session.arena (i) values (?)", (1,))
+        self.curs.execute("insert into session.arena values (?, ?, ?, ?)", (2, Decimal('-12.50'), datetime.datetime(2026, 10, 16, 12, 30, 15), datetime.date(2026, 10, 16)))
+        self.curs.execute("insert into session.arena (i, d) values (?, ?)", (3, Decimal('1234567890.25')))
+        self.curs.execute("select i, d, ts, dt from session.arena order by i")
+        self.assertEqual(self.curs.fetchall(), [
+            (1, None, None, None),
+            (2, Decimal('-12.50'), datetime.datetime(2026, 10, 16, 12, 30, 15), datetime.datetime(2026, 10, 16)),
+            (3, Decimal('1234567890.25'), None, None)])
+
+        self.curs.close()
+        self.con.close()
+
+    def test_unicodeParameters(self):
+        """Several unicode parameters per execute, growing between
+        executes
+        """
+        self.con = self._connect()
+        self.curs = self.con.cursor()
+
+        self.curs.execute("DECLARE GLOBAL TEMPORARY TABLE session.uni (i integer, a nvarchar(500), b nvarchar(500)) ON COMMIT PRESERVE ROWS WITH NORECOVERY")
+        self.curs.execute("insert into session.uni values (?, ?, ?)", (1, u'a\u00e9', u''))
+        self.curs.execute("insert into session.uni values (?, ?, ?)", (2, u'\u9152' * 200, u'b' * 300))
+        self.curs.execute("insert into session.uni values (?, ?, ?)", (3, u'c', u'\u00e9d'))
+        self.curs.execute("select i, a, b from session.uni order by i")
+        self.assertEqual(self.curs.fetchall(), [
+            (1, u'a\u00e9', u''),
+            (2, u'\u9152' * 200, u'b' * 300),
+            (3, u'c', u'\u00e9d')])
+
+        self.curs.close()
+        self.con.close()
+
+    def test_prefetch(self):
+        """Rowsets fetched ahead by the worker thread
+        """
+        self.con = self._connect()
+        self.curs = self.con.cursor()
+
+        self.curs.execute("DECLARE GLOBAL TEMPORARY TABLE session.pf (i integer, s varchar(20)) ON COMMIT PRESERVE ROWS WITH NORECOVERY")
+        rows = [(x, 'row%d' % x) for x in range(1050)]
+        self.curs.executemany("insert into session.pf values (?, ?)", rows)
+
+        self.curs.prefetch = True
+        self.assertEqual(self.curs.prefetch, True)
+        self.curs.arraysize = 100
+        self.curs.execute("select i, s from session.pf order by i")
+        self.assertEqual(self.curs.fetchone(), rows[0])
+        self.assertEqual(self.curs.fetchmany(), rows[1:101])
+        self.assertEqual(self.curs.fetchall(), rows[101:])
+        self.assertEqual(self.curs.fetchone(), None)
+
+        # abandon a result set with a rowset fetched ahead
+        self.curs.execute("select i, s from session.pf order by i")
+        self.assertEqual(self.curs.fetchmany(150), rows[:150])
+        self.curs.execute("select i, s from session.pf order by i")
+        self.assertEqual(list(self.curs), rows)
+
+        self.curs.execute("select i, s from session.pf order by i")
+        self.curs.fetchone()
+        self.curs.close()
+        self.con.close()
+
+    def test_executeAsync(self):
+        """Asynchronous execute, polled and waited on
+        """
+        self.con = self._connect()
+        self.curs = self.con.cursor()
+
+        self.curs.execute("DECLARE GLOBAL TEMPORARY TABLE session.ea (i integer) ON COMMIT PRESERVE ROWS WITH NORECOVERY")
+        self.curs.executemany("insert into session.ea values (?)",
+            [(x,) for x in range(100)])
+
+        pending = self.curs.execute_async("select count(*) from session.ea where i >= ?", (50,))
+        self.assertTrue(pending.wait())
+        self.assertTrue(pending.done())
+        self.assertEqual(len(self.curs.description), 1)
+        self.assertEqual(self.curs.fetchall(), [(50,)])
+
+        pending = self.curs.execute_async("select i from session.ea order by i")
+        if sys.platform != 'win32':
+            readable, _, _ = select.select([pending], [], [], 60)
+            self.assertEqual(readable, [pending])
+        while not pending.done():
+            pending.wait(0.1)
+        self.assertEqual(self.curs.fetchone(), (0,))
+
+        # a fetch waits for a pending execute
+        self.curs.execute_async("select i from session.ea where i < 3 order by i")
+        self.assertEqual(self.curs.fetchall(), [(0,), (1,), (2,)])
+
+        pending = self.curs.execute_async("select * from session.no_such_table")
+        self.assertRaises(self.driver.DatabaseError, pending.wait)
+
+        # a cursor deleted with an execute pending waits for it
+        curs = self.con.cursor()
+        curs.execute_async("select i from session.ea")
+        del curs
+
+        self.curs.close()
+        self.con.close()
+
+    def test_cancelAndTimeout(self):
+        """Query timeouts and cancelling a query from another thread
+        """
+        self.con = self._connect()
+        self.curs = self.con.cursor()
+
+        self.assertEqual(self.con.timeout, 0)
+        self.assertEqual(self.curs.timeout, None)
+        self.curs.timeout = 1.5
+        self.assertEqual(self.curs.timeout, 2)
+        self.curs.timeout = None
+        self.con.timeout = None
+        self.assertEqual(self.con.timeout, 0)
+        self.assertRaises(self.driver.ProgrammingError,
+            setattr, self.curs, 'timeout', -1)
+        self.assertRaises(self.driver.ProgrammingError,
+            setattr, self.con, 'timeout', 'x')
+
+        # nothing is executing
+        self.curs.cancel()
+        self.curs.execute("select 1")
+        self.assertEqual(self.curs.fetchall(), [(1,)])
+
+        # a cartesian product that runs far longer than the test waits
+        query = "select count(*) from iicolumns a, iicolumns b, iicolumns c"
+        pending = self.curs.execute_async(query)
+        time.sleep(1)
+        self.curs.cancel()
+        self.assertRaises(self.driver.DatabaseError, pending.wait)
+
+        self.con.timeout = 1
+        self.assertRaises(self.driver.DatabaseError, self.curs.execute, query)
+
+        self.curs.close()
+        self.assertRaises(self.driver.InterfaceError, self.curs.cancel)
+        self.con.close()
+
+    def test_connectionPool(self):
+        """Connection pool reuse, waiting and statistics
+        """
+        pool = self.driver.ConnectionPool(*self.connect_args,
+            **dict(self.connect_kw_args, minsize=1, maxsize=2,
+            validate="select 1"))
+        self.assertEqual(pool.stats['size'], 1)
+        self.assertEqual(pool.stats['idle'], 1)
+
+        con = pool.connect()
+        curs = con.cursor()
+        curs.execute("select 1")
+        self.assertEqual(curs.fetchall(), [(1,)])
+        con.close()
+        # returning the connection closed its cursors
+        self.assertRaises(self.driver.Error, curs.fetchall)
+
+        con1 = pool.connect()
+        con2 = pool.connect()
+        self.assertEqual(pool.stats['connects'], 2)
+        self.assertRaises(self.driver.OperationalError, pool.connect, 0.1)
+        con1.close()
+        con1 = pool.connect(1)
+        curs = con1.cursor()
+        curs.execute("select 1")
+        self.assertEqual(curs.fetchall(), [(1,)])
+
+        stats = pool.stats
+        self.assertEqual(stats['connects'], 2)
+        self.assertEqual(stats['in_use'], 2)
+        self.assertEqual(stats['timeouts'], 1)
+        self.assertEqual(stats['acquires'], 4)
+
+        con1.close()
+        pool.close()
+        self.assertEqual(pool.stats['idle'], 0)
+        self.assertRaises(self.driver.InterfaceError, pool.connect)
+        con2.close()
+        self.assertEqual(pool.stats['size'], 0)
+
+        for bad in (dict(idletimeout="soon"), dict(validate=1)):
+            self.assertRaises(self.driver.InterfaceError,
+                self.driver.ConnectionPool, *self.connect_args,
+                **dict(self.connect_kw_args, **bad))
+
+    def test_sharedEnvironment(self):
+        """Pooled and non-pooled connections sharing ODBC environments
+        """
+        pooled = self.driver.connect(*self.connect_args,
+            **dict(self.connect_kw_args, pooled='on'))
+        plain = self.driver.connect(*self.connect_args,
+            **dict(self.connect_kw_args, pooled='off'))
+        for i in range(10):
+            self.driver.connect(*self.connect_args,
+                **self.connect_kw_args).close()
+        pooled.close()
+        # the environment of the remaining connection is still in use
+        curs = plain.cursor()
+        curs.execute("select 1")
+        self.assertEqual(curs.fetchall(), [(1,)])
+        plain.close()
+
     '''
     def test_TemplateCopyPasteMe(self):
         """Template test description fill me in